@@ -0,0 +1,102 @@
+/**
+ * @file aggregator.h
+ *
+ * Time-aligned aggregation of the data coming from several devices
+ * that share a common time-base (master/slave setups with a common
+ * timestamp reset, see DAVIS_CONFIG_SYSINFO_DEVICE_IS_MASTER).
+ * The aggregator polls all devices and returns packet containers
+ * that cover the same, fixed timestamp interval for all of them.
+ */
+
+#ifndef LIBCAER_DEVICES_AGGREGATOR_H_
+#define LIBCAER_DEVICES_AGGREGATOR_H_
+
+#include "usb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Pointer to a device aggregator.
+ */
+typedef struct caer_device_aggregator *caerDeviceAggregator;
+
+/**
+ * Create a new aggregator over the given devices. The devices stay
+ * owned by the caller and must remain open while the aggregator is used.
+ * Data acquisition must be started separately with caerDeviceDataStart(),
+ * and CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING should be disabled, as the
+ * aggregator polls all devices in turn.
+ *
+ * The packet containers returned by caerDeviceAggregatorDataGet() group the
+ * packets per source: the packet at position P of a container coming from
+ * the device with index D is placed at position (D * packetsPerDevice) + P,
+ * see caerDeviceAggregatorGetPacketPosition().
+ *
+ * A time interval is emitted once all devices have delivered data past its
+ * end, or once any device is more than maxLateness past its end (watermark).
+ * In the latter case, the lagging devices' events for that interval that
+ * arrive afterwards are dropped and counted, see caerDeviceAggregatorGetLateEvents().
+ *
+ * @param handles array of valid device handles.
+ * @param handlesNumber number of device handles, at least one.
+ * @param packetsPerDevice number of packet positions reserved per device, must be
+ *                         at least as big as the containers of any device.
+ * @param interval length of each aggregated time interval, in µs.
+ * @param maxLateness how long to wait for slow devices, in µs.
+ *
+ * @return a valid aggregator handle, or NULL on error.
+ */
+caerDeviceAggregator caerDeviceAggregatorCreate(const caerDeviceHandle *handles, size_t handlesNumber,
+	int32_t packetsPerDevice, int64_t interval, int64_t maxLateness);
+
+/**
+ * Free an aggregator and any data it still holds. Does not close the devices.
+ *
+ * @param aggregator an aggregator handle. Can be NULL.
+ */
+void caerDeviceAggregatorFree(caerDeviceAggregator aggregator);
+
+/**
+ * Poll all devices for new data, and return the next complete time interval,
+ * if any. Never blocks.
+ * Timestamp resets are handled as a barrier: once all devices have reported
+ * theirs, any pending data is returned, followed by one container holding
+ * the timestamp reset packets of all devices, and aggregation starts again.
+ *
+ * @param aggregator a valid aggregator handle.
+ *
+ * @return a packet container covering one time interval for all devices,
+ *         or NULL if none is ready yet. Empty intervals are skipped.
+ *         The container is owned by the caller.
+ */
+caerEventPacketContainer caerDeviceAggregatorDataGet(caerDeviceAggregator aggregator);
+
+/**
+ * Position of a device's packet inside the aggregated containers.
+ *
+ * @param aggregator a valid aggregator handle.
+ * @param deviceIndex index of the device in the handles array given at creation.
+ * @param packetPosition position of the packet inside that device's own containers.
+ *
+ * @return position inside the aggregated containers, or -1 on invalid arguments.
+ */
+int32_t caerDeviceAggregatorGetPacketPosition(caerDeviceAggregator aggregator, size_t deviceIndex,
+	int32_t packetPosition);
+
+/**
+ * Number of events dropped because they arrived after their time interval
+ * had already been returned.
+ *
+ * @param aggregator a valid aggregator handle.
+ *
+ * @return number of late events dropped so far.
+ */
+uint64_t caerDeviceAggregatorGetLateEvents(caerDeviceAggregator aggregator);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBCAER_DEVICES_AGGREGATOR_H_ */
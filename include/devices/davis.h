@@ -13,6 +13,7 @@
 #include "../events/frame.h"
 #include "../events/imu6.h"
 #include "../events/sample.h"
+#include "../events/pcm.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -1243,6 +1244,18 @@ extern "C" {
  * For 44.1 KHz it would be 35, and for 16 KHz it would be 97.
  */
 #define DAVIS_CONFIG_MICROPHONE_SAMPLE_FREQUENCY 1
+/**
+ * Parameter address for module DAVIS_CONFIG_MICROPHONE:
+ * deliver microphone data as PCM events (see 'events/pcm.h') instead
+ * of one ADC sample event per sample (default). Each packet then holds
+ * one event per channel (0 is left, 1 is right), with the channel's
+ * samples as contiguous, sign-extended 32 bit integers, the timestamp
+ * of its first sample, and the sample rate in Hz, derived from
+ * DAVIS_CONFIG_MICROPHONE_SAMPLE_FREQUENCY. The packets take the
+ * sample packet's position in the packet container, which then
+ * has event type PCM_EVENT. This is a host-side setting.
+ */
+#define DAVIS_CONFIG_MICROPHONE_PCM_OUTPUT       80
 
 /**
  * Parameter address for module DAVIS_CONFIG_USB:
@@ -152,6 +152,57 @@ extern "C" {
  */
 #define DYNAPSE_CONFIG_SPIKEGEN_ISIBASE 5
 
+/**
+ * Module address: host-side spike event handling configuration.
+ * Splitting of spike packets and per-neuron spike counters,
+ * see caerDynapseSpikeCountersGet().
+ */
+#define DYNAPSE_CONFIG_HOST_SPIKES -16
+
+/**
+ * Parameter address for module DYNAPSE_CONFIG_HOST_SPIKES:
+ * how to split spike events into packets, one of DYNAPSE_SPIKES_SPLIT_NONE,
+ * DYNAPSE_SPIKES_SPLIT_CHIP or DYNAPSE_SPIKES_SPLIT_CORE.
+ * With splitting enabled, the packet container holds one spike packet per
+ * chip (4) or per chip and core (16), at position DYNAPSE_SPIKE_EVENT_POS
+ * plus caerDynapseSpikePacketIndex(); empty ones are NULL as usual.
+ * Only takes effect on caerDeviceDataStart() calls.
+ */
+#define DYNAPSE_CONFIG_HOST_SPIKES_SPLIT 0
+
+/**
+ * Parameter address for module DYNAPSE_CONFIG_HOST_SPIKES:
+ * enable per-neuron spike counting (4 chips x 4 cores x 256 neurons).
+ * Counts are published on every packet container commit and can be
+ * read at any time with caerDynapseSpikeCountersGet().
+ */
+#define DYNAPSE_CONFIG_HOST_SPIKES_COUNTERS 1
+
+/**
+ * Parameter address for module DYNAPSE_CONFIG_HOST_SPIKES:
+ * reset all spike counters to zero. This is an impulse, it
+ * always reads back as false.
+ */
+#define DYNAPSE_CONFIG_HOST_SPIKES_COUNTERS_RESET 2
+
+/**
+ * All spike events in one packet (default).
+ */
+#define DYNAPSE_SPIKES_SPLIT_NONE 0
+/**
+ * One spike packet per chip.
+ */
+#define DYNAPSE_SPIKES_SPLIT_CHIP 1
+/**
+ * One spike packet per chip and core.
+ */
+#define DYNAPSE_SPIKES_SPLIT_CORE 2
+
+/**
+ * Position of the (first) spike event packet inside a Dynap-se packet container.
+ */
+#define DYNAPSE_SPIKE_EVENT_POS 1
+
 /**
  * Parameter address for module DYNAPSE_CONFIG_SYNAPSERECONFIG:
  * Run control. Starts and stops handshaking with DVS.
@@ -462,6 +513,13 @@ extern "C" {
 #define DYNAPSE_CONFIG_CAMTYPE_F_INH		1
 #define DYNAPSE_CONFIG_CAMTYPE_S_INH		0
 
+#define DYNAPSE_CONFIG_NUMCHIPS				4
+
+/**
+ * Number of per-neuron spike counters, see caerDynapseSpikeCountersGet().
+ */
+#define DYNAPSE_SPIKE_COUNTERS_NUMBER (DYNAPSE_CONFIG_NUMCHIPS * DYNAPSE_CONFIG_NUMNEURONS)
+
 /*
  *  maximum user memory per query, libusb will digest it in chuncks of max 512 bytes per single transfer
  * */
@@ -595,6 +653,12 @@ extern "C" {
 #define DYNAPSE_CONFIG_BIAS_D_SSP               			115
 #define DYNAPSE_CONFIG_BIAS_D_SSN               			116
 
+/**
+ * Number of bias addresses (highest bias address plus one), see
+ * caerDynapseWriteBiases().
+ */
+#define DYNAPSE_CONFIG_BIAS_NUMBER							117
+
 /**
  * Dynap-se device-related information.
  */
@@ -642,6 +706,16 @@ struct caer_bias_dynapse {
 // TODO: what? precise biasLowHi, currentLevel really, special?
 // TODO: add generate/parse functions.
 
+/**
+ * One entry of a bias table for caerDynapseWriteBiases().
+ */
+struct caer_dynapse_bias_value {
+	/// Bias address (DYNAPSE_CONFIG_BIAS_*), below DYNAPSE_CONFIG_BIAS_NUMBER.
+	uint8_t biasAddress;
+	/// Bias configuration bits, as sent with DYNAPSE_CONFIG_CHIP_CONTENT.
+	uint32_t biasBits;
+};
+
 /**
  * Return basic information on the device, such as its ID, the logic
  * version, and so on. See the 'struct caer_dynapse_info' documentation
@@ -662,6 +736,110 @@ struct caer_dynapse_info caerDynapseInfoGet(caerDeviceHandle handle);
  */
 bool caerDynapseWriteSramWords(caerDeviceHandle handle, const uint16_t *data, uint32_t baseAddr, uint32_t numWords);
 
+/**
+ * Start streaming stimulus segments to the spike generator (DYNAPSE_CONFIG_SPIKEGEN).
+ * The SRAM region [baseAddr, baseAddr + 2 * halfSize) is split into two halves:
+ * while one plays, the next segment is uploaded into the other one with
+ * caerDynapseStimulusStreamQueue(), and playback is then moved over to it
+ * with caerDynapseStimulusStreamSwap(). Stops any current spike generator playback.
+ * The other spike generator settings (VARMODE, ISI, ISIBASE) are left untouched.
+ *
+ * @param handle a valid device handle.
+ * @param baseAddr SRAM word address of the first half.
+ * @param halfSize size of each half, in 16 bit words.
+ *
+ * @return true on success, false otherwise.
+ */
+bool caerDynapseStimulusStreamStart(caerDeviceHandle handle, uint32_t baseAddr, uint32_t halfSize);
+
+/**
+ * Upload the next stimulus segment into the idle SRAM half. Doesn't disturb
+ * the segment currently playing. Only one segment can be queued at a time.
+ *
+ * @param handle a valid device handle.
+ * @param data segment content, as for caerDynapseWriteSramWords().
+ * @param numWords number of 16 bit words in data, at most halfSize.
+ * @param stimCount number of events to play from this segment (DYNAPSE_CONFIG_SPIKEGEN_STIMCOUNT).
+ *
+ * @return true on success, false otherwise.
+ */
+bool caerDynapseStimulusStreamQueue(caerDeviceHandle handle, const uint16_t *data, uint32_t numWords,
+	uint32_t stimCount);
+
+/**
+ * Move playback to the queued segment, with a single USB transfer that
+ * stops the spike generator, points it to the other half and restarts it.
+ * Call this when the currently playing segment is done, or to start the
+ * first segment after caerDynapseStimulusStreamStart().
+ *
+ * @param handle a valid device handle.
+ *
+ * @return true on success, false otherwise (also if no segment is queued).
+ */
+bool caerDynapseStimulusStreamSwap(caerDeviceHandle handle);
+
+/**
+ * Stop stimulus streaming and spike generator playback.
+ *
+ * @param handle a valid device handle.
+ *
+ * @return true on success, false otherwise.
+ */
+bool caerDynapseStimulusStreamStop(caerDeviceHandle handle);
+
+/**
+ * Index of a neuron in the spike counters array, from the fields of a spike event.
+ *
+ * @param chipId chip ID (DYNAPSE_CONFIG_DYNAPSE_U*).
+ * @param coreId source core ID [0,3].
+ * @param neuronId neuron ID inside the core [0,255].
+ *
+ * @return index into the array filled by caerDynapseSpikeCountersGet().
+ */
+static inline size_t caerDynapseSpikeCountersIndex(uint8_t chipId, uint8_t coreId, uint32_t neuronId) {
+	return (((size_t) ((chipId >> 2) & 0x03) * DYNAPSE_CONFIG_NUMNEURONS)
+		+ ((size_t) (coreId & 0x03) * DYNAPSE_CONFIG_NUMNEURONS_CORE) + (size_t) (neuronId & 0xFF));
+}
+
+/**
+ * Offset from DYNAPSE_SPIKE_EVENT_POS of the spike packet holding events
+ * from the given chip and core, for the given DYNAPSE_CONFIG_HOST_SPIKES_SPLIT mode.
+ *
+ * @param splitMode one of DYNAPSE_SPIKES_SPLIT_NONE, DYNAPSE_SPIKES_SPLIT_CHIP or DYNAPSE_SPIKES_SPLIT_CORE.
+ * @param chipId chip ID (DYNAPSE_CONFIG_DYNAPSE_U*).
+ * @param coreId source core ID [0,3].
+ *
+ * @return spike packet index.
+ */
+static inline size_t caerDynapseSpikePacketIndex(uint32_t splitMode, uint8_t chipId, uint8_t coreId) {
+	if (splitMode == DYNAPSE_SPIKES_SPLIT_CHIP) {
+		return ((size_t) ((chipId >> 2) & 0x03));
+	}
+	else if (splitMode == DYNAPSE_SPIKES_SPLIT_CORE) {
+		return (((size_t) ((chipId >> 2) & 0x03) * DYNAPSE_CONFIG_NUMCORES) + (size_t) (coreId & 0x03));
+	}
+
+	return (0);
+}
+
+/**
+ * Get a consistent snapshot of the per-neuron spike counters, as of the
+ * last packet container commit. Counting must be enabled with
+ * DYNAPSE_CONFIG_HOST_SPIKES_COUNTERS. Counters are cumulative since the
+ * last reset (DYNAPSE_CONFIG_HOST_SPIKES_COUNTERS_RESET or data start),
+ * firing rates are the difference between two snapshots over the
+ * difference of their timestamps.
+ * Lock-free: never blocks the data acquisition thread.
+ *
+ * @param handle a valid device handle.
+ * @param counters array of DYNAPSE_SPIKE_COUNTERS_NUMBER elements to fill,
+ *                 see caerDynapseSpikeCountersIndex().
+ * @param timestamp if not NULL, the full 64 bit timestamp of the snapshot.
+ *
+ * @return true on success, false otherwise.
+ */
+bool caerDynapseSpikeCountersGet(caerDeviceHandle handle, uint32_t *counters, int64_t *timestamp);
+
 /*
  *
  *  Remember to Select the chip before calling this function
@@ -693,6 +871,59 @@ bool caerDynapseWriteSram(caerDeviceHandle handle, uint16_t coreId, uint32_t neu
  */
 bool caerDynapseSendDataToUSB(caerDeviceHandle handle, const uint32_t *data, size_t numConfig);
 
+/*
+ * Remember to Select the chip before calling this function
+ *
+ * @param handle a valid device handle.
+ *  data , pointer to array of configuration bits (CAM, SRAM, biases...)
+ *  numConfig , number of configurations to send, not limited in size
+ *  maxTransfersInFlight , number of USB transfers (of up to DYNAPSE_CONFIG_MAX_PARAM_SIZE
+ *                         configurations each) to keep queued at the same time, 0 for default (8)
+ *  verifyInterval , verify the device status every this many transfers, 0 to verify only
+ *                   once at the end
+ *  configsPerSecond , if not NULL, the achieved throughput in configurations per second
+ *
+ *  Like caerDynapseSendDataToUSB(), but uses asynchronous USB transfers to keep
+ *  several chunks in flight, instead of waiting for a verification after each chunk.
+ *  Suited to bulk programming, such as all the CAMs of a chip.
+ *
+ * @return true on success, false otherwise
+ */
+bool caerDynapseSendDataToUSBPipelined(caerDeviceHandle handle, const uint32_t *data, size_t numConfig,
+	size_t maxTransfersInFlight, size_t verifyInterval, double *configsPerSecond);
+
+/**
+ * Program a table of biases (for example all biases of a core, or of a chip)
+ * on one chip, using multi-config transfers instead of one transfer per bias.
+ * A host-side cache remembers the last value written to each bias of each chip
+ * by this function, and unchanged biases are not sent again.
+ * The chip selection (DYNAPSE_CONFIG_CHIP_ID) is restored before returning.
+ *
+ * Biases written directly with DYNAPSE_CONFIG_CHIP_CONTENT bypass the cache:
+ * call caerDynapseBiasCacheInvalidate() after mixing those with this function.
+ *
+ * @param handle a valid device handle.
+ * @param chipId chip to program (DYNAPSE_CONFIG_DYNAPSE_U*).
+ * @param biases table of biases to set, in the order they must be sent.
+ * @param biasesNumber number of entries in the table.
+ * @param biasesSent if not NULL, the number of biases actually sent.
+ *
+ * @return true on success, false otherwise.
+ */
+bool caerDynapseWriteBiases(caerDeviceHandle handle, uint8_t chipId, const struct caer_dynapse_bias_value *biases,
+	size_t biasesNumber, size_t *biasesSent);
+
+/**
+ * Forget the cached bias values of a chip, so that the next
+ * caerDynapseWriteBiases() sends all of them.
+ *
+ * @param handle a valid device handle.
+ * @param chipId a chip ID (DYNAPSE_CONFIG_DYNAPSE_U*), or -1 for all chips.
+ *
+ * @return true on success, false otherwise.
+ */
+bool caerDynapseBiasCacheInvalidate(caerDeviceHandle handle, int16_t chipId);
+
 /*
  * Remember to Select the chip before calling this function
  *
@@ -724,6 +955,105 @@ bool caerDynapseWriteCam(caerDeviceHandle handle, uint32_t preNeuronAddr, uint32
 uint32_t caerDynapseGenerateCamBits(uint32_t preNeuronAddr, uint32_t postNeuronAddr, uint32_t camId,
 	int16_t synapseType);
 
+/**
+ * Host-side description of a complete Dynap-se network (CAM and SRAM content
+ * of all four chips), to be programmed with caerDynapseNetworkApply().
+ * The device keeps an image of what was last programmed, so that applying
+ * a modified network only sends the CAM/SRAM entries that actually changed.
+ */
+typedef struct caer_dynapse_network *caerDynapseNetwork;
+
+/**
+ * Allocate a new, empty network description (all CAMs cleared, all SRAMs empty).
+ *
+ * @return a network description, or NULL on memory allocation failure.
+ */
+caerDynapseNetwork caerDynapseNetworkAllocate(void);
+
+/**
+ * Free a network description.
+ *
+ * @param network a network description. Can be NULL.
+ */
+void caerDynapseNetworkFree(caerDynapseNetwork network);
+
+/**
+ * Reset a network description to its empty state.
+ *
+ * @param network a valid network description.
+ */
+void caerDynapseNetworkClear(caerDynapseNetwork network);
+
+/*
+ * Set a CAM entry in the network description.
+ *
+ *  chipId [DYNAPSE_CONFIG_DYNAPSE_U0,DYNAPSE_CONFIG_DYNAPSE_U1,DYNAPSE_CONFIG_DYNAPSE_U2,DYNAPSE_CONFIG_DYNAPSE_U3],
+ *  preNeuron [0,1023], postNeuron [0,1023], camId [0,63], synapseType [DYNAPSE_CONFIG_CAMTYPE_F_EXC
+ *																		DYNAPSE_CONFIG_CAMTYPE_S_EXC
+ *																		DYNAPSE_CONFIG_CAMTYPE_F_INH
+ *																		DYNAPSE_CONFIG_CAMTYPE_S_INH]
+ *
+ * @return true on success, false on invalid parameters.
+ */
+bool caerDynapseNetworkSetSynapse(caerDynapseNetwork network, uint8_t chipId, uint32_t preNeuronAddr,
+	uint32_t postNeuronAddr, uint32_t camId, int16_t synapseType);
+
+/*
+ * Reset a CAM entry in the network description to its cleared state.
+ *
+ * @return true on success, false on invalid parameters.
+ */
+bool caerDynapseNetworkClearSynapse(caerDynapseNetwork network, uint8_t chipId, uint32_t postNeuronAddr,
+	uint32_t camId);
+
+/*
+ * Set an SRAM (routing) entry in the network description.
+ *
+ *  chipId [DYNAPSE_CONFIG_DYNAPSE_U0,DYNAPSE_CONFIG_DYNAPSE_U1,DYNAPSE_CONFIG_DYNAPSE_U2,DYNAPSE_CONFIG_DYNAPSE_U3],
+ *  neuronAddr [0,1023], sramId [0,3], the rest as in caerDynapseWriteSram().
+ *
+ * @return true on success, false on invalid parameters.
+ */
+bool caerDynapseNetworkSetRoute(caerDynapseNetwork network, uint8_t chipId, uint32_t neuronAddr, uint16_t sramId,
+	uint16_t virtualCoreId, bool sx, uint8_t dx, bool sy, uint8_t dy, uint16_t destinationCore);
+
+/*
+ * Reset an SRAM entry in the network description to its empty state.
+ *
+ * @return true on success, false on invalid parameters.
+ */
+bool caerDynapseNetworkClearRoute(caerDynapseNetwork network, uint8_t chipId, uint32_t neuronAddr, uint16_t sramId);
+
+/**
+ * Program a network description onto the device, sending only the CAM and SRAM
+ * entries that differ from what was last programmed by this function.
+ * The first time, or after an invalidation, a chip is fully reprogrammed.
+ * The chip selection (DYNAPSE_CONFIG_CHIP_ID) is restored before returning.
+ *
+ * DYNAPSE_CONFIG_CLEAR_CAM, DYNAPSE_CONFIG_DEFAULT_SRAM and DYNAPSE_CONFIG_DEFAULT_SRAM_EMPTY
+ * invalidate the host-side image automatically. Direct CAM/SRAM writes, like
+ * caerDynapseWriteCam() or caerDynapseWriteSram(), do not: call caerDynapseNetworkInvalidate()
+ * after mixing those with this function.
+ *
+ * @param handle a valid device handle.
+ * @param network a valid network description.
+ * @param configsSent if not NULL, the number of CAM/SRAM configurations actually sent.
+ *
+ * @return true on success, false otherwise.
+ */
+bool caerDynapseNetworkApply(caerDeviceHandle handle, caerDynapseNetwork network, size_t *configsSent);
+
+/**
+ * Forget what is known about the CAM/SRAM content of a chip, forcing the next
+ * caerDynapseNetworkApply() to fully reprogram it.
+ *
+ * @param handle a valid device handle.
+ * @param chipId a chip ID (DYNAPSE_CONFIG_DYNAPSE_U*), or -1 for all chips.
+ *
+ * @return true on success, false otherwise.
+ */
+bool caerDynapseNetworkInvalidate(caerDeviceHandle handle, int16_t chipId);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,103 @@
+/**
+ * @file playback.h
+ *
+ * Playback of AEDAT 3.1 recordings as if they came from a live
+ * device, through the common device API (caerDeviceDataStart(),
+ * caerDeviceDataGet(), caerDeviceDataStop() and so on).
+ * Only playback-specific configuration options and the function
+ * to open a recording are present here. Of the host-side options
+ * in usb.h, the CAER_HOST_CONFIG_DATAEXCHANGE and
+ * CAER_HOST_CONFIG_THREAD modules are supported too.
+ */
+
+#ifndef LIBCAER_DEVICES_PLAYBACK_H_
+#define LIBCAER_DEVICES_PLAYBACK_H_
+
+#include "usb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Device type definition for AEDAT 3.1 recording playback.
+ * This device type can't be opened with caerDeviceOpen(),
+ * use caerPlaybackOpen() instead.
+ */
+#define CAER_DEVICE_PLAYBACK 4
+
+/**
+ * Module address: playback pacing configuration.
+ */
+#define PLAYBACK_CONFIG_PACING 0
+
+/**
+ * Parameter address for module PLAYBACK_CONFIG_PACING:
+ * playback speed, in percent of real-time. At 100 (default), packet
+ * containers are delivered following the timestamps of the recording,
+ * at 200 twice as fast, and so on. Zero disables pacing: the recording
+ * is played back as fast as the caller takes the data. Playback never
+ * drops data: if the caller falls behind, it waits for it, and catches
+ * up afterwards. Changes take effect right away.
+ */
+#define PLAYBACK_CONFIG_PACING_SPEED 0
+
+/**
+ * AEDAT 3.1 recording playback information.
+ */
+struct caer_playback_info {
+	/// Unique device identifier. Also 'source' for events.
+	int16_t deviceID;
+	/// Device information string, for logging purposes.
+	char *deviceString;
+	/// Source ID of the played back events inside the recording.
+	int16_t sourceID;
+	/// Source description from the recording's header (for example
+	/// the name of the device that recorded it). Empty if not present.
+	char *sourceString;
+};
+
+/**
+ * Open an AEDAT 3.1 recording for playback, assign an ID to it and
+ * return a device handle for further usage with the common device API.
+ * Only the events of the first source listed in the recording's header
+ * (or, if none is listed, of the first event packet) are played back,
+ * with their source ID changed to deviceID.
+ * Packet containers are rebuilt as in the recording: a new container
+ * starts whenever a packet type repeats, and timestamp resets are
+ * delivered in a container of their own, as with live devices. Each
+ * packet is placed at the container position given by its event type.
+ * Once the end of the recording is reached, data acquisition stops and
+ * the shutdown notification passed to caerDeviceDataStart() is called;
+ * caerDeviceDataStart() restarts playback from the beginning.
+ * The recording must be in the 'RAW' format (no compression).
+ * Containers carry the host time at which they were made available.
+ * caerDeviceTimestampToHost() has no estimate for recordings and
+ * always returns -1.
+ *
+ * @param deviceID a unique ID to identify the playback device from others.
+ *                 Will be used as the source for EventPackets being generated.
+ * @param fileName path of the AEDAT 3.1 recording to play back.
+ *
+ * @return a valid device handle that can be used with the other libcaer functions,
+ *         or NULL on error. Always check for this!
+ */
+caerDeviceHandle caerPlaybackOpen(uint16_t deviceID, const char *fileName);
+
+/**
+ * Return basic information on the playback device, such as its ID and
+ * the source being played back. See the 'struct caer_playback_info'
+ * documentation for more details.
+ *
+ * @param handle a valid device handle.
+ *
+ * @return a copy of the device information structure if successful,
+ *         an empty structure (all zeros) on failure.
+ */
+struct caer_playback_info caerPlaybackInfoGet(caerDeviceHandle handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBCAER_DEVICES_PLAYBACK_H_ */
@@ -33,6 +33,19 @@ typedef struct caer_device_handle *caerDeviceHandle;
  * Module address: host-side event packets generation configuration.
  */
 #define CAER_HOST_CONFIG_PACKETS -3
+/**
+ * Module address: host-side data acquisition thread configuration.
+ * Also applies to the reading thread of the Playback device.
+ */
+#define CAER_HOST_CONFIG_THREAD -4
+/**
+ * Module address: host-side secondary data delivery queues configuration.
+ */
+#define CAER_HOST_CONFIG_QUEUES -5
+/**
+ * Module address: host-side load shedding configuration.
+ */
+#define CAER_HOST_CONFIG_SHEDDING -6
 
 /**
  * Parameter address for module CAER_HOST_CONFIG_USB:
@@ -48,6 +61,59 @@ typedef struct caer_device_handle *caerDeviceHandle;
  * them if you're running into I/O limits.
  */
 #define CAER_HOST_CONFIG_USB_BUFFER_SIZE   1
+/**
+ * Parameter address for module CAER_HOST_CONFIG_USB:
+ * write a raw capture of the USB data stream to this file descriptor.
+ * Every completed data transfer is stored as-is, together with its
+ * host arrival time, before being translated into events. Capture
+ * files start with the device configuration event translation
+ * depends on, and can be translated later with
+ * CAER_HOST_CONFIG_USB_REPLAY_FD.
+ * Data transfers are copied to memory and written to the file by a
+ * separate thread, so slow writes never hold up the USB data stream.
+ * If writing falls too far behind, data transfers are left out of the
+ * capture, without affecting their translation; their number is logged
+ * as a warning by caerDeviceDataStop().
+ * Pass the file descriptor cast to uint32_t, or (uint32_t) -1 to
+ * disable capturing (default). The file descriptor is not closed
+ * by libcaer, it must stay valid until caerDeviceDataStop().
+ * Only supported by DAVIS devices.
+ * Only takes effect on caerDeviceDataStart() calls!
+ */
+#define CAER_HOST_CONFIG_USB_CAPTURE_FD        2
+/**
+ * Parameter address for module CAER_HOST_CONFIG_USB:
+ * whether to still translate the USB data stream into events while
+ * capturing it with CAER_HOST_CONFIG_USB_CAPTURE_FD. If disabled,
+ * event translation, packet allocation and commit are skipped
+ * entirely: caerDeviceDataGet() will not return any data, but
+ * capturing costs only a fraction of the CPU time. Defaults to true.
+ * Only takes effect on caerDeviceDataStart() calls!
+ */
+#define CAER_HOST_CONFIG_USB_CAPTURE_TRANSLATE 3
+/**
+ * Parameter address for module CAER_HOST_CONFIG_USB:
+ * translate the raw USB capture read from this file descriptor,
+ * instead of the live USB data stream. The captured transfers go
+ * through the same event translation, with their recorded arrival
+ * times, and the resulting packet containers are delivered as usual
+ * by caerDeviceDataGet(). The device's data producers are not started
+ * and no USB data transfers are made. Translation is lossless: the
+ * next transfer is only translated once the caller took all packet
+ * containers produced so far. At the end of the capture, any events
+ * still waiting are committed and data acquisition stops, calling
+ * the shutdown notification.
+ * The capture must come from the same type of device and chip, with
+ * the same sizes and orientation, or replaying fails. The APS modes,
+ * IMU scales and ROI regions stored in the capture are used for its
+ * translation, instead of the current ones of this device.
+ * Pass the file descriptor cast to uint32_t, or (uint32_t) -1 to
+ * disable replaying (default). The file descriptor is not closed
+ * by libcaer, it must stay valid until caerDeviceDataStop().
+ * Only supported by DAVIS devices.
+ * Only takes effect on caerDeviceDataStart() calls!
+ */
+#define CAER_HOST_CONFIG_USB_REPLAY_FD         4
 
 /**
  * Parameter address for module CAER_HOST_CONFIG_DATAEXCHANGE:
@@ -88,6 +154,31 @@ typedef struct caer_device_handle *caerDeviceHandle;
  * need precise control over which ones are running at any time.
  */
  #define CAER_HOST_CONFIG_DATAEXCHANGE_STOP_PRODUCERS  3
+/**
+ * Parameter address for module CAER_HOST_CONFIG_DATAEXCHANGE:
+ * fill level of the FIFO buffer, in percent of its size (see
+ * CAER_HOST_CONFIG_DATAEXCHANGE_BUFFER_SIZE), at which the
+ * watermark notification is called with 'high' set, so that
+ * consumers can react before packets start being dropped.
+ * One slot of the buffer is kept free for timestamp resets, so
+ * levels above what regular data can fill are reached when the
+ * buffer is as full as it can get. Must be above the low watermark,
+ * else it's rejected. Zero disables watermark notifications, and is
+ * the default. See caerDeviceDataWatermarkNotifySet().
+ */
+#define CAER_HOST_CONFIG_DATAEXCHANGE_HIGH_WATERMARK  4
+/**
+ * Parameter address for module CAER_HOST_CONFIG_DATAEXCHANGE:
+ * fill level of the FIFO buffer, in percent of its size, at which
+ * the watermark notification is called with 'high' cleared, after
+ * the high watermark was reached. The gap between the two levels
+ * avoids a flood of notifications when the fill level hovers around
+ * one of them. Must be below the high watermark, if that is set,
+ * else it's rejected: lower this one first when lowering both.
+ * On small buffers, it's kept at least one slot below the high
+ * level. The default is 25.
+ */
+#define CAER_HOST_CONFIG_DATAEXCHANGE_LOW_WATERMARK   5
 
 /**
  * Parameter address for module CAER_HOST_CONFIG_PACKETS:
@@ -104,6 +195,213 @@ typedef struct caer_device_handle *caerDeviceHandle;
  * types of events contained in the EventPacketContainer.
  */
 #define CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_INTERVAL    1
+/**
+ * Parameter address for module CAER_HOST_CONFIG_PACKETS:
+ * set the maximum host-side latency of events, in microseconds.
+ * Events waiting in not yet committed packets are committed at
+ * the latest this long after the USB transfer that carried the
+ * first of them completed, even if no further data arrives, which
+ * bounds latency in sparse scenes at the cost of smaller packets.
+ * Zero, the default, disables this: commits then only depend on
+ * the device timestamps and packet sizes of incoming data.
+ * Only supported by DAVIS devices.
+ */
+#define CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_LATENCY     2
+
+/**
+ * Parameter address for module CAER_HOST_CONFIG_THREAD:
+ * restrict the USB data acquisition thread to a set of CPUs,
+ * given as a bit-mask (bit N set means CPU N is allowed, for
+ * CPUs 0 to 31). Zero, the default, leaves it unrestricted.
+ * Only supported on Linux.
+ * Only takes effect on DataStart() calls!
+ */
+#define CAER_HOST_CONFIG_THREAD_CPU_AFFINITY   0
+/**
+ * Parameter address for module CAER_HOST_CONFIG_THREAD:
+ * scheduling policy of the USB data acquisition thread, one of
+ * CAER_HOST_CONFIG_THREAD_SCHED_DEFAULT (default), _FIFO or _RR.
+ * Real-time policies usually require privileges (CAP_SYS_NICE
+ * or a suitable RLIMIT_RTPRIO); failures are logged and the
+ * thread keeps running with default scheduling.
+ * Only takes effect on DataStart() calls!
+ */
+#define CAER_HOST_CONFIG_THREAD_SCHED_POLICY   1
+/**
+ * Parameter address for module CAER_HOST_CONFIG_THREAD:
+ * real-time priority of the USB data acquisition thread, used
+ * with the FIFO and RR scheduling policies (1 to 99 on Linux).
+ * Only takes effect on DataStart() calls!
+ */
+#define CAER_HOST_CONFIG_THREAD_SCHED_PRIORITY 2
+/**
+ * Parameter address for module CAER_HOST_CONFIG_THREAD:
+ * lock all current and future memory of the process into RAM
+ * (mlockall()), to avoid page faults in the USB data acquisition
+ * thread. This affects the whole process and is not undone when
+ * data acquisition stops.
+ * Only takes effect on DataStart() calls!
+ */
+#define CAER_HOST_CONFIG_THREAD_MEMORY_LOCK    3
+
+/**
+ * Scheduling policy for CAER_HOST_CONFIG_THREAD_SCHED_POLICY:
+ * default, non real-time scheduling.
+ */
+#define CAER_HOST_CONFIG_THREAD_SCHED_DEFAULT 0
+/**
+ * Scheduling policy for CAER_HOST_CONFIG_THREAD_SCHED_POLICY:
+ * real-time, first-in first-out (SCHED_FIFO).
+ */
+#define CAER_HOST_CONFIG_THREAD_SCHED_FIFO    1
+/**
+ * Scheduling policy for CAER_HOST_CONFIG_THREAD_SCHED_POLICY:
+ * real-time, round-robin (SCHED_RR).
+ */
+#define CAER_HOST_CONFIG_THREAD_SCHED_RR      2
+
+/**
+ * Maximum number of data delivery queues per device, including
+ * the main queue 0 served by caerDeviceDataGet().
+ */
+#define CAER_HOST_CONFIG_QUEUES_NUMBER 4
+
+/**
+ * Parameter address for module CAER_HOST_CONFIG_QUEUES:
+ * assign the event packet at a given container position to a
+ * data delivery queue. The parameter address is this value plus
+ * the packet position (see the device's *_EVENT defines), the
+ * value is the queue index, below CAER_HOST_CONFIG_QUEUES_NUMBER.
+ * Packets assigned to a queue other than 0 are committed in their
+ * own containers, following that queue's own time interval, and
+ * are retrieved with caerDeviceDataGetQueue(). This way slow, bulky
+ * data (frames) doesn't delay low-latency data (polarity events).
+ * All packets are in queue 0 by default.
+ * Only supported by DAVIS devices.
+ * Only takes effect on DataStart() calls!
+ */
+#define CAER_HOST_CONFIG_QUEUES_PACKET_QUEUE 0
+/**
+ * Parameter address for module CAER_HOST_CONFIG_QUEUES:
+ * set the time interval between subsequent packet containers of
+ * a secondary queue, in microseconds. The parameter address is this
+ * value plus the queue index (1 to CAER_HOST_CONFIG_QUEUES_NUMBER - 1).
+ * Zero, the default, uses CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_INTERVAL.
+ * The size limit CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_PACKET_SIZE
+ * is shared with queue 0. Queue 0 itself always uses the
+ * CAER_HOST_CONFIG_PACKETS settings.
+ * Only takes effect on DataStart() calls!
+ */
+#define CAER_HOST_CONFIG_QUEUES_INTERVAL     16
+
+/**
+ * Parameter address for module CAER_HOST_CONFIG_SHEDDING:
+ * set the fill level of the data exchange buffer, in percent of its
+ * size (see CAER_HOST_CONFIG_DATAEXCHANGE_BUFFER_SIZE), at or above
+ * which the event packet at a given container position is dropped
+ * from packet containers, before they are put into the buffer. The
+ * parameter address is this value plus the packet position (see the
+ * device's *_EVENT defines). The rest of the container is delivered
+ * as usual, containers left empty are dropped. This way, when the
+ * consumers fall behind, bulky and less important data goes first,
+ * before whole containers are lost to a full buffer: for example,
+ * frames at 50, microphone samples at 70 and polarity events at 90,
+ * keeping IMU events at 0. One slot of the buffer is kept free for
+ * timestamp resets, so levels above what regular data can fill apply
+ * when the buffer is as full as it can get: 100 drops the packet only
+ * then. Zero, the default for all packets, never drops them. Special events (position 0) carry timestamp information
+ * and can't be dropped. With CAER_HOST_CONFIG_QUEUES, each queue's
+ * packets are shed based on that queue's buffer.
+ * Dynap-se spike packets split per chip or core (DYNAPSE_CONFIG_HOST_SPIKES_SPLIT)
+ * each have their own position, and so their own level.
+ * Not supported by the Playback device, which never drops containers.
+ */
+#define CAER_HOST_CONFIG_SHEDDING_PACKET_LEVEL 0
+
+/**
+ * Profiling stage: USB transfer completion callback, including
+ * event translation and transfer re-submission.
+ */
+#define CAER_DEVICE_PROFILING_USB_CALLBACK      0
+/**
+ * Profiling stage: event translation of USB data into packets,
+ * including the following stages where applicable.
+ */
+#define CAER_DEVICE_PROFILING_TRANSLATOR        1
+/**
+ * Profiling stage: event packet allocation and growth during translation.
+ */
+#define CAER_DEVICE_PROFILING_PACKET_ALLOCATION 2
+/**
+ * Profiling stage: packet container commit and ring-buffer put.
+ */
+#define CAER_DEVICE_PROFILING_COMMIT            3
+/**
+ * Profiling stage: automatic exposure calculation (DAVIS only).
+ */
+#define CAER_DEVICE_PROFILING_AUTO_EXPOSURE     4
+/**
+ * Profiling stage: log message formatting and output. This is
+ * process-wide, counting all calls from all threads and devices.
+ */
+#define CAER_DEVICE_PROFILING_LOGGING           5
+/**
+ * Number of profiling stages.
+ */
+#define CAER_DEVICE_PROFILING_STAGES            6
+
+/**
+ * Time accounting of one data acquisition stage, see caerDeviceProfilingGet().
+ */
+struct caer_device_profiling_stage {
+	/// Number of times the stage was run.
+	uint64_t calls;
+	/// Total time spent in the stage, in nanoseconds.
+	uint64_t nanoseconds;
+};
+
+/**
+ * Memory usage type: current, not yet committed event packets
+ * being filled by the data acquisition thread.
+ */
+#define CAER_DEVICE_MEMORY_PACKETS       0
+/**
+ * Memory usage type: committed packet containers waiting in the
+ * data exchange buffers for caerDeviceDataGet() (all queues).
+ * This grows when the consumer falls behind.
+ */
+#define CAER_DEVICE_MEMORY_DATA_EXCHANGE 1
+/**
+ * Memory usage type: USB transfer buffers.
+ */
+#define CAER_DEVICE_MEMORY_USB_TRANSFERS 2
+/**
+ * Memory usage type: frame assembly buffers, for APS reset
+ * values and ROI frames being read out (DAVIS only).
+ */
+#define CAER_DEVICE_MEMORY_FRAME_BUFFERS 3
+/**
+ * Memory usage type: packet containers handed over to the caller
+ * by caerDeviceDataGet() (all queues). This memory is owned by the
+ * caller, so libcaer can't know when it is freed: current and peak
+ * are both the running total of bytes delivered. Comparing this with
+ * the bytes the caller freed shows containers that are never freed.
+ */
+#define CAER_DEVICE_MEMORY_DELIVERED     4
+/**
+ * Number of memory usage types.
+ */
+#define CAER_DEVICE_MEMORY_TYPES         5
+
+/**
+ * Memory usage of one type, in bytes, see caerDeviceMemoryUsageGet().
+ */
+struct caer_device_memory_usage {
+	/// Bytes currently held.
+	uint64_t current;
+	/// Highest number of bytes held at any time since the device was opened.
+	uint64_t peak;
+};
 
 /**
  * Open a specified USB device, assign an ID to it and return a handle for further usage.
@@ -227,6 +525,10 @@ bool caerDeviceDataStop(caerDeviceHandle handle);
  * container memory. For single caerEventPackets, just use free().
  * This function can be made blocking with the CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING
  * configuration parameter. By default it is non-blocking.
+ * Several threads can call this concurrently on the same device, to spread
+ * the processing of containers over them: each container is returned to
+ * exactly one caller, but containers processed in parallel may complete
+ * out of order.
  *
  * @param handle a valid device handle.
  *
@@ -235,6 +537,120 @@ bool caerDeviceDataStop(caerDeviceHandle handle);
  */
 caerEventPacketContainer caerDeviceDataGet(caerDeviceHandle handle);
 
+/**
+ * Get up to maxContainers event packet containers at once, see caerDeviceDataGet().
+ * The containers are claimed together, in the order they were produced, so a thread
+ * handling a batch sees consecutive data, and concurrent callers pay for one claim
+ * per batch instead of one per container. Each returned container needs to be freed,
+ * as with caerDeviceDataGet(). In blocking mode this waits until at least one
+ * container is available, but never for the batch to fill up.
+ *
+ * @param handle a valid device handle.
+ * @param containers array to store the containers into, with space for at least maxContainers.
+ * @param maxContainers maximum number of containers to get.
+ *
+ * @return the number of containers stored into the array. Zero will be returned on errors,
+ *         or when there is no container available in non-blocking mode.
+ */
+size_t caerDeviceDataGetBatch(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t maxContainers);
+
+/**
+ * Set a function to be notified when the FIFO buffer between the USB data
+ * transfer thread and the consumers fills up to the high watermark, and again
+ * when it drains back down to the low watermark, see
+ * CAER_HOST_CONFIG_DATAEXCHANGE_HIGH_WATERMARK and
+ * CAER_HOST_CONFIG_DATAEXCHANGE_LOW_WATERMARK. Calls always alternate between
+ * high and low, starting with high, and are never made concurrently. A crossing
+ * undone before its call is made is skipped, together with its reverse. Only
+ * the main queue is watched, not the secondary ones of caerDeviceDataGetQueue().
+ * The function is called from whichever thread moved the fill level across a
+ * watermark, either the USB data transfer thread or one calling caerDeviceDataGet(),
+ * or from one still making an earlier call, so it should return quickly.
+ * Can only be changed while data transfer is stopped.
+ *
+ * @param handle a valid device handle.
+ * @param dataWatermarkNotify function pointer, called on watermark crossings, with
+ *                            high set when the high watermark was reached, and
+ *                            cleared when the low one was. NULL to disable.
+ * @param dataWatermarkUserPtr pointer that will be passed to the dataWatermarkNotify
+ *                             function. Can be NULL.
+ *
+ * @return true if the notification was set, false on errors or while data transfer is running.
+ */
+bool caerDeviceDataWatermarkNotifySet(caerDeviceHandle handle, void (*dataWatermarkNotify)(void *ptr, bool high),
+	void *dataWatermarkUserPtr);
+
+/**
+ * Get an event packet container from a specific data delivery queue,
+ * see CAER_HOST_CONFIG_QUEUES. Queue 0 is the same as caerDeviceDataGet().
+ * Containers from secondary queues only hold the packets assigned to them,
+ * at their usual positions, and timestamp resets are signaled on every
+ * active queue. Blocking behavior follows CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING.
+ * The notification callbacks given to caerDeviceDataStart() count the
+ * containers of all queues together.
+ *
+ * @param handle a valid device handle.
+ * @param queue index of the data delivery queue, below CAER_HOST_CONFIG_QUEUES_NUMBER.
+ *
+ * @return a valid event packet container. NULL will be returned on errors, when the
+ *         queue is unused or unsupported, or when there is no container available
+ *         in non-blocking mode. Always check for this!
+ */
+caerEventPacketContainer caerDeviceDataGetQueue(caerDeviceHandle handle, uint8_t queue);
+
+/**
+ * Convert a device timestamp to host time.
+ * While data acquisition is running, every USB transfer completion time is paired
+ * with the latest device timestamp it carried, and a linear model of offset and
+ * drift between the two clocks is fitted online, rejecting late outliers.
+ * The resulting host times thus include the typical USB delivery latency.
+ * The model is reset on data start and on timestamp resets, and needs a few tens
+ * of milliseconds of data before it becomes available.
+ * This is cheap and thread-safe, it can be called at any time from any thread.
+ * Packet containers carry the host time of their highest timestamp already,
+ * see caerEventPacketContainerGetHostTimestamp().
+ *
+ * @param handle a valid device handle.
+ * @param deviceTimestamp a full 64bit device timestamp, in µs, from after the
+ *                        last timestamp reset.
+ *
+ * @return the corresponding host time (CLOCK_MONOTONIC, in µs), or -1 if no
+ *         estimate is available yet or on invalid arguments.
+ */
+int64_t caerDeviceTimestampToHost(caerDeviceHandle handle, int64_t deviceTimestamp);
+
+/**
+ * Get the time accounting of the data acquisition stages (CAER_DEVICE_PROFILING_*),
+ * cumulative since the device was opened. Only available if libcaer was built
+ * with profiling support (LIBCAER_HAVE_PROFILING, CMake option ENABLE_PROFILING),
+ * as it adds two clock reads per stage run to the data acquisition path.
+ * Stages nest: the USB callback includes translation, which in turn includes
+ * packet allocation, commit and auto-exposure. Stages that are cut short by
+ * errors are not counted. This can be called at any time from any thread;
+ * each counter is consistent by itself, but calls and time may be slightly
+ * out of step with each other.
+ *
+ * @param handle a valid device handle.
+ * @param stages array of CAER_DEVICE_PROFILING_STAGES entries to fill.
+ *
+ * @return true on success, false on invalid arguments or if profiling
+ *         support is not available.
+ */
+bool caerDeviceProfilingGet(caerDeviceHandle handle, struct caer_device_profiling_stage *stages);
+
+/**
+ * Get the memory held by libcaer for this device, by type (CAER_DEVICE_MEMORY_*).
+ * Event packets and containers are counted with their full allocated capacity.
+ * Current packet sizes are updated after each USB transfer is processed.
+ * This can be called at any time from any thread.
+ *
+ * @param handle a valid device handle.
+ * @param usages array of CAER_DEVICE_MEMORY_TYPES entries to fill.
+ *
+ * @return true on success, false on invalid arguments.
+ */
+bool caerDeviceMemoryUsageGet(caerDeviceHandle handle, struct caer_device_memory_usage *usages);
+
 #ifdef __cplusplus
 }
 #endif
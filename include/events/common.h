@@ -13,10 +13,30 @@
 
 #include "../libcaer.h"
 
+#if defined(LIBCAER_UNCHECKED_ACCESS)
+	#include <assert.h>
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * Check done by the event accessors, such as the caerXXXEventPacketGetEvent()
+ * bounds checks and the caerXXXEventValidate()/Invalidate() validity checks,
+ * which log an error and do nothing when it fails.
+ * Define LIBCAER_UNCHECKED_ACCESS before including any libcaer header to turn
+ * these checks into assertions instead: they then only exist in debug builds
+ * (NDEBUG not defined), and release builds lose both the branches and the
+ * logging code. Failing a check is then undefined behavior, as it always
+ * is for the caerXXXEventPacketGetEventUnchecked() accessors.
+ */
+#if defined(LIBCAER_UNCHECKED_ACCESS)
+	#define CAER_ACCESS_CHECK(COND) (assert(COND), true)
+#else
+	#define CAER_ACCESS_CHECK(COND) (COND)
+#endif
+
 /**
  * Generic validity mark:
  * this bit is used to mark whether an event is still
@@ -65,6 +85,7 @@ enum caer_default_event_types {
 	POINT3D_EVENT = 10, //!< 3D measurement events.
 	POINT4D_EVENT = 11, //!< 4D measurement events.
 	SPIKE_EVENT = 12,   //!< Spike events.
+	PCM_EVENT = 13,     //!< PCM (audio) events.
 };
 
 /**
@@ -72,7 +93,7 @@ enum caer_default_event_types {
  * Corresponds to the count of definitions inside the
  * 'enum caer_default_event_types' enumeration.
  */
-#define CAER_DEFAULT_EVENT_TYPES_COUNT 13
+#define CAER_DEFAULT_EVENT_TYPES_COUNT 14
 
 /**
  * Size of the EventPacket header.
@@ -395,7 +416,7 @@ static inline const void *caerGenericEventGetEvent(caerEventPacketHeaderConst he
 	// make any sense here for the Generic Event getter, as we only support
 	// reading/querying data from those events, and that would always fail for
 	// those empty events, as they are all zeroed out.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventNumber(headerPtr)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventNumber(headerPtr))) {
 		caerLog(CAER_LOG_CRITICAL, "Generic Event",
 			"Called caerGenericEventGetEvent() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ". Negative values are not allowed!",
 			n, caerEventPacketHeaderGetEventNumber(headerPtr) - 1);
@@ -104,7 +104,7 @@ caerConfigurationEventPacket caerConfigurationEventPacketAllocate(int32_t eventC
 static inline caerConfigurationEvent caerConfigurationEventPacketGetEvent(caerConfigurationEventPacket packet,
 	int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Configuration Event",
 			"Called caerConfigurationEventPacketGetEvent() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -127,7 +127,7 @@ static inline caerConfigurationEvent caerConfigurationEventPacketGetEvent(caerCo
 static inline caerConfigurationEventConst caerConfigurationEventPacketGetEventConst(caerConfigurationEventPacketConst packet,
 	int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Configuration Event",
 			"Called caerConfigurationEventPacketGetEventConst() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -138,6 +138,37 @@ static inline caerConfigurationEventConst caerConfigurationEventPacketGetEventCo
 	return (packet->events + n);
 }
 
+/**
+ * Get the configuration event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ *
+ * @param packet a valid ConfigurationEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested configuration event.
+ */
+static inline caerConfigurationEvent caerConfigurationEventPacketGetEventUnchecked(caerConfigurationEventPacket packet,
+	int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
+/**
+ * Get the configuration event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ * This is a read-only event, do not change its contents in any way!
+ *
+ * @param packet a valid ConfigurationEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested read-only configuration event.
+ */
+static inline caerConfigurationEventConst caerConfigurationEventPacketGetEventConstUnchecked(caerConfigurationEventPacketConst packet,
+	int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
 /**
  * Get the 32bit event timestamp, in microseconds.
  * Be aware that this wraps around! You can either ignore this fact,
@@ -209,7 +240,7 @@ static inline bool caerConfigurationEventIsValid(caerConfigurationEventConst eve
  * @param packet the ConfigurationEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerConfigurationEventValidate(caerConfigurationEvent event, caerConfigurationEventPacket packet) {
-	if (!caerConfigurationEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(!caerConfigurationEventIsValid(event))) {
 		SET_NUMBITS8(event->moduleAddress, VALID_MARK_SHIFT, VALID_MARK_MASK, 1);
 
 		// Also increase number of events and valid events.
@@ -235,7 +266,7 @@ static inline void caerConfigurationEventValidate(caerConfigurationEvent event,
  * @param packet the ConfigurationEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerConfigurationEventInvalidate(caerConfigurationEvent event, caerConfigurationEventPacket packet) {
-	if (caerConfigurationEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(caerConfigurationEventIsValid(event))) {
 		CLEAR_NUMBITS8(event->moduleAddress, VALID_MARK_SHIFT, VALID_MARK_MASK);
 
 		// Also decrease number of valid events. Number of total events doesn't change.
@@ -325,7 +356,7 @@ static inline void caerConfigurationEventSetParameter(caerConfigurationEvent eve
 	for (int32_t caerConfigurationIteratorCounter = 0; \
 		caerConfigurationIteratorCounter < caerEventPacketHeaderGetEventNumber(&(CONFIGURATION_PACKET)->packetHeader); \
 		caerConfigurationIteratorCounter++) { \
-		caerConfigurationEvent caerConfigurationIteratorElement = caerConfigurationEventPacketGetEvent(CONFIGURATION_PACKET, caerConfigurationIteratorCounter);
+		caerConfigurationEvent caerConfigurationIteratorElement = caerConfigurationEventPacketGetEventUnchecked(CONFIGURATION_PACKET, caerConfigurationIteratorCounter);
 
 /**
  * Const-Iterator over all configuration events in a packet.
@@ -339,7 +370,7 @@ static inline void caerConfigurationEventSetParameter(caerConfigurationEvent eve
 	for (int32_t caerConfigurationIteratorCounter = 0; \
 		caerConfigurationIteratorCounter < caerEventPacketHeaderGetEventNumber(&(CONFIGURATION_PACKET)->packetHeader); \
 		caerConfigurationIteratorCounter++) { \
-		caerConfigurationEventConst caerConfigurationIteratorElement = caerConfigurationEventPacketGetEventConst(CONFIGURATION_PACKET, caerConfigurationIteratorCounter);
+		caerConfigurationEventConst caerConfigurationIteratorElement = caerConfigurationEventPacketGetEventConstUnchecked(CONFIGURATION_PACKET, caerConfigurationIteratorCounter);
 
 /**
  * Iterator close statement.
@@ -358,7 +389,7 @@ static inline void caerConfigurationEventSetParameter(caerConfigurationEvent eve
 	for (int32_t caerConfigurationIteratorCounter = 0; \
 		caerConfigurationIteratorCounter < caerEventPacketHeaderGetEventNumber(&(CONFIGURATION_PACKET)->packetHeader); \
 		caerConfigurationIteratorCounter++) { \
-		caerConfigurationEvent caerConfigurationIteratorElement = caerConfigurationEventPacketGetEvent(CONFIGURATION_PACKET, caerConfigurationIteratorCounter); \
+		caerConfigurationEvent caerConfigurationIteratorElement = caerConfigurationEventPacketGetEventUnchecked(CONFIGURATION_PACKET, caerConfigurationIteratorCounter); \
 		if (!caerConfigurationEventIsValid(caerConfigurationIteratorElement)) { continue; } // Skip invalid configuration events.
 
 /**
@@ -373,7 +404,7 @@ static inline void caerConfigurationEventSetParameter(caerConfigurationEvent eve
 	for (int32_t caerConfigurationIteratorCounter = 0; \
 		caerConfigurationIteratorCounter < caerEventPacketHeaderGetEventNumber(&(CONFIGURATION_PACKET)->packetHeader); \
 		caerConfigurationIteratorCounter++) { \
-		caerConfigurationEventConst caerConfigurationIteratorElement = caerConfigurationEventPacketGetEventConst(CONFIGURATION_PACKET, caerConfigurationIteratorCounter); \
+		caerConfigurationEventConst caerConfigurationIteratorElement = caerConfigurationEventPacketGetEventConstUnchecked(CONFIGURATION_PACKET, caerConfigurationIteratorCounter); \
 		if (!caerConfigurationEventIsValid(caerConfigurationIteratorElement)) { continue; } // Skip invalid configuration events.
 
 /**
@@ -393,7 +424,7 @@ static inline void caerConfigurationEventSetParameter(caerConfigurationEvent eve
 	for (int32_t caerConfigurationIteratorCounter = caerEventPacketHeaderGetEventNumber(&(CONFIGURATION_PACKET)->packetHeader) - 1; \
 		caerConfigurationIteratorCounter >= 0; \
 		caerConfigurationIteratorCounter--) { \
-		caerConfigurationEvent caerConfigurationIteratorElement = caerConfigurationEventPacketGetEvent(CONFIGURATION_PACKET, caerConfigurationIteratorCounter);
+		caerConfigurationEvent caerConfigurationIteratorElement = caerConfigurationEventPacketGetEventUnchecked(CONFIGURATION_PACKET, caerConfigurationIteratorCounter);
 /**
  * Const-Reverse iterator over all configuration events in a packet.
  * Returns the current index in the 'caerConfigurationIteratorCounter' variable of type
@@ -406,7 +437,7 @@ static inline void caerConfigurationEventSetParameter(caerConfigurationEvent eve
 	for (int32_t caerConfigurationIteratorCounter = caerEventPacketHeaderGetEventNumber(&(CONFIGURATION_PACKET)->packetHeader) - 1; \
 		caerConfigurationIteratorCounter >= 0; \
 		caerConfigurationIteratorCounter--) { \
-		caerConfigurationEventConst caerConfigurationIteratorElement = caerConfigurationEventPacketGetEventConst(CONFIGURATION_PACKET, caerConfigurationIteratorCounter);
+		caerConfigurationEventConst caerConfigurationIteratorElement = caerConfigurationEventPacketGetEventConstUnchecked(CONFIGURATION_PACKET, caerConfigurationIteratorCounter);
 
 /**
  * Reverse iterator close statement.
@@ -425,7 +456,7 @@ static inline void caerConfigurationEventSetParameter(caerConfigurationEvent eve
 	for (int32_t caerConfigurationIteratorCounter = caerEventPacketHeaderGetEventNumber(&(CONFIGURATION_PACKET)->packetHeader) - 1; \
 		caerConfigurationIteratorCounter >= 0; \
 		caerConfigurationIteratorCounter--) { \
-		caerConfigurationEvent caerConfigurationIteratorElement = caerConfigurationEventPacketGetEvent(CONFIGURATION_PACKET, caerConfigurationIteratorCounter); \
+		caerConfigurationEvent caerConfigurationIteratorElement = caerConfigurationEventPacketGetEventUnchecked(CONFIGURATION_PACKET, caerConfigurationIteratorCounter); \
 		if (!caerConfigurationEventIsValid(caerConfigurationIteratorElement)) { continue; } // Skip invalid configuration events.
 
 /**
@@ -440,7 +471,7 @@ static inline void caerConfigurationEventSetParameter(caerConfigurationEvent eve
 	for (int32_t caerConfigurationIteratorCounter = caerEventPacketHeaderGetEventNumber(&(CONFIGURATION_PACKET)->packetHeader) - 1; \
 		caerConfigurationIteratorCounter >= 0; \
 		caerConfigurationIteratorCounter--) { \
-		caerConfigurationEventConst caerConfigurationIteratorElement = caerConfigurationEventPacketGetEventConst(CONFIGURATION_PACKET, caerConfigurationIteratorCounter); \
+		caerConfigurationEventConst caerConfigurationIteratorElement = caerConfigurationEventPacketGetEventConstUnchecked(CONFIGURATION_PACKET, caerConfigurationIteratorCounter); \
 		if (!caerConfigurationEventIsValid(caerConfigurationIteratorElement)) { continue; } // Skip invalid configuration events.
 
 /**
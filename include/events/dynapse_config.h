@@ -85,7 +85,7 @@ caerDynapseconfigPacket caerDynapseconfigPacketAllocate(int32_t eventCapacity, i
  */
 static inline caerDynapseconfig caerDynapseconfigPacketGetEvent(caerDynapseconfigPacket packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Special Event",
 			"Called caerDynapseconfigPacketGetEvent() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -107,7 +107,7 @@ static inline caerDynapseconfig caerDynapseconfigPacketGetEvent(caerDynapseconfi
  */
 static inline caerDynapseconfigConst caerDynapseconfigPacketGetEventConst(caerDynapseconfigPacketConst packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Special Event",
 			"Called caerDynapseconfigPacketGetEventConst() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -118,6 +118,35 @@ static inline caerDynapseconfigConst caerDynapseconfigPacketGetEventConst(caerDy
 	return (packet->events + n);
 }
 
+/**
+ * Get the special event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ *
+ * @param packet a valid DynapseconfigPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested special event.
+ */
+static inline caerDynapseconfig caerDynapseconfigPacketGetEventUnchecked(caerDynapseconfigPacket packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
+/**
+ * Get the special event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ * This is a read-only event, do not change its contents in any way!
+ *
+ * @param packet a valid DynapseconfigPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested read-only special event.
+ */
+static inline caerDynapseconfigConst caerDynapseconfigPacketGetEventConstUnchecked(caerDynapseconfigPacketConst packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
 /**
  * Get the 32bit event timestamp, in microseconds.
  * Be aware that this wraps around! You can either ignore this fact,
@@ -187,7 +216,7 @@ static inline bool caerDynapseconfigIsValid(caerDynapseconfigConst event) {
  * @param packet the DynapseconfigPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerDynapseconfigValidate(caerDynapseconfig event, caerDynapseconfigPacket packet) {
-	if (!caerDynapseconfigIsValid(event)) {
+	if (CAER_ACCESS_CHECK(!caerDynapseconfigIsValid(event))) {
 		SET_NUMBITS32(event->data, VALID_MARK_SHIFT, VALID_MARK_MASK, 1);
 
 		// Also increase number of events and valid events.
@@ -212,7 +241,7 @@ static inline void caerDynapseconfigValidate(caerDynapseconfig event, caerDynaps
  * @param packet the DynapseconfigPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerDynapseconfigInvalidate(caerDynapseconfig event, caerDynapseconfigPacket packet) {
-	if (caerDynapseconfigIsValid(event)) {
+	if (CAER_ACCESS_CHECK(caerDynapseconfigIsValid(event))) {
 		CLEAR_NUMBITS32(event->data, VALID_MARK_SHIFT, VALID_MARK_MASK);
 
 		// Also decrease number of valid events. Number of total events doesn't change.
@@ -272,7 +301,7 @@ static inline void caerDynapseconfigSetChipid(caerDynapseconfig event, uint8_t c
 	for (int32_t caerDynapseconfigIteratorCounter = 0; \
 		caerDynapseconfigIteratorCounter < caerEventPacketHeaderGetEventNumber(&(DYNAPSECONFIG_PACKET)->packetHeader); \
 		caerDynapseconfigIteratorCounter++) { \
-		caerDynapseconfig caerDynapseconfigIteratorElement = caerDynapseconfigPacketGetEvent(DYNAPSECONFIG_PACKET, caerDynapseconfigIteratorCounter);
+		caerDynapseconfig caerDynapseconfigIteratorElement = caerDynapseconfigPacketGetEventUnchecked(DYNAPSECONFIG_PACKET, caerDynapseconfigIteratorCounter);
 
 /**
  * Const-Iterator over all special events in a packet.
@@ -286,7 +315,7 @@ static inline void caerDynapseconfigSetChipid(caerDynapseconfig event, uint8_t c
 	for (int32_t caerDynapseconfigIteratorCounter = 0; \
 		caerDynapseconfigIteratorCounter < caerEventPacketHeaderGetEventNumber(&(DYNAPSECONFIG_PACKET)->packetHeader); \
 		caerDynapseconfigIteratorCounter++) { \
-		caerDynapseconfigConst caerDynapseconfigIteratorElement = caerDynapseconfigPacketGetEventConst(DYNAPSECONFIG_PACKET, caerDynapseconfigIteratorCounter);
+		caerDynapseconfigConst caerDynapseconfigIteratorElement = caerDynapseconfigPacketGetEventConstUnchecked(DYNAPSECONFIG_PACKET, caerDynapseconfigIteratorCounter);
 
 /**
  * Iterator close statement.
@@ -305,7 +334,7 @@ static inline void caerDynapseconfigSetChipid(caerDynapseconfig event, uint8_t c
 	for (int32_t caerDynapseconfigIteratorCounter = 0; \
 		caerDynapseconfigIteratorCounter < caerEventPacketHeaderGetEventNumber(&(DYNAPSECONFIG_PACKET)->packetHeader); \
 		caerDynapseconfigIteratorCounter++) { \
-		caerDynapseconfig caerDynapseconfigIteratorElement = caerDynapseconfigPacketGetEvent(DYNAPSECONFIG_PACKET, caerDynapseconfigIteratorCounter); \
+		caerDynapseconfig caerDynapseconfigIteratorElement = caerDynapseconfigPacketGetEventUnchecked(DYNAPSECONFIG_PACKET, caerDynapseconfigIteratorCounter); \
 		if (!caerDynapseconfigIsValid(caerDynapseconfigIteratorElement)) { continue; } // Skip invalid special events.
 
 /**
@@ -320,7 +349,7 @@ static inline void caerDynapseconfigSetChipid(caerDynapseconfig event, uint8_t c
 	for (int32_t caerDynapseconfigIteratorCounter = 0; \
 		caerDynapseconfigIteratorCounter < caerEventPacketHeaderGetEventNumber(&(DYNAPSECONFIG_PACKET)->packetHeader); \
 		caerDynapseconfigIteratorCounter++) { \
-		caerDynapseconfigConst caerDynapseconfigIteratorElement = caerDynapseconfigPacketGetEventConst(DYNAPSECONFIG_PACKET, caerDynapseconfigIteratorCounter); \
+		caerDynapseconfigConst caerDynapseconfigIteratorElement = caerDynapseconfigPacketGetEventConstUnchecked(DYNAPSECONFIG_PACKET, caerDynapseconfigIteratorCounter); \
 		if (!caerDynapseconfigIsValid(caerDynapseconfigIteratorElement)) { continue; } // Skip invalid special events.
 
 /**
@@ -340,7 +369,7 @@ static inline void caerDynapseconfigSetChipid(caerDynapseconfig event, uint8_t c
 	for (int32_t caerDynapseconfigIteratorCounter = caerEventPacketHeaderGetEventNumber(&(DYNAPSECONFIG_PACKET)->packetHeader) - 1; \
 		caerDynapseconfigIteratorCounter >= 0; \
 		caerDynapseconfigIteratorCounter--) { \
-		caerDynapseconfig caerDynapseconfigIteratorElement = caerDynapseconfigPacketGetEvent(DYNAPSECONFIG_PACKET, caerDynapseconfigIteratorCounter);
+		caerDynapseconfig caerDynapseconfigIteratorElement = caerDynapseconfigPacketGetEventUnchecked(DYNAPSECONFIG_PACKET, caerDynapseconfigIteratorCounter);
 /**
  * Const-Reverse iterator over all special events in a packet.
  * Returns the current index in the 'caerDynapseconfigIteratorCounter' variable of type
@@ -353,7 +382,7 @@ static inline void caerDynapseconfigSetChipid(caerDynapseconfig event, uint8_t c
 	for (int32_t caerDynapseconfigIteratorCounter = caerEventPacketHeaderGetEventNumber(&(DYNAPSECONFIG_PACKET)->packetHeader) - 1; \
 		caerDynapseconfigIteratorCounter >= 0; \
 		caerDynapseconfigIteratorCounter--) { \
-		caerDynapseconfigConst caerDynapseconfigIteratorElement = caerDynapseconfigPacketGetEventConst(DYNAPSECONFIG_PACKET, caerDynapseconfigIteratorCounter);
+		caerDynapseconfigConst caerDynapseconfigIteratorElement = caerDynapseconfigPacketGetEventConstUnchecked(DYNAPSECONFIG_PACKET, caerDynapseconfigIteratorCounter);
 
 /**
  * Reverse iterator close statement.
@@ -372,7 +401,7 @@ static inline void caerDynapseconfigSetChipid(caerDynapseconfig event, uint8_t c
 	for (int32_t caerDynapseconfigIteratorCounter = caerEventPacketHeaderGetEventNumber(&(DYNAPSECONFIG_PACKET)->packetHeader) - 1; \
 		caerDynapseconfigIteratorCounter >= 0; \
 		caerDynapseconfigIteratorCounter--) { \
-		caerDynapseconfig caerDynapseconfigIteratorElement = caerDynapseconfigPacketGetEvent(DYNAPSECONFIG_PACKET, caerDynapseconfigIteratorCounter); \
+		caerDynapseconfig caerDynapseconfigIteratorElement = caerDynapseconfigPacketGetEventUnchecked(DYNAPSECONFIG_PACKET, caerDynapseconfigIteratorCounter); \
 		if (!caerDynapseconfigIsValid(caerDynapseconfigIteratorElement)) { continue; } // Skip invalid special events.
 
 /**
@@ -387,7 +416,7 @@ static inline void caerDynapseconfigSetChipid(caerDynapseconfig event, uint8_t c
 	for (int32_t caerDynapseconfigIteratorCounter = caerEventPacketHeaderGetEventNumber(&(DYNAPSECONFIG_PACKET)->packetHeader) - 1; \
 		caerDynapseconfigIteratorCounter >= 0; \
 		caerDynapseconfigIteratorCounter--) { \
-		caerDynapseconfigConst caerDynapseconfigIteratorElement = caerDynapseconfigPacketGetEventConst(DYNAPSECONFIG_PACKET, caerDynapseconfigIteratorCounter); \
+		caerDynapseconfigConst caerDynapseconfigIteratorElement = caerDynapseconfigPacketGetEventConstUnchecked(DYNAPSECONFIG_PACKET, caerDynapseconfigIteratorCounter); \
 		if (!caerDynapseconfigIsValid(caerDynapseconfigIteratorElement)) { continue; } // Skip invalid special events.
 
 /**
@@ -98,7 +98,7 @@ caerEarEventPacket caerEarEventPacketAllocate(int32_t eventCapacity, int16_t eve
  */
 static inline caerEarEvent caerEarEventPacketGetEvent(caerEarEventPacket packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Ear Event",
 			"Called caerEarEventPacketGetEvent() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -120,7 +120,7 @@ static inline caerEarEvent caerEarEventPacketGetEvent(caerEarEventPacket packet,
  */
 static inline caerEarEventConst caerEarEventPacketGetEventConst(caerEarEventPacketConst packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Ear Event",
 			"Called caerEarEventPacketGetEventConst() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -131,6 +131,35 @@ static inline caerEarEventConst caerEarEventPacketGetEventConst(caerEarEventPack
 	return (packet->events + n);
 }
 
+/**
+ * Get the ear (cochlea) event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ *
+ * @param packet a valid EarEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested ear (cochlea) event.
+ */
+static inline caerEarEvent caerEarEventPacketGetEventUnchecked(caerEarEventPacket packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
+/**
+ * Get the ear (cochlea) event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ * This is a read-only event, do not change its contents in any way!
+ *
+ * @param packet a valid EarEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested read-only ear (cochlea) event.
+ */
+static inline caerEarEventConst caerEarEventPacketGetEventConstUnchecked(caerEarEventPacketConst packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
 /**
  * Get the 32bit event timestamp, in microseconds.
  * Be aware that this wraps around! You can either ignore this fact,
@@ -200,7 +229,7 @@ static inline bool caerEarEventIsValid(caerEarEventConst event) {
  * @param packet the EarEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerEarEventValidate(caerEarEvent event, caerEarEventPacket packet) {
-	if (!caerEarEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(!caerEarEventIsValid(event))) {
 		SET_NUMBITS32(event->data, VALID_MARK_SHIFT, VALID_MARK_MASK, 1);
 
 		// Also increase number of events and valid events.
@@ -225,7 +254,7 @@ static inline void caerEarEventValidate(caerEarEvent event, caerEarEventPacket p
  * @param packet the EarEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerEarEventInvalidate(caerEarEvent event, caerEarEventPacket packet) {
-	if (caerEarEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(caerEarEventIsValid(event))) {
 		CLEAR_NUMBITS32(event->data, VALID_MARK_SHIFT, VALID_MARK_MASK);
 
 		// Also decrease number of valid events. Number of total events doesn't change.
@@ -326,7 +355,7 @@ static inline void caerEarEventSetFilter(caerEarEvent event, uint8_t filter) {
 	for (int32_t caerEarIteratorCounter = 0; \
 		caerEarIteratorCounter < caerEventPacketHeaderGetEventNumber(&(EAR_PACKET)->packetHeader); \
 		caerEarIteratorCounter++) { \
-		caerEarEvent caerEarIteratorElement = caerEarEventPacketGetEvent(EAR_PACKET, caerEarIteratorCounter);
+		caerEarEvent caerEarIteratorElement = caerEarEventPacketGetEventUnchecked(EAR_PACKET, caerEarIteratorCounter);
 
 /**
  * Const-Iterator over all ear events in a packet.
@@ -340,7 +369,7 @@ static inline void caerEarEventSetFilter(caerEarEvent event, uint8_t filter) {
 	for (int32_t caerEarIteratorCounter = 0; \
 		caerEarIteratorCounter < caerEventPacketHeaderGetEventNumber(&(EAR_PACKET)->packetHeader); \
 		caerEarIteratorCounter++) { \
-		caerEarEventConst caerEarIteratorElement = caerEarEventPacketGetEventConst(EAR_PACKET, caerEarIteratorCounter);
+		caerEarEventConst caerEarIteratorElement = caerEarEventPacketGetEventConstUnchecked(EAR_PACKET, caerEarIteratorCounter);
 
 /**
  * Iterator close statement.
@@ -359,7 +388,7 @@ static inline void caerEarEventSetFilter(caerEarEvent event, uint8_t filter) {
 	for (int32_t caerEarIteratorCounter = 0; \
 		caerEarIteratorCounter < caerEventPacketHeaderGetEventNumber(&(EAR_PACKET)->packetHeader); \
 		caerEarIteratorCounter++) { \
-		caerEarEvent caerEarIteratorElement = caerEarEventPacketGetEvent(EAR_PACKET, caerEarIteratorCounter); \
+		caerEarEvent caerEarIteratorElement = caerEarEventPacketGetEventUnchecked(EAR_PACKET, caerEarIteratorCounter); \
 		if (!caerEarEventIsValid(caerEarIteratorElement)) { continue; } // Skip invalid ear events.
 
 /**
@@ -374,7 +403,7 @@ static inline void caerEarEventSetFilter(caerEarEvent event, uint8_t filter) {
 	for (int32_t caerEarIteratorCounter = 0; \
 		caerEarIteratorCounter < caerEventPacketHeaderGetEventNumber(&(EAR_PACKET)->packetHeader); \
 		caerEarIteratorCounter++) { \
-		caerEarEventConst caerEarIteratorElement = caerEarEventPacketGetEventConst(EAR_PACKET, caerEarIteratorCounter); \
+		caerEarEventConst caerEarIteratorElement = caerEarEventPacketGetEventConstUnchecked(EAR_PACKET, caerEarIteratorCounter); \
 		if (!caerEarEventIsValid(caerEarIteratorElement)) { continue; } // Skip invalid ear events.
 
 /**
@@ -394,7 +423,7 @@ static inline void caerEarEventSetFilter(caerEarEvent event, uint8_t filter) {
 	for (int32_t caerEarIteratorCounter = caerEventPacketHeaderGetEventNumber(&(EAR_PACKET)->packetHeader) - 1; \
 		caerEarIteratorCounter >= 0; \
 		caerEarIteratorCounter--) { \
-		caerEarEvent caerEarIteratorElement = caerEarEventPacketGetEvent(EAR_PACKET, caerEarIteratorCounter);
+		caerEarEvent caerEarIteratorElement = caerEarEventPacketGetEventUnchecked(EAR_PACKET, caerEarIteratorCounter);
 /**
  * Const-Reverse iterator over all ear events in a packet.
  * Returns the current index in the 'caerEarIteratorCounter' variable of type
@@ -407,7 +436,7 @@ static inline void caerEarEventSetFilter(caerEarEvent event, uint8_t filter) {
 	for (int32_t caerEarIteratorCounter = caerEventPacketHeaderGetEventNumber(&(EAR_PACKET)->packetHeader) - 1; \
 		caerEarIteratorCounter >= 0; \
 		caerEarIteratorCounter--) { \
-		caerEarEventConst caerEarIteratorElement = caerEarEventPacketGetEventConst(EAR_PACKET, caerEarIteratorCounter);
+		caerEarEventConst caerEarIteratorElement = caerEarEventPacketGetEventConstUnchecked(EAR_PACKET, caerEarIteratorCounter);
 
 /**
  * Reverse iterator close statement.
@@ -426,7 +455,7 @@ static inline void caerEarEventSetFilter(caerEarEvent event, uint8_t filter) {
 	for (int32_t caerEarIteratorCounter = caerEventPacketHeaderGetEventNumber(&(EAR_PACKET)->packetHeader) - 1; \
 		caerEarIteratorCounter >= 0; \
 		caerEarIteratorCounter--) { \
-		caerEarEvent caerEarIteratorElement = caerEarEventPacketGetEvent(EAR_PACKET, caerEarIteratorCounter); \
+		caerEarEvent caerEarIteratorElement = caerEarEventPacketGetEventUnchecked(EAR_PACKET, caerEarIteratorCounter); \
 		if (!caerEarEventIsValid(caerEarIteratorElement)) { continue; } // Skip invalid ear events.
 
 /**
@@ -441,7 +470,7 @@ static inline void caerEarEventSetFilter(caerEarEvent event, uint8_t filter) {
 	for (int32_t caerEarIteratorCounter = caerEventPacketHeaderGetEventNumber(&(EAR_PACKET)->packetHeader) - 1; \
 		caerEarIteratorCounter >= 0; \
 		caerEarIteratorCounter--) { \
-		caerEarEventConst caerEarIteratorElement = caerEarEventPacketGetEventConst(EAR_PACKET, caerEarIteratorCounter); \
+		caerEarEventConst caerEarIteratorElement = caerEarEventPacketGetEventConstUnchecked(EAR_PACKET, caerEarIteratorCounter); \
 		if (!caerEarEventIsValid(caerEarIteratorElement)) { continue; } // Skip invalid ear events.
 
 /**
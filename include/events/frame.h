@@ -165,7 +165,7 @@ caerFrameEventPacket caerFrameEventPacketAllocate(int32_t eventCapacity, int16_t
  */
 static inline caerFrameEvent caerFrameEventPacketGetEvent(caerFrameEventPacket packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Frame Event",
 			"Called caerFrameEventPacketGetEvent() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -188,7 +188,7 @@ static inline caerFrameEvent caerFrameEventPacketGetEvent(caerFrameEventPacket p
  */
 static inline caerFrameEventConst caerFrameEventPacketGetEventConst(caerFrameEventPacketConst packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Frame Event",
 			"Called caerFrameEventPacketGetEventConst() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -200,6 +200,37 @@ static inline caerFrameEventConst caerFrameEventPacketGetEventConst(caerFrameEve
 		+ (CAER_EVENT_PACKET_HEADER_SIZE + U64T(n * caerEventPacketHeaderGetEventSize(&packet->packetHeader)))));
 }
 
+/**
+ * Get the frame event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ *
+ * @param packet a valid FrameEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested frame event.
+ */
+static inline caerFrameEvent caerFrameEventPacketGetEventUnchecked(caerFrameEventPacket packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return ((caerFrameEvent) (((uint8_t *) &packet->packetHeader)
+		+ (CAER_EVENT_PACKET_HEADER_SIZE + U64T(n * caerEventPacketHeaderGetEventSize(&packet->packetHeader)))));
+}
+
+/**
+ * Get the frame event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ * This is a read-only event, do not change its contents in any way!
+ *
+ * @param packet a valid FrameEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested read-only frame event.
+ */
+static inline caerFrameEventConst caerFrameEventPacketGetEventConstUnchecked(caerFrameEventPacketConst packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return ((caerFrameEventConst) (((const uint8_t *) &packet->packetHeader)
+		+ (CAER_EVENT_PACKET_HEADER_SIZE + U64T(n * caerEventPacketHeaderGetEventSize(&packet->packetHeader)))));
+}
+
 /**
  * Get the 32bit start of frame capture timestamp, in microseconds.
  * Be aware that this wraps around! You can either ignore this fact,
@@ -463,7 +494,7 @@ static inline bool caerFrameEventIsValid(caerFrameEventConst event) {
  * @param packet the FrameEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerFrameEventValidate(caerFrameEvent event, caerFrameEventPacket packet) {
-	if (!caerFrameEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(!caerFrameEventIsValid(event))) {
 		SET_NUMBITS32(event->info, VALID_MARK_SHIFT, VALID_MARK_MASK, 1);
 
 		// Also increase number of events and valid events.
@@ -488,7 +519,7 @@ static inline void caerFrameEventValidate(caerFrameEvent event, caerFrameEventPa
  * @param packet the FrameEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerFrameEventInvalidate(caerFrameEvent event, caerFrameEventPacket packet) {
-	if (caerFrameEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(caerFrameEventIsValid(event))) {
 		CLEAR_NUMBITS32(event->info, VALID_MARK_SHIFT, VALID_MARK_MASK);
 
 		// Also decrease number of valid events. Number of total events doesn't change.
@@ -999,7 +1030,7 @@ static inline const uint16_t *caerFrameEventGetPixelArrayUnsafeConst(caerFrameEv
 	for (int32_t caerFrameIteratorCounter = 0; \
 		caerFrameIteratorCounter < caerEventPacketHeaderGetEventNumber(&(FRAME_PACKET)->packetHeader); \
 		caerFrameIteratorCounter++) { \
-		caerFrameEvent caerFrameIteratorElement = caerFrameEventPacketGetEvent(FRAME_PACKET, caerFrameIteratorCounter);
+		caerFrameEvent caerFrameIteratorElement = caerFrameEventPacketGetEventUnchecked(FRAME_PACKET, caerFrameIteratorCounter);
 
 /**
  * Const-Iterator over all frame events in a packet.
@@ -1013,7 +1044,7 @@ static inline const uint16_t *caerFrameEventGetPixelArrayUnsafeConst(caerFrameEv
 	for (int32_t caerFrameIteratorCounter = 0; \
 		caerFrameIteratorCounter < caerEventPacketHeaderGetEventNumber(&(FRAME_PACKET)->packetHeader); \
 		caerFrameIteratorCounter++) { \
-		caerFrameEventConst caerFrameIteratorElement = caerFrameEventPacketGetEventConst(FRAME_PACKET, caerFrameIteratorCounter);
+		caerFrameEventConst caerFrameIteratorElement = caerFrameEventPacketGetEventConstUnchecked(FRAME_PACKET, caerFrameIteratorCounter);
 
 /**
  * Iterator close statement.
@@ -1032,7 +1063,7 @@ static inline const uint16_t *caerFrameEventGetPixelArrayUnsafeConst(caerFrameEv
 	for (int32_t caerFrameIteratorCounter = 0; \
 		caerFrameIteratorCounter < caerEventPacketHeaderGetEventNumber(&(FRAME_PACKET)->packetHeader); \
 		caerFrameIteratorCounter++) { \
-		caerFrameEvent caerFrameIteratorElement = caerFrameEventPacketGetEvent(FRAME_PACKET, caerFrameIteratorCounter); \
+		caerFrameEvent caerFrameIteratorElement = caerFrameEventPacketGetEventUnchecked(FRAME_PACKET, caerFrameIteratorCounter); \
 		if (!caerFrameEventIsValid(caerFrameIteratorElement)) { continue; } // Skip invalid frame events.
 
 /**
@@ -1047,7 +1078,7 @@ static inline const uint16_t *caerFrameEventGetPixelArrayUnsafeConst(caerFrameEv
 	for (int32_t caerFrameIteratorCounter = 0; \
 		caerFrameIteratorCounter < caerEventPacketHeaderGetEventNumber(&(FRAME_PACKET)->packetHeader); \
 		caerFrameIteratorCounter++) { \
-		caerFrameEventConst caerFrameIteratorElement = caerFrameEventPacketGetEventConst(FRAME_PACKET, caerFrameIteratorCounter); \
+		caerFrameEventConst caerFrameIteratorElement = caerFrameEventPacketGetEventConstUnchecked(FRAME_PACKET, caerFrameIteratorCounter); \
 		if (!caerFrameEventIsValid(caerFrameIteratorElement)) { continue; } // Skip invalid frame events.
 
 /**
@@ -1067,7 +1098,7 @@ static inline const uint16_t *caerFrameEventGetPixelArrayUnsafeConst(caerFrameEv
 	for (int32_t caerFrameIteratorCounter = caerEventPacketHeaderGetEventNumber(&(FRAME_PACKET)->packetHeader) - 1; \
 		caerFrameIteratorCounter >= 0; \
 		caerFrameIteratorCounter--) { \
-		caerFrameEvent caerFrameIteratorElement = caerFrameEventPacketGetEvent(FRAME_PACKET, caerFrameIteratorCounter);
+		caerFrameEvent caerFrameIteratorElement = caerFrameEventPacketGetEventUnchecked(FRAME_PACKET, caerFrameIteratorCounter);
 /**
  * Const-Reverse iterator over all frame events in a packet.
  * Returns the current index in the 'caerFrameIteratorCounter' variable of type
@@ -1080,7 +1111,7 @@ static inline const uint16_t *caerFrameEventGetPixelArrayUnsafeConst(caerFrameEv
 	for (int32_t caerFrameIteratorCounter = caerEventPacketHeaderGetEventNumber(&(FRAME_PACKET)->packetHeader) - 1; \
 		caerFrameIteratorCounter >= 0; \
 		caerFrameIteratorCounter--) { \
-		caerFrameEventConst caerFrameIteratorElement = caerFrameEventPacketGetEventConst(FRAME_PACKET, caerFrameIteratorCounter);
+		caerFrameEventConst caerFrameIteratorElement = caerFrameEventPacketGetEventConstUnchecked(FRAME_PACKET, caerFrameIteratorCounter);
 
 /**
  * Reverse iterator close statement.
@@ -1099,7 +1130,7 @@ static inline const uint16_t *caerFrameEventGetPixelArrayUnsafeConst(caerFrameEv
 	for (int32_t caerFrameIteratorCounter = caerEventPacketHeaderGetEventNumber(&(FRAME_PACKET)->packetHeader) - 1; \
 		caerFrameIteratorCounter >= 0; \
 		caerFrameIteratorCounter--) { \
-		caerFrameEvent caerFrameIteratorElement = caerFrameEventPacketGetEvent(FRAME_PACKET, caerFrameIteratorCounter); \
+		caerFrameEvent caerFrameIteratorElement = caerFrameEventPacketGetEventUnchecked(FRAME_PACKET, caerFrameIteratorCounter); \
 		if (!caerFrameEventIsValid(caerFrameIteratorElement)) { continue; } // Skip invalid frame events.
 
 /**
@@ -1114,7 +1145,7 @@ static inline const uint16_t *caerFrameEventGetPixelArrayUnsafeConst(caerFrameEv
 	for (int32_t caerFrameIteratorCounter = caerEventPacketHeaderGetEventNumber(&(FRAME_PACKET)->packetHeader) - 1; \
 		caerFrameIteratorCounter >= 0; \
 		caerFrameIteratorCounter--) { \
-		caerFrameEventConst caerFrameIteratorElement = caerFrameEventPacketGetEventConst(FRAME_PACKET, caerFrameIteratorCounter); \
+		caerFrameEventConst caerFrameIteratorElement = caerFrameEventPacketGetEventConstUnchecked(FRAME_PACKET, caerFrameIteratorCounter); \
 		if (!caerFrameEventIsValid(caerFrameIteratorElement)) { continue; } // Skip invalid frame events.
 
 /**
@@ -99,7 +99,7 @@ caerIMU6EventPacket caerIMU6EventPacketAllocate(int32_t eventCapacity, int16_t e
  */
 static inline caerIMU6Event caerIMU6EventPacketGetEvent(caerIMU6EventPacket packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "IMU6 Event",
 			"Called caerIMU6EventPacketGetEvent() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -121,7 +121,7 @@ static inline caerIMU6Event caerIMU6EventPacketGetEvent(caerIMU6EventPacket pack
  */
 static inline caerIMU6EventConst caerIMU6EventPacketGetEventConst(caerIMU6EventPacketConst packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "IMU6 Event",
 			"Called caerIMU6EventPacketGetEventConst() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -132,6 +132,35 @@ static inline caerIMU6EventConst caerIMU6EventPacketGetEventConst(caerIMU6EventP
 	return (packet->events + n);
 }
 
+/**
+ * Get the IMU 6-axes event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ *
+ * @param packet a valid IMU6EventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested IMU 6-axes event.
+ */
+static inline caerIMU6Event caerIMU6EventPacketGetEventUnchecked(caerIMU6EventPacket packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
+/**
+ * Get the IMU 6-axes event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ * This is a read-only event, do not change its contents in any way!
+ *
+ * @param packet a valid IMU6EventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested read-only IMU 6-axes event.
+ */
+static inline caerIMU6EventConst caerIMU6EventPacketGetEventConstUnchecked(caerIMU6EventPacketConst packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
 /**
  * Get the 32bit event timestamp, in microseconds.
  * Be aware that this wraps around! You can either ignore this fact,
@@ -201,7 +230,7 @@ static inline bool caerIMU6EventIsValid(caerIMU6EventConst event) {
  * @param packet the IMU6EventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerIMU6EventValidate(caerIMU6Event event, caerIMU6EventPacket packet) {
-	if (!caerIMU6EventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(!caerIMU6EventIsValid(event))) {
 		SET_NUMBITS32(event->info, VALID_MARK_SHIFT, VALID_MARK_MASK, 1);
 
 		// Also increase number of events and valid events.
@@ -226,7 +255,7 @@ static inline void caerIMU6EventValidate(caerIMU6Event event, caerIMU6EventPacke
  * @param packet the IMU6EventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerIMU6EventInvalidate(caerIMU6Event event, caerIMU6EventPacket packet) {
-	if (caerIMU6EventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(caerIMU6EventIsValid(event))) {
 		CLEAR_NUMBITS32(event->info, VALID_MARK_SHIFT, VALID_MARK_MASK);
 
 		// Also decrease number of valid events. Number of total events doesn't change.
@@ -412,7 +441,7 @@ static inline void caerIMU6EventSetTemp(caerIMU6Event event, float temp) {
 	for (int32_t caerIMU6IteratorCounter = 0; \
 		caerIMU6IteratorCounter < caerEventPacketHeaderGetEventNumber(&(IMU6_PACKET)->packetHeader); \
 		caerIMU6IteratorCounter++) { \
-		caerIMU6Event caerIMU6IteratorElement = caerIMU6EventPacketGetEvent(IMU6_PACKET, caerIMU6IteratorCounter);
+		caerIMU6Event caerIMU6IteratorElement = caerIMU6EventPacketGetEventUnchecked(IMU6_PACKET, caerIMU6IteratorCounter);
 
 /**
  * Const-Iterator over all IMU6 events in a packet.
@@ -426,7 +455,7 @@ static inline void caerIMU6EventSetTemp(caerIMU6Event event, float temp) {
 	for (int32_t caerIMU6IteratorCounter = 0; \
 		caerIMU6IteratorCounter < caerEventPacketHeaderGetEventNumber(&(IMU6_PACKET)->packetHeader); \
 		caerIMU6IteratorCounter++) { \
-		caerIMU6EventConst caerIMU6IteratorElement = caerIMU6EventPacketGetEventConst(IMU6_PACKET, caerIMU6IteratorCounter);
+		caerIMU6EventConst caerIMU6IteratorElement = caerIMU6EventPacketGetEventConstUnchecked(IMU6_PACKET, caerIMU6IteratorCounter);
 
 /**
  * Iterator close statement.
@@ -445,7 +474,7 @@ static inline void caerIMU6EventSetTemp(caerIMU6Event event, float temp) {
 	for (int32_t caerIMU6IteratorCounter = 0; \
 		caerIMU6IteratorCounter < caerEventPacketHeaderGetEventNumber(&(IMU6_PACKET)->packetHeader); \
 		caerIMU6IteratorCounter++) { \
-		caerIMU6Event caerIMU6IteratorElement = caerIMU6EventPacketGetEvent(IMU6_PACKET, caerIMU6IteratorCounter); \
+		caerIMU6Event caerIMU6IteratorElement = caerIMU6EventPacketGetEventUnchecked(IMU6_PACKET, caerIMU6IteratorCounter); \
 		if (!caerIMU6EventIsValid(caerIMU6IteratorElement)) { continue; } // Skip invalid IMU6 events.
 
 /**
@@ -460,7 +489,7 @@ static inline void caerIMU6EventSetTemp(caerIMU6Event event, float temp) {
 	for (int32_t caerIMU6IteratorCounter = 0; \
 		caerIMU6IteratorCounter < caerEventPacketHeaderGetEventNumber(&(IMU6_PACKET)->packetHeader); \
 		caerIMU6IteratorCounter++) { \
-		caerIMU6EventConst caerIMU6IteratorElement = caerIMU6EventPacketGetEventConst(IMU6_PACKET, caerIMU6IteratorCounter); \
+		caerIMU6EventConst caerIMU6IteratorElement = caerIMU6EventPacketGetEventConstUnchecked(IMU6_PACKET, caerIMU6IteratorCounter); \
 		if (!caerIMU6EventIsValid(caerIMU6IteratorElement)) { continue; } // Skip invalid IMU6 events.
 
 /**
@@ -480,7 +509,7 @@ static inline void caerIMU6EventSetTemp(caerIMU6Event event, float temp) {
 	for (int32_t caerIMU6IteratorCounter = caerEventPacketHeaderGetEventNumber(&(IMU6_PACKET)->packetHeader) - 1; \
 		caerIMU6IteratorCounter >= 0; \
 		caerIMU6IteratorCounter--) { \
-		caerIMU6Event caerIMU6IteratorElement = caerIMU6EventPacketGetEvent(IMU6_PACKET, caerIMU6IteratorCounter);
+		caerIMU6Event caerIMU6IteratorElement = caerIMU6EventPacketGetEventUnchecked(IMU6_PACKET, caerIMU6IteratorCounter);
 /**
  * Const-Reverse iterator over all IMU6 events in a packet.
  * Returns the current index in the 'caerIMU6IteratorCounter' variable of type
@@ -493,7 +522,7 @@ static inline void caerIMU6EventSetTemp(caerIMU6Event event, float temp) {
 	for (int32_t caerIMU6IteratorCounter = caerEventPacketHeaderGetEventNumber(&(IMU6_PACKET)->packetHeader) - 1; \
 		caerIMU6IteratorCounter >= 0; \
 		caerIMU6IteratorCounter--) { \
-		caerIMU6EventConst caerIMU6IteratorElement = caerIMU6EventPacketGetEventConst(IMU6_PACKET, caerIMU6IteratorCounter);
+		caerIMU6EventConst caerIMU6IteratorElement = caerIMU6EventPacketGetEventConstUnchecked(IMU6_PACKET, caerIMU6IteratorCounter);
 
 /**
  * Reverse iterator close statement.
@@ -512,7 +541,7 @@ static inline void caerIMU6EventSetTemp(caerIMU6Event event, float temp) {
 	for (int32_t caerIMU6IteratorCounter = caerEventPacketHeaderGetEventNumber(&(IMU6_PACKET)->packetHeader) - 1; \
 		caerIMU6IteratorCounter >= 0; \
 		caerIMU6IteratorCounter--) { \
-		caerIMU6Event caerIMU6IteratorElement = caerIMU6EventPacketGetEvent(IMU6_PACKET, caerIMU6IteratorCounter); \
+		caerIMU6Event caerIMU6IteratorElement = caerIMU6EventPacketGetEventUnchecked(IMU6_PACKET, caerIMU6IteratorCounter); \
 		if (!caerIMU6EventIsValid(caerIMU6IteratorElement)) { continue; } // Skip invalid IMU6 events.
 
 /**
@@ -527,7 +556,7 @@ static inline void caerIMU6EventSetTemp(caerIMU6Event event, float temp) {
 	for (int32_t caerIMU6IteratorCounter = caerEventPacketHeaderGetEventNumber(&(IMU6_PACKET)->packetHeader) - 1; \
 		caerIMU6IteratorCounter >= 0; \
 		caerIMU6IteratorCounter--) { \
-		caerIMU6EventConst caerIMU6IteratorElement = caerIMU6EventPacketGetEventConst(IMU6_PACKET, caerIMU6IteratorCounter); \
+		caerIMU6EventConst caerIMU6IteratorElement = caerIMU6EventPacketGetEventConstUnchecked(IMU6_PACKET, caerIMU6IteratorCounter); \
 		if (!caerIMU6EventIsValid(caerIMU6IteratorElement)) { continue; } // Skip invalid IMU6 events.
 
 /**
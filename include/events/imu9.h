@@ -107,7 +107,7 @@ caerIMU9EventPacket caerIMU9EventPacketAllocate(int32_t eventCapacity, int16_t e
  */
 static inline caerIMU9Event caerIMU9EventPacketGetEvent(caerIMU9EventPacket packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "IMU9 Event",
 			"Called caerIMU9EventPacketGetEvent() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -129,7 +129,7 @@ static inline caerIMU9Event caerIMU9EventPacketGetEvent(caerIMU9EventPacket pack
  */
 static inline caerIMU9EventConst caerIMU9EventPacketGetEventConst(caerIMU9EventPacketConst packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "IMU9 Event",
 			"Called caerIMU9EventPacketGetEventConst() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -140,6 +140,35 @@ static inline caerIMU9EventConst caerIMU9EventPacketGetEventConst(caerIMU9EventP
 	return (packet->events + n);
 }
 
+/**
+ * Get the IMU 9-axes event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ *
+ * @param packet a valid IMU9EventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested IMU 9-axes event.
+ */
+static inline caerIMU9Event caerIMU9EventPacketGetEventUnchecked(caerIMU9EventPacket packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
+/**
+ * Get the IMU 9-axes event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ * This is a read-only event, do not change its contents in any way!
+ *
+ * @param packet a valid IMU9EventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested read-only IMU 9-axes event.
+ */
+static inline caerIMU9EventConst caerIMU9EventPacketGetEventConstUnchecked(caerIMU9EventPacketConst packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
 /**
  * Get the 32bit event timestamp, in microseconds.
  * Be aware that this wraps around! You can either ignore this fact,
@@ -209,7 +238,7 @@ static inline bool caerIMU9EventIsValid(caerIMU9EventConst event) {
  * @param packet the IMU9EventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerIMU9EventValidate(caerIMU9Event event, caerIMU9EventPacket packet) {
-	if (!caerIMU9EventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(!caerIMU9EventIsValid(event))) {
 		SET_NUMBITS32(event->info, VALID_MARK_SHIFT, VALID_MARK_MASK, 1);
 
 		// Also increase number of events and valid events.
@@ -234,7 +263,7 @@ static inline void caerIMU9EventValidate(caerIMU9Event event, caerIMU9EventPacke
  * @param packet the IMU9EventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerIMU9EventInvalidate(caerIMU9Event event, caerIMU9EventPacket packet) {
-	if (caerIMU9EventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(caerIMU9EventIsValid(event))) {
 		CLEAR_NUMBITS32(event->info, VALID_MARK_SHIFT, VALID_MARK_MASK);
 
 		// Also decrease number of valid events. Number of total events doesn't change.
@@ -489,7 +518,7 @@ static inline void caerIMU9EventSetCompZ(caerIMU9Event event, float compZ) {
 	for (int32_t caerIMU9IteratorCounter = 0; \
 		caerIMU9IteratorCounter < caerEventPacketHeaderGetEventNumber(&(IMU9_PACKET)->packetHeader); \
 		caerIMU9IteratorCounter++) { \
-		caerIMU9Event caerIMU9IteratorElement = caerIMU9EventPacketGetEvent(IMU9_PACKET, caerIMU9IteratorCounter);
+		caerIMU9Event caerIMU9IteratorElement = caerIMU9EventPacketGetEventUnchecked(IMU9_PACKET, caerIMU9IteratorCounter);
 
 /**
  * Const-Iterator over all IMU9 events in a packet.
@@ -503,7 +532,7 @@ static inline void caerIMU9EventSetCompZ(caerIMU9Event event, float compZ) {
 	for (int32_t caerIMU9IteratorCounter = 0; \
 		caerIMU9IteratorCounter < caerEventPacketHeaderGetEventNumber(&(IMU9_PACKET)->packetHeader); \
 		caerIMU9IteratorCounter++) { \
-		caerIMU9EventConst caerIMU9IteratorElement = caerIMU9EventPacketGetEventConst(IMU9_PACKET, caerIMU9IteratorCounter);
+		caerIMU9EventConst caerIMU9IteratorElement = caerIMU9EventPacketGetEventConstUnchecked(IMU9_PACKET, caerIMU9IteratorCounter);
 
 /**
  * Iterator close statement.
@@ -522,7 +551,7 @@ static inline void caerIMU9EventSetCompZ(caerIMU9Event event, float compZ) {
 	for (int32_t caerIMU9IteratorCounter = 0; \
 		caerIMU9IteratorCounter < caerEventPacketHeaderGetEventNumber(&(IMU9_PACKET)->packetHeader); \
 		caerIMU9IteratorCounter++) { \
-		caerIMU9Event caerIMU9IteratorElement = caerIMU9EventPacketGetEvent(IMU9_PACKET, caerIMU9IteratorCounter); \
+		caerIMU9Event caerIMU9IteratorElement = caerIMU9EventPacketGetEventUnchecked(IMU9_PACKET, caerIMU9IteratorCounter); \
 		if (!caerIMU9EventIsValid(caerIMU9IteratorElement)) { continue; } // Skip invalid IMU9 events.
 
 /**
@@ -537,7 +566,7 @@ static inline void caerIMU9EventSetCompZ(caerIMU9Event event, float compZ) {
 	for (int32_t caerIMU9IteratorCounter = 0; \
 		caerIMU9IteratorCounter < caerEventPacketHeaderGetEventNumber(&(IMU9_PACKET)->packetHeader); \
 		caerIMU9IteratorCounter++) { \
-		caerIMU9EventConst caerIMU9IteratorElement = caerIMU9EventPacketGetEventConst(IMU9_PACKET, caerIMU9IteratorCounter); \
+		caerIMU9EventConst caerIMU9IteratorElement = caerIMU9EventPacketGetEventConstUnchecked(IMU9_PACKET, caerIMU9IteratorCounter); \
 		if (!caerIMU9EventIsValid(caerIMU9IteratorElement)) { continue; } // Skip invalid IMU9 events.
 
 /**
@@ -557,7 +586,7 @@ static inline void caerIMU9EventSetCompZ(caerIMU9Event event, float compZ) {
 	for (int32_t caerIMU9IteratorCounter = caerEventPacketHeaderGetEventNumber(&(IMU9_PACKET)->packetHeader) - 1; \
 		caerIMU9IteratorCounter >= 0; \
 		caerIMU9IteratorCounter--) { \
-		caerIMU9Event caerIMU9IteratorElement = caerIMU9EventPacketGetEvent(IMU9_PACKET, caerIMU9IteratorCounter);
+		caerIMU9Event caerIMU9IteratorElement = caerIMU9EventPacketGetEventUnchecked(IMU9_PACKET, caerIMU9IteratorCounter);
 /**
  * Const-Reverse iterator over all IMU9 events in a packet.
  * Returns the current index in the 'caerIMU9IteratorCounter' variable of type
@@ -570,7 +599,7 @@ static inline void caerIMU9EventSetCompZ(caerIMU9Event event, float compZ) {
 	for (int32_t caerIMU9IteratorCounter = caerEventPacketHeaderGetEventNumber(&(IMU9_PACKET)->packetHeader) - 1; \
 		caerIMU9IteratorCounter >= 0; \
 		caerIMU9IteratorCounter--) { \
-		caerIMU9EventConst caerIMU9IteratorElement = caerIMU9EventPacketGetEventConst(IMU9_PACKET, caerIMU9IteratorCounter);
+		caerIMU9EventConst caerIMU9IteratorElement = caerIMU9EventPacketGetEventConstUnchecked(IMU9_PACKET, caerIMU9IteratorCounter);
 
 /**
  * Reverse iterator close statement.
@@ -589,7 +618,7 @@ static inline void caerIMU9EventSetCompZ(caerIMU9Event event, float compZ) {
 	for (int32_t caerIMU9IteratorCounter = caerEventPacketHeaderGetEventNumber(&(IMU9_PACKET)->packetHeader) - 1; \
 		caerIMU9IteratorCounter >= 0; \
 		caerIMU9IteratorCounter--) { \
-		caerIMU9Event caerIMU9IteratorElement = caerIMU9EventPacketGetEvent(IMU9_PACKET, caerIMU9IteratorCounter); \
+		caerIMU9Event caerIMU9IteratorElement = caerIMU9EventPacketGetEventUnchecked(IMU9_PACKET, caerIMU9IteratorCounter); \
 		if (!caerIMU9EventIsValid(caerIMU9IteratorElement)) { continue; } // Skip invalid IMU9 events.
 
 /**
@@ -604,7 +633,7 @@ static inline void caerIMU9EventSetCompZ(caerIMU9Event event, float compZ) {
 	for (int32_t caerIMU9IteratorCounter = caerEventPacketHeaderGetEventNumber(&(IMU9_PACKET)->packetHeader) - 1; \
 		caerIMU9IteratorCounter >= 0; \
 		caerIMU9IteratorCounter--) { \
-		caerIMU9EventConst caerIMU9IteratorElement = caerIMU9EventPacketGetEventConst(IMU9_PACKET, caerIMU9IteratorCounter); \
+		caerIMU9EventConst caerIMU9IteratorElement = caerIMU9EventPacketGetEventConstUnchecked(IMU9_PACKET, caerIMU9IteratorCounter); \
 		if (!caerIMU9EventIsValid(caerIMU9IteratorElement)) { continue; } // Skip invalid IMU9 events.
 
 /**
@@ -71,6 +71,8 @@ struct caer_event_packet_container {
 	int32_t eventsValidNumber;
 	/// Number of different event packets contained.
 	int32_t eventPacketsNumber;
+	/// Host time (CLOCK_MONOTONIC, in µs) corresponding to the largest event timestamp.
+	int64_t hostTimestamp;
 	/// Array of pointers to the actual event packets.
 	caerEventPacketHeader eventPackets[];
 });
@@ -269,6 +271,40 @@ static inline int64_t caerEventPacketContainerGetHighestEventTimestamp(caerEvent
 	return (container->highestEventTimestamp);
 }
 
+/**
+ * Get the host time corresponding to the highest timestamp contained in this
+ * event packet container. Devices set this from their device to host clock
+ * correlation, see caerDeviceTimestampToHost().
+ *
+ * @param container a valid EventPacketContainer handle. If NULL, -1 is returned.
+ *
+ * @return the host time (CLOCK_MONOTONIC, in µs) or -1 if not known.
+ */
+static inline int64_t caerEventPacketContainerGetHostTimestamp(caerEventPacketContainerConst container) {
+	// Non-existing (empty) containers have no valid packets in them!
+	if (container == NULL) {
+		return (-1);
+	}
+
+	return (container->hostTimestamp);
+}
+
+/**
+ * Set the host time corresponding to the highest timestamp contained in this
+ * event packet container.
+ *
+ * @param container a valid EventPacketContainer handle. If NULL, nothing happens.
+ * @param hostTimestamp the host time (CLOCK_MONOTONIC, in µs) or -1 if not known.
+ */
+static inline void caerEventPacketContainerSetHostTimestamp(caerEventPacketContainer container, int64_t hostTimestamp) {
+	// Non-existing (empty) containers have no valid packets in them!
+	if (container == NULL) {
+		return;
+	}
+
+	container->hostTimestamp = hostTimestamp;
+}
+
 /**
  * Get the number of events contained in this event packet container.
  *
@@ -472,6 +508,8 @@ static inline caerEventPacketContainer caerEventPacketContainerCopyAllEvents(cae
 			caerEventPacketCopyOnlyEvents(caerEventPacketContainerIteratorElement));
 	CAER_EVENT_PACKET_CONTAINER_ITERATOR_END
 
+	caerEventPacketContainerSetHostTimestamp(newContainer, caerEventPacketContainerGetHostTimestamp(container));
+
 	return (newContainer);
 }
 
@@ -500,6 +538,8 @@ static inline caerEventPacketContainer caerEventPacketContainerCopyValidEvents(c
 			caerEventPacketCopyOnlyValidEvents(caerEventPacketContainerIteratorElement));
 	CAER_EVENT_PACKET_CONTAINER_ITERATOR_END
 
+	caerEventPacketContainerSetHostTimestamp(newContainer, caerEventPacketContainerGetHostTimestamp(container));
+
 	return (newContainer);
 }
 
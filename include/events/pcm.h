@@ -0,0 +1,607 @@
+/**
+ * @file pcm.h
+ *
+ * PCM (audio) Events format definition and handling functions.
+ * Each event holds a contiguous block of signed integer audio
+ * samples from one channel, taken at a fixed sample rate, together
+ * with the timestamp of the first sample. Compared to one ADC sample
+ * event per sample, this halves the memory needed and the samples can
+ * be handed directly to audio processing code.
+ */
+
+#ifndef LIBCAER_EVENTS_PCM_H_
+#define LIBCAER_EVENTS_PCM_H_
+
+#include "common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Shift and mask values for the channel identifier contained
+ * in the 'info' field of the PCM event.
+ * Up to 128 channels are supported, for example the left (0)
+ * and right (1) microphones of a stereo pair.
+ * Bit 0 is the valid mark, see 'common.h' for more details.
+ */
+//@{
+#define PCM_CHANNEL_SHIFT 1
+#define PCM_CHANNEL_MASK 0x0000007F
+//@}
+
+/**
+ * PCM event data structure definition.
+ * This contains the channel the samples belong to, the timestamp
+ * of the first sample, the sample rate, as well as the actual
+ * samples, as signed 32 bit integers, in the order they were taken.
+ * Signed integers are used for fields that are to be interpreted
+ * directly, for compatibility with languages that do not have
+ * unsigned integer types, such as Java.
+ */
+PACKED_STRUCT(
+struct caer_pcm_event {
+	/// Event information (channel). First because of valid mark.
+	uint32_t info;
+	/// Timestamp of the first sample.
+	int32_t timestamp;
+	/// Sample rate in Hz.
+	int32_t sampleRate;
+	/// Number of valid samples in the samples array.
+	int32_t sampleNumber;
+	/// Samples array, signed 32 bit integers, in the order they were taken.
+	int32_t samples[1]; // size 1 here for C++ compatibility.
+});
+
+/**
+ * Type for pointer to PCM event data structure.
+ */
+typedef struct caer_pcm_event *caerPCMEvent;
+typedef const struct caer_pcm_event *caerPCMEventConst;
+
+/**
+ * PCM event packet data structure definition.
+ * EventPackets are always made up of the common packet header,
+ * followed by 'eventCapacity' events. Everything has to
+ * be in one contiguous memory block. Direct access to the events
+ * array is not possible for PCM events. To calculate position
+ * offsets, use the 'eventSize' field in the packet header.
+ */
+PACKED_STRUCT(
+struct caer_pcm_event_packet {
+	/// The common event packet header.
+	struct caer_event_packet_header packetHeader;
+	/// All events follow here. Direct access to the events
+	/// array is not possible. To calculate position, use the
+	/// 'eventSize' field in the packetHeader.
+});
+
+/**
+ * Type for pointer to PCM event packet data structure.
+ */
+typedef struct caer_pcm_event_packet *caerPCMEventPacket;
+typedef const struct caer_pcm_event_packet *caerPCMEventPacketConst;
+
+/**
+ * Allocate a new PCM events packet.
+ * Use free() to reclaim this memory.
+ * The PCM events allocate memory for a maximum sized samples array, so
+ * that every event occupies the same amount of memory (constant size).
+ * The actual number of samples inside of it might be smaller than that,
+ * and should always be queried from the event itself.
+ * The unused part of a samples array is guaranteed to be zeros.
+ *
+ * @param eventCapacity the maximum number of events this packet will hold.
+ * @param eventSource the unique ID representing the source/generator of this packet.
+ * @param tsOverflow the current timestamp overflow counter value for this packet.
+ * @param maxSampleNumber the maximum expected number of samples for events in this packet.
+ *
+ * @return a valid PCMEventPacket handle or NULL on error.
+ */
+caerPCMEventPacket caerPCMEventPacketAllocate(int32_t eventCapacity, int16_t eventSource, int32_t tsOverflow,
+	int32_t maxSampleNumber);
+
+/**
+ * Get the PCM event at the given index from the event packet.
+ *
+ * @param packet a valid PCMEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested PCM event. NULL on error.
+ */
+static inline caerPCMEvent caerPCMEventPacketGetEvent(caerPCMEventPacket packet, int32_t n) {
+	// Check that we're not out of bounds.
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
+		caerLog(CAER_LOG_CRITICAL, "PCM Event",
+			"Called caerPCMEventPacketGetEvent() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
+			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
+		return (NULL);
+	}
+
+	// Return a pointer to the specified event.
+	return ((caerPCMEvent) (((uint8_t *) &packet->packetHeader)
+		+ (CAER_EVENT_PACKET_HEADER_SIZE + U64T(n * caerEventPacketHeaderGetEventSize(&packet->packetHeader)))));
+}
+
+/**
+ * Get the PCM event at the given index from the event packet.
+ * This is a read-only event, do not change its contents in any way!
+ *
+ * @param packet a valid PCMEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested read-only PCM event. NULL on error.
+ */
+static inline caerPCMEventConst caerPCMEventPacketGetEventConst(caerPCMEventPacketConst packet, int32_t n) {
+	// Check that we're not out of bounds.
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
+		caerLog(CAER_LOG_CRITICAL, "PCM Event",
+			"Called caerPCMEventPacketGetEventConst() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
+			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
+		return (NULL);
+	}
+
+	// Return a pointer to the specified event.
+	return ((caerPCMEventConst) (((const uint8_t *) &packet->packetHeader)
+		+ (CAER_EVENT_PACKET_HEADER_SIZE + U64T(n * caerEventPacketHeaderGetEventSize(&packet->packetHeader)))));
+}
+
+/**
+ * Get the PCM event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ *
+ * @param packet a valid PCMEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested PCM event.
+ */
+static inline caerPCMEvent caerPCMEventPacketGetEventUnchecked(caerPCMEventPacket packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return ((caerPCMEvent) (((uint8_t *) &packet->packetHeader)
+		+ (CAER_EVENT_PACKET_HEADER_SIZE + U64T(n * caerEventPacketHeaderGetEventSize(&packet->packetHeader)))));
+}
+
+/**
+ * Get the PCM event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ * This is a read-only event, do not change its contents in any way!
+ *
+ * @param packet a valid PCMEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested read-only PCM event.
+ */
+static inline caerPCMEventConst caerPCMEventPacketGetEventConstUnchecked(caerPCMEventPacketConst packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return ((caerPCMEventConst) (((const uint8_t *) &packet->packetHeader)
+		+ (CAER_EVENT_PACKET_HEADER_SIZE + U64T(n * caerEventPacketHeaderGetEventSize(&packet->packetHeader)))));
+}
+
+/**
+ * Get the 32bit event timestamp, in microseconds.
+ * This is the timestamp of the first sample.
+ * Be aware that this wraps around! You can either ignore this fact,
+ * or handle the special 'TIMESTAMP_WRAP' event that is generated when
+ * this happens, or use the 64bit timestamp which never wraps around.
+ * See 'caerEventPacketHeaderGetEventTSOverflow()' documentation
+ * for more details on the 64bit timestamp.
+ *
+ * @param event a valid PCMEvent pointer. Cannot be NULL.
+ *
+ * @return this event's 32bit microsecond timestamp.
+ */
+static inline int32_t caerPCMEventGetTimestamp(caerPCMEventConst event) {
+	return (le32toh(event->timestamp));
+}
+
+/**
+ * Get the 64bit event timestamp, in microseconds.
+ * This is the timestamp of the first sample.
+ * See 'caerEventPacketHeaderGetEventTSOverflow()' documentation
+ * for more details on the 64bit timestamp.
+ *
+ * @param event a valid PCMEvent pointer. Cannot be NULL.
+ * @param packet the PCMEventPacket pointer for the packet containing this event. Cannot be NULL.
+ *
+ * @return this event's 64bit microsecond timestamp.
+ */
+static inline int64_t caerPCMEventGetTimestamp64(caerPCMEventConst event, caerPCMEventPacketConst packet) {
+	return (I64T(
+		(U64T(caerEventPacketHeaderGetEventTSOverflow(&packet->packetHeader)) << TS_OVERFLOW_SHIFT) | U64T(caerPCMEventGetTimestamp(event))));
+}
+
+/**
+ * Set the 32bit event timestamp, the value has to be in microseconds.
+ * This is the timestamp of the first sample.
+ *
+ * @param event a valid PCMEvent pointer. Cannot be NULL.
+ * @param timestamp a positive 32bit microsecond timestamp.
+ */
+static inline void caerPCMEventSetTimestamp(caerPCMEvent event, int32_t timestamp) {
+	if (timestamp < 0) {
+		// Negative means using the 31st bit!
+		caerLog(CAER_LOG_CRITICAL, "PCM Event", "Called caerPCMEventSetTimestamp() with negative value!");
+		return;
+	}
+
+	event->timestamp = htole32(timestamp);
+}
+
+/**
+ * Check if this PCM event is valid.
+ *
+ * @param event a valid PCMEvent pointer. Cannot be NULL.
+ *
+ * @return true if valid, false if not.
+ */
+static inline bool caerPCMEventIsValid(caerPCMEventConst event) {
+	return (GET_NUMBITS32(event->info, VALID_MARK_SHIFT, VALID_MARK_MASK));
+}
+
+/**
+ * Validate the current event by setting its valid bit to true
+ * and increasing the event packet's event count and valid
+ * event count. Only works on events that are invalid.
+ * DO NOT CALL THIS AFTER HAVING PREVIOUSLY ALREADY
+ * INVALIDATED THIS EVENT, the total count will be incorrect.
+ *
+ * @param event a valid PCMEvent pointer. Cannot be NULL.
+ * @param packet the PCMEventPacket pointer for the packet containing this event. Cannot be NULL.
+ */
+static inline void caerPCMEventValidate(caerPCMEvent event, caerPCMEventPacket packet) {
+	if (CAER_ACCESS_CHECK(!caerPCMEventIsValid(event))) {
+		SET_NUMBITS32(event->info, VALID_MARK_SHIFT, VALID_MARK_MASK, 1);
+
+		// Also increase number of events and valid events.
+		// Only call this on (still) invalid events!
+		caerEventPacketHeaderSetEventNumber(&packet->packetHeader,
+			caerEventPacketHeaderGetEventNumber(&packet->packetHeader) + 1);
+		caerEventPacketHeaderSetEventValid(&packet->packetHeader,
+			caerEventPacketHeaderGetEventValid(&packet->packetHeader) + 1);
+	}
+	else {
+		caerLog(CAER_LOG_CRITICAL, "PCM Event", "Called caerPCMEventValidate() on already valid event.");
+	}
+}
+
+/**
+ * Invalidate the current event by setting its valid bit
+ * to false and decreasing the number of valid events held
+ * in the packet. Only works with events that are already
+ * valid!
+ *
+ * @param event a valid PCMEvent pointer. Cannot be NULL.
+ * @param packet the PCMEventPacket pointer for the packet containing this event. Cannot be NULL.
+ */
+static inline void caerPCMEventInvalidate(caerPCMEvent event, caerPCMEventPacket packet) {
+	if (CAER_ACCESS_CHECK(caerPCMEventIsValid(event))) {
+		CLEAR_NUMBITS32(event->info, VALID_MARK_SHIFT, VALID_MARK_MASK);
+
+		// Also decrease number of valid events. Number of total events doesn't change.
+		// Only call this on valid events!
+		caerEventPacketHeaderSetEventValid(&packet->packetHeader,
+			caerEventPacketHeaderGetEventValid(&packet->packetHeader) - 1);
+	}
+	else {
+		caerLog(CAER_LOG_CRITICAL, "PCM Event", "Called caerPCMEventInvalidate() on already invalid event.");
+	}
+}
+
+/**
+ * Get the maximum number of samples an event can hold, based upon how
+ * much memory was allocated to it by 'caerPCMEventPacketAllocate()'.
+ *
+ * @param packet a valid PCMEventPacket pointer. Cannot be NULL.
+ *
+ * @return maximum samples array index.
+ */
+static inline size_t caerPCMEventPacketGetSamplesMaxIndex(caerPCMEventPacketConst packet) {
+	// '- sizeof(int32_t)' to compensate for samples[1] at end of struct for C++ compatibility.
+	return (((size_t) caerEventPacketHeaderGetEventSize(&packet->packetHeader) - (sizeof(struct caer_pcm_event) - sizeof(int32_t)))
+		/ sizeof(int32_t));
+}
+
+/**
+ * Get the channel the samples belong to, for example the
+ * left (0) or right (1) microphone of a stereo pair.
+ *
+ * @param event a valid PCMEvent pointer. Cannot be NULL.
+ *
+ * @return the channel identifier.
+ */
+static inline uint8_t caerPCMEventGetChannel(caerPCMEventConst event) {
+	return U8T(GET_NUMBITS32(event->info, PCM_CHANNEL_SHIFT, PCM_CHANNEL_MASK));
+}
+
+/**
+ * Set the channel the samples belong to, for example the
+ * left (0) or right (1) microphone of a stereo pair.
+ *
+ * @param event a valid PCMEvent pointer. Cannot be NULL.
+ * @param channel the channel identifier.
+ */
+static inline void caerPCMEventSetChannel(caerPCMEvent event, uint8_t channel) {
+	CLEAR_NUMBITS32(event->info, PCM_CHANNEL_SHIFT, PCM_CHANNEL_MASK);
+	SET_NUMBITS32(event->info, PCM_CHANNEL_SHIFT, PCM_CHANNEL_MASK, channel);
+}
+
+/**
+ * Get the sample rate, in Hz. Consecutive samples
+ * are taken 1'000'000 / sampleRate microseconds apart.
+ *
+ * @param event a valid PCMEvent pointer. Cannot be NULL.
+ *
+ * @return the sample rate in Hz.
+ */
+static inline int32_t caerPCMEventGetSampleRate(caerPCMEventConst event) {
+	return (I32T(le32toh(event->sampleRate)));
+}
+
+/**
+ * Set the sample rate, in Hz.
+ *
+ * @param event a valid PCMEvent pointer. Cannot be NULL.
+ * @param sampleRate the sample rate in Hz.
+ */
+static inline void caerPCMEventSetSampleRate(caerPCMEvent event, int32_t sampleRate) {
+	if (sampleRate <= 0) {
+		// Negative means using the 31st bit!
+		caerLog(CAER_LOG_CRITICAL, "PCM Event", "Called caerPCMEventSetSampleRate() with negative or zero value!");
+		return;
+	}
+
+	event->sampleRate = I32T(htole32(sampleRate));
+}
+
+/**
+ * Get the number of valid samples in the samples array.
+ *
+ * @param event a valid PCMEvent pointer. Cannot be NULL.
+ *
+ * @return the number of samples.
+ */
+static inline int32_t caerPCMEventGetSampleNumber(caerPCMEventConst event) {
+	return (I32T(le32toh(event->sampleNumber)));
+}
+
+/**
+ * Set the number of valid samples in the samples array, while taking
+ * into account the maximum amount of memory available for it, as
+ * allocated in 'caerPCMEventPacketAllocate()'.
+ *
+ * @param event a valid PCMEvent pointer. Cannot be NULL.
+ * @param sampleNumber the number of samples.
+ * @param packet the PCMEventPacket pointer for the packet containing this event. Cannot be NULL.
+ */
+static inline void caerPCMEventSetSampleNumber(caerPCMEvent event, int32_t sampleNumber,
+	caerPCMEventPacketConst packet) {
+	if (sampleNumber < 0) {
+		// Negative means using the 31st bit!
+		caerLog(CAER_LOG_CRITICAL, "PCM Event", "Called caerPCMEventSetSampleNumber() with negative value!");
+		return;
+	}
+
+	// Verify the number of samples doesn't exceed allocated space.
+	if ((size_t) sampleNumber > caerPCMEventPacketGetSamplesMaxIndex(packet)) {
+		caerLog(CAER_LOG_CRITICAL, "PCM Event",
+			"Called caerPCMEventSetSampleNumber() with value %" PRIi32 ", which exceeds the maximum allocated number of samples of %zu.",
+			sampleNumber, caerPCMEventPacketGetSamplesMaxIndex(packet));
+		return;
+	}
+
+	event->sampleNumber = I32T(htole32(sampleNumber));
+}
+
+/**
+ * Get the value of the sample at the given index.
+ *
+ * @param event a valid PCMEvent pointer. Cannot be NULL.
+ * @param n the index of the sample. Must be within [0,sampleNumber[ bounds.
+ *
+ * @return the sample value.
+ */
+static inline int32_t caerPCMEventGetSample(caerPCMEventConst event, int32_t n) {
+	// Check that we're not out of bounds.
+	if (n < 0 || n >= caerPCMEventGetSampleNumber(event)) {
+		caerLog(CAER_LOG_CRITICAL, "PCM Event",
+			"Called caerPCMEventGetSample() with invalid sample offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
+			n, caerPCMEventGetSampleNumber(event) - 1);
+		return (0);
+	}
+
+	return (I32T(le32toh(event->samples[n])));
+}
+
+/**
+ * Set the value of the sample at the given index.
+ * The number of samples must have been set to include
+ * this index before, see caerPCMEventSetSampleNumber().
+ *
+ * @param event a valid PCMEvent pointer. Cannot be NULL.
+ * @param n the index of the sample. Must be within [0,sampleNumber[ bounds.
+ * @param sample the sample value.
+ */
+static inline void caerPCMEventSetSample(caerPCMEvent event, int32_t n, int32_t sample) {
+	// Check that we're not out of bounds.
+	if (n < 0 || n >= caerPCMEventGetSampleNumber(event)) {
+		caerLog(CAER_LOG_CRITICAL, "PCM Event",
+			"Called caerPCMEventSetSample() with invalid sample offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
+			n, caerPCMEventGetSampleNumber(event) - 1);
+		return;
+	}
+
+	event->samples[n] = I32T(htole32(sample));
+}
+
+/**
+ * Get a direct pointer to the underlying samples array.
+ * This can be used to both get and set values.
+ * No checks at all are performed at any point, nor any
+ * conversions, use this at your own risk!
+ * Remember that the 32 bit sample values are in little-endian!
+ *
+ * @param event a valid PCMEvent pointer. Cannot be NULL.
+ *
+ * @return the samples array (32 bit integers are little-endian).
+ */
+static inline int32_t *caerPCMEventGetSampleArrayUnsafe(caerPCMEvent event) {
+	// Get samples array.
+	return (event->samples);
+}
+
+/**
+ * Get a direct read-only pointer to the underlying samples array.
+ * This can be used to only get values.
+ * No checks at all are performed at any point, nor any
+ * conversions, use this at your own risk!
+ * Remember that the 32 bit sample values are in little-endian!
+ *
+ * @param event a valid PCMEvent pointer. Cannot be NULL.
+ *
+ * @return the read-only samples array (32 bit integers are little-endian).
+ */
+static inline const int32_t *caerPCMEventGetSampleArrayUnsafeConst(caerPCMEventConst event) {
+	// Get samples array.
+	return (event->samples);
+}
+
+/**
+ * Iterator over all PCM events in a packet.
+ * Returns the current index in the 'caerPCMIteratorCounter' variable of type
+ * 'int32_t' and the current event in the 'caerPCMIteratorElement' variable
+ * of type caerPCMEvent.
+ *
+ * PCM_PACKET: a valid PCMEventPacket pointer. Cannot be NULL.
+ */
+#define CAER_PCM_ITERATOR_ALL_START(PCM_PACKET) \
+	for (int32_t caerPCMIteratorCounter = 0; \
+		caerPCMIteratorCounter < caerEventPacketHeaderGetEventNumber(&(PCM_PACKET)->packetHeader); \
+		caerPCMIteratorCounter++) { \
+		caerPCMEvent caerPCMIteratorElement = caerPCMEventPacketGetEventUnchecked(PCM_PACKET, caerPCMIteratorCounter);
+
+/**
+ * Const-Iterator over all PCM events in a packet.
+ * Returns the current index in the 'caerPCMIteratorCounter' variable of type
+ * 'int32_t' and the current read-only event in the 'caerPCMIteratorElement' variable
+ * of type caerPCMEventConst.
+ *
+ * PCM_PACKET: a valid PCMEventPacket pointer. Cannot be NULL.
+ */
+#define CAER_PCM_CONST_ITERATOR_ALL_START(PCM_PACKET) \
+	for (int32_t caerPCMIteratorCounter = 0; \
+		caerPCMIteratorCounter < caerEventPacketHeaderGetEventNumber(&(PCM_PACKET)->packetHeader); \
+		caerPCMIteratorCounter++) { \
+		caerPCMEventConst caerPCMIteratorElement = caerPCMEventPacketGetEventConstUnchecked(PCM_PACKET, caerPCMIteratorCounter);
+
+/**
+ * Iterator close statement.
+ */
+#define CAER_PCM_ITERATOR_ALL_END }
+
+/**
+ * Iterator over only the valid PCM events in a packet.
+ * Returns the current index in the 'caerPCMIteratorCounter' variable of type
+ * 'int32_t' and the current event in the 'caerPCMIteratorElement' variable
+ * of type caerPCMEvent.
+ *
+ * PCM_PACKET: a valid PCMEventPacket pointer. Cannot be NULL.
+ */
+#define CAER_PCM_ITERATOR_VALID_START(PCM_PACKET) \
+	for (int32_t caerPCMIteratorCounter = 0; \
+		caerPCMIteratorCounter < caerEventPacketHeaderGetEventNumber(&(PCM_PACKET)->packetHeader); \
+		caerPCMIteratorCounter++) { \
+		caerPCMEvent caerPCMIteratorElement = caerPCMEventPacketGetEventUnchecked(PCM_PACKET, caerPCMIteratorCounter); \
+		if (!caerPCMEventIsValid(caerPCMIteratorElement)) { continue; } // Skip invalid PCM events.
+
+/**
+ * Const-Iterator over only the valid PCM events in a packet.
+ * Returns the current index in the 'caerPCMIteratorCounter' variable of type
+ * 'int32_t' and the current read-only event in the 'caerPCMIteratorElement' variable
+ * of type caerPCMEventConst.
+ *
+ * PCM_PACKET: a valid PCMEventPacket pointer. Cannot be NULL.
+ */
+#define CAER_PCM_CONST_ITERATOR_VALID_START(PCM_PACKET) \
+	for (int32_t caerPCMIteratorCounter = 0; \
+		caerPCMIteratorCounter < caerEventPacketHeaderGetEventNumber(&(PCM_PACKET)->packetHeader); \
+		caerPCMIteratorCounter++) { \
+		caerPCMEventConst caerPCMIteratorElement = caerPCMEventPacketGetEventConstUnchecked(PCM_PACKET, caerPCMIteratorCounter); \
+		if (!caerPCMEventIsValid(caerPCMIteratorElement)) { continue; } // Skip invalid PCM events.
+
+/**
+ * Iterator close statement.
+ */
+#define CAER_PCM_ITERATOR_VALID_END }
+
+/**
+ * Reverse iterator over all PCM events in a packet.
+ * Returns the current index in the 'caerPCMIteratorCounter' variable of type
+ * 'int32_t' and the current event in the 'caerPCMIteratorElement' variable
+ * of type caerPCMEvent.
+ *
+ * PCM_PACKET: a valid PCMEventPacket pointer. Cannot be NULL.
+ */
+#define CAER_PCM_REVERSE_ITERATOR_ALL_START(PCM_PACKET) \
+	for (int32_t caerPCMIteratorCounter = caerEventPacketHeaderGetEventNumber(&(PCM_PACKET)->packetHeader) - 1; \
+		caerPCMIteratorCounter >= 0; \
+		caerPCMIteratorCounter--) { \
+		caerPCMEvent caerPCMIteratorElement = caerPCMEventPacketGetEventUnchecked(PCM_PACKET, caerPCMIteratorCounter);
+/**
+ * Const-Reverse iterator over all PCM events in a packet.
+ * Returns the current index in the 'caerPCMIteratorCounter' variable of type
+ * 'int32_t' and the current read-only event in the 'caerPCMIteratorElement' variable
+ * of type caerPCMEventConst.
+ *
+ * PCM_PACKET: a valid PCMEventPacket pointer. Cannot be NULL.
+ */
+#define CAER_PCM_CONST_REVERSE_ITERATOR_ALL_START(PCM_PACKET) \
+	for (int32_t caerPCMIteratorCounter = caerEventPacketHeaderGetEventNumber(&(PCM_PACKET)->packetHeader) - 1; \
+		caerPCMIteratorCounter >= 0; \
+		caerPCMIteratorCounter--) { \
+		caerPCMEventConst caerPCMIteratorElement = caerPCMEventPacketGetEventConstUnchecked(PCM_PACKET, caerPCMIteratorCounter);
+
+/**
+ * Reverse iterator close statement.
+ */
+#define CAER_PCM_REVERSE_ITERATOR_ALL_END }
+
+/**
+ * Reverse iterator over only the valid PCM events in a packet.
+ * Returns the current index in the 'caerPCMIteratorCounter' variable of type
+ * 'int32_t' and the current event in the 'caerPCMIteratorElement' variable
+ * of type caerPCMEvent.
+ *
+ * PCM_PACKET: a valid PCMEventPacket pointer. Cannot be NULL.
+ */
+#define CAER_PCM_REVERSE_ITERATOR_VALID_START(PCM_PACKET) \
+	for (int32_t caerPCMIteratorCounter = caerEventPacketHeaderGetEventNumber(&(PCM_PACKET)->packetHeader) - 1; \
+		caerPCMIteratorCounter >= 0; \
+		caerPCMIteratorCounter--) { \
+		caerPCMEvent caerPCMIteratorElement = caerPCMEventPacketGetEventUnchecked(PCM_PACKET, caerPCMIteratorCounter); \
+		if (!caerPCMEventIsValid(caerPCMIteratorElement)) { continue; } // Skip invalid PCM events.
+
+/**
+ * Const-Reverse iterator over only the valid PCM events in a packet.
+ * Returns the current index in the 'caerPCMIteratorCounter' variable of type
+ * 'int32_t' and the current read-only event in the 'caerPCMIteratorElement' variable
+ * of type caerPCMEventConst.
+ *
+ * PCM_PACKET: a valid PCMEventPacket pointer. Cannot be NULL.
+ */
+#define CAER_PCM_CONST_REVERSE_ITERATOR_VALID_START(PCM_PACKET) \
+	for (int32_t caerPCMIteratorCounter = caerEventPacketHeaderGetEventNumber(&(PCM_PACKET)->packetHeader) - 1; \
+		caerPCMIteratorCounter >= 0; \
+		caerPCMIteratorCounter--) { \
+		caerPCMEventConst caerPCMIteratorElement = caerPCMEventPacketGetEventConstUnchecked(PCM_PACKET, caerPCMIteratorCounter); \
+		if (!caerPCMEventIsValid(caerPCMIteratorElement)) { continue; } // Skip invalid PCM events.
+
+/**
+ * Reverse iterator close statement.
+ */
+#define CAER_PCM_REVERSE_ITERATOR_VALID_END }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBCAER_EVENTS_PCM_H_ */
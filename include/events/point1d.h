@@ -100,7 +100,7 @@ caerPoint1DEventPacket caerPoint1DEventPacketAllocate(int32_t eventCapacity, int
  */
 static inline caerPoint1DEvent caerPoint1DEventPacketGetEvent(caerPoint1DEventPacket packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Point1D Event",
 			"Called caerPoint1DEventPacketGetEvent() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -122,7 +122,7 @@ static inline caerPoint1DEvent caerPoint1DEventPacketGetEvent(caerPoint1DEventPa
  */
 static inline caerPoint1DEventConst caerPoint1DEventPacketGetEventConst(caerPoint1DEventPacketConst packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Point1D Event",
 			"Called caerPoint1DEventPacketGetEventConst() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -133,6 +133,35 @@ static inline caerPoint1DEventConst caerPoint1DEventPacketGetEventConst(caerPoin
 	return (packet->events + n);
 }
 
+/**
+ * Get the Point1D event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ *
+ * @param packet a valid Point1DEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested Point1D event.
+ */
+static inline caerPoint1DEvent caerPoint1DEventPacketGetEventUnchecked(caerPoint1DEventPacket packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
+/**
+ * Get the Point1D event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ * This is a read-only event, do not change its contents in any way!
+ *
+ * @param packet a valid Point1DEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested read-only Point1D event.
+ */
+static inline caerPoint1DEventConst caerPoint1DEventPacketGetEventConstUnchecked(caerPoint1DEventPacketConst packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
 /**
  * Get the 32bit event timestamp, in microseconds.
  * Be aware that this wraps around! You can either ignore this fact,
@@ -202,7 +231,7 @@ static inline bool caerPoint1DEventIsValid(caerPoint1DEventConst event) {
  * @param packet the Point1DEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerPoint1DEventValidate(caerPoint1DEvent event, caerPoint1DEventPacket packet) {
-	if (!caerPoint1DEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(!caerPoint1DEventIsValid(event))) {
 		SET_NUMBITS32(event->info, VALID_MARK_SHIFT, VALID_MARK_MASK, 1);
 
 		// Also increase number of events and valid events.
@@ -227,7 +256,7 @@ static inline void caerPoint1DEventValidate(caerPoint1DEvent event, caerPoint1DE
  * @param packet the Point1DEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerPoint1DEventInvalidate(caerPoint1DEvent event, caerPoint1DEventPacket packet) {
-	if (caerPoint1DEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(caerPoint1DEventIsValid(event))) {
 		CLEAR_NUMBITS32(event->info, VALID_MARK_SHIFT, VALID_MARK_MASK);
 
 		// Also decrease number of valid events. Number of total events doesn't change.
@@ -327,7 +356,7 @@ static inline void caerPoint1DEventSetX(caerPoint1DEvent event, float x) {
 	for (int32_t caerPoint1DIteratorCounter = 0; \
 		caerPoint1DIteratorCounter < caerEventPacketHeaderGetEventNumber(&(POINT1D_PACKET)->packetHeader); \
 		caerPoint1DIteratorCounter++) { \
-		caerPoint1DEvent caerPoint1DIteratorElement = caerPoint1DEventPacketGetEvent(POINT1D_PACKET, caerPoint1DIteratorCounter);
+		caerPoint1DEvent caerPoint1DIteratorElement = caerPoint1DEventPacketGetEventUnchecked(POINT1D_PACKET, caerPoint1DIteratorCounter);
 
 /**
  * Const-Iterator over all Point1D events in a packet.
@@ -341,7 +370,7 @@ static inline void caerPoint1DEventSetX(caerPoint1DEvent event, float x) {
 	for (int32_t caerPoint1DIteratorCounter = 0; \
 		caerPoint1DIteratorCounter < caerEventPacketHeaderGetEventNumber(&(POINT1D_PACKET)->packetHeader); \
 		caerPoint1DIteratorCounter++) { \
-		caerPoint1DEventConst caerPoint1DIteratorElement = caerPoint1DEventPacketGetEventConst(POINT1D_PACKET, caerPoint1DIteratorCounter);
+		caerPoint1DEventConst caerPoint1DIteratorElement = caerPoint1DEventPacketGetEventConstUnchecked(POINT1D_PACKET, caerPoint1DIteratorCounter);
 
 /**
  * Iterator close statement.
@@ -360,7 +389,7 @@ static inline void caerPoint1DEventSetX(caerPoint1DEvent event, float x) {
 	for (int32_t caerPoint1DIteratorCounter = 0; \
 		caerPoint1DIteratorCounter < caerEventPacketHeaderGetEventNumber(&(POINT1D_PACKET)->packetHeader); \
 		caerPoint1DIteratorCounter++) { \
-		caerPoint1DEvent caerPoint1DIteratorElement = caerPoint1DEventPacketGetEvent(POINT1D_PACKET, caerPoint1DIteratorCounter); \
+		caerPoint1DEvent caerPoint1DIteratorElement = caerPoint1DEventPacketGetEventUnchecked(POINT1D_PACKET, caerPoint1DIteratorCounter); \
 		if (!caerPoint1DEventIsValid(caerPoint1DIteratorElement)) { continue; } // Skip invalid Point1D events.
 
 /**
@@ -375,7 +404,7 @@ static inline void caerPoint1DEventSetX(caerPoint1DEvent event, float x) {
 	for (int32_t caerPoint1DIteratorCounter = 0; \
 		caerPoint1DIteratorCounter < caerEventPacketHeaderGetEventNumber(&(POINT1D_PACKET)->packetHeader); \
 		caerPoint1DIteratorCounter++) { \
-		caerPoint1DEventConst caerPoint1DIteratorElement = caerPoint1DEventPacketGetEventConst(POINT1D_PACKET, caerPoint1DIteratorCounter); \
+		caerPoint1DEventConst caerPoint1DIteratorElement = caerPoint1DEventPacketGetEventConstUnchecked(POINT1D_PACKET, caerPoint1DIteratorCounter); \
 		if (!caerPoint1DEventIsValid(caerPoint1DIteratorElement)) { continue; } // Skip invalid Point1D events.
 
 /**
@@ -395,7 +424,7 @@ static inline void caerPoint1DEventSetX(caerPoint1DEvent event, float x) {
 	for (int32_t caerPoint1DIteratorCounter = caerEventPacketHeaderGetEventNumber(&(POINT1D_PACKET)->packetHeader) - 1; \
 		caerPoint1DIteratorCounter >= 0; \
 		caerPoint1DIteratorCounter--) { \
-		caerPoint1DEvent caerPoint1DIteratorElement = caerPoint1DEventPacketGetEvent(POINT1D_PACKET, caerPoint1DIteratorCounter);
+		caerPoint1DEvent caerPoint1DIteratorElement = caerPoint1DEventPacketGetEventUnchecked(POINT1D_PACKET, caerPoint1DIteratorCounter);
 /**
  * Const-Reverse iterator over all Point1D events in a packet.
  * Returns the current index in the 'caerPoint1DIteratorCounter' variable of type
@@ -408,7 +437,7 @@ static inline void caerPoint1DEventSetX(caerPoint1DEvent event, float x) {
 	for (int32_t caerPoint1DIteratorCounter = caerEventPacketHeaderGetEventNumber(&(POINT1D_PACKET)->packetHeader) - 1; \
 		caerPoint1DIteratorCounter >= 0; \
 		caerPoint1DIteratorCounter--) { \
-		caerPoint1DEventConst caerPoint1DIteratorElement = caerPoint1DEventPacketGetEventConst(POINT1D_PACKET, caerPoint1DIteratorCounter);
+		caerPoint1DEventConst caerPoint1DIteratorElement = caerPoint1DEventPacketGetEventConstUnchecked(POINT1D_PACKET, caerPoint1DIteratorCounter);
 
 /**
  * Reverse iterator close statement.
@@ -427,7 +456,7 @@ static inline void caerPoint1DEventSetX(caerPoint1DEvent event, float x) {
 	for (int32_t caerPoint1DIteratorCounter = caerEventPacketHeaderGetEventNumber(&(POINT1D_PACKET)->packetHeader) - 1; \
 		caerPoint1DIteratorCounter >= 0; \
 		caerPoint1DIteratorCounter--) { \
-		caerPoint1DEvent caerPoint1DIteratorElement = caerPoint1DEventPacketGetEvent(POINT1D_PACKET, caerPoint1DIteratorCounter); \
+		caerPoint1DEvent caerPoint1DIteratorElement = caerPoint1DEventPacketGetEventUnchecked(POINT1D_PACKET, caerPoint1DIteratorCounter); \
 		if (!caerPoint1DEventIsValid(caerPoint1DIteratorElement)) { continue; } // Skip invalid Point1D events.
 
 /**
@@ -442,7 +471,7 @@ static inline void caerPoint1DEventSetX(caerPoint1DEvent event, float x) {
 	for (int32_t caerPoint1DIteratorCounter = caerEventPacketHeaderGetEventNumber(&(POINT1D_PACKET)->packetHeader) - 1; \
 		caerPoint1DIteratorCounter >= 0; \
 		caerPoint1DIteratorCounter--) { \
-		caerPoint1DEventConst caerPoint1DIteratorElement = caerPoint1DEventPacketGetEventConst(POINT1D_PACKET, caerPoint1DIteratorCounter); \
+		caerPoint1DEventConst caerPoint1DIteratorElement = caerPoint1DEventPacketGetEventConstUnchecked(POINT1D_PACKET, caerPoint1DIteratorCounter); \
 		if (!caerPoint1DEventIsValid(caerPoint1DIteratorElement)) { continue; } // Skip invalid Point1D events.
 
 /**
@@ -102,7 +102,7 @@ caerPoint2DEventPacket caerPoint2DEventPacketAllocate(int32_t eventCapacity, int
  */
 static inline caerPoint2DEvent caerPoint2DEventPacketGetEvent(caerPoint2DEventPacket packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Point2D Event",
 			"Called caerPoint2DEventPacketGetEvent() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -124,7 +124,7 @@ static inline caerPoint2DEvent caerPoint2DEventPacketGetEvent(caerPoint2DEventPa
  */
 static inline caerPoint2DEventConst caerPoint2DEventPacketGetEventConst(caerPoint2DEventPacketConst packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Point2D Event",
 			"Called caerPoint2DEventPacketGetEventConst() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -135,6 +135,35 @@ static inline caerPoint2DEventConst caerPoint2DEventPacketGetEventConst(caerPoin
 	return (packet->events + n);
 }
 
+/**
+ * Get the Point2D event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ *
+ * @param packet a valid Point2DEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested Point2D event.
+ */
+static inline caerPoint2DEvent caerPoint2DEventPacketGetEventUnchecked(caerPoint2DEventPacket packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
+/**
+ * Get the Point2D event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ * This is a read-only event, do not change its contents in any way!
+ *
+ * @param packet a valid Point2DEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested read-only Point2D event.
+ */
+static inline caerPoint2DEventConst caerPoint2DEventPacketGetEventConstUnchecked(caerPoint2DEventPacketConst packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
 /**
  * Get the 32bit event timestamp, in microseconds.
  * Be aware that this wraps around! You can either ignore this fact,
@@ -204,7 +233,7 @@ static inline bool caerPoint2DEventIsValid(caerPoint2DEventConst event) {
  * @param packet the Point2DEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerPoint2DEventValidate(caerPoint2DEvent event, caerPoint2DEventPacket packet) {
-	if (!caerPoint2DEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(!caerPoint2DEventIsValid(event))) {
 		SET_NUMBITS32(event->info, VALID_MARK_SHIFT, VALID_MARK_MASK, 1);
 
 		// Also increase number of events and valid events.
@@ -229,7 +258,7 @@ static inline void caerPoint2DEventValidate(caerPoint2DEvent event, caerPoint2DE
  * @param packet the Point2DEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerPoint2DEventInvalidate(caerPoint2DEvent event, caerPoint2DEventPacket packet) {
-	if (caerPoint2DEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(caerPoint2DEventIsValid(event))) {
 		CLEAR_NUMBITS32(event->info, VALID_MARK_SHIFT, VALID_MARK_MASK);
 
 		// Also decrease number of valid events. Number of total events doesn't change.
@@ -350,7 +379,7 @@ static inline void caerPoint2DEventSetY(caerPoint2DEvent event, float y) {
 	for (int32_t caerPoint2DIteratorCounter = 0; \
 		caerPoint2DIteratorCounter < caerEventPacketHeaderGetEventNumber(&(POINT2D_PACKET)->packetHeader); \
 		caerPoint2DIteratorCounter++) { \
-		caerPoint2DEvent caerPoint2DIteratorElement = caerPoint2DEventPacketGetEvent(POINT2D_PACKET, caerPoint2DIteratorCounter);
+		caerPoint2DEvent caerPoint2DIteratorElement = caerPoint2DEventPacketGetEventUnchecked(POINT2D_PACKET, caerPoint2DIteratorCounter);
 
 /**
  * Const-Iterator over all Point2D events in a packet.
@@ -364,7 +393,7 @@ static inline void caerPoint2DEventSetY(caerPoint2DEvent event, float y) {
 	for (int32_t caerPoint2DIteratorCounter = 0; \
 		caerPoint2DIteratorCounter < caerEventPacketHeaderGetEventNumber(&(POINT2D_PACKET)->packetHeader); \
 		caerPoint2DIteratorCounter++) { \
-		caerPoint2DEventConst caerPoint2DIteratorElement = caerPoint2DEventPacketGetEventConst(POINT2D_PACKET, caerPoint2DIteratorCounter);
+		caerPoint2DEventConst caerPoint2DIteratorElement = caerPoint2DEventPacketGetEventConstUnchecked(POINT2D_PACKET, caerPoint2DIteratorCounter);
 
 /**
  * Iterator close statement.
@@ -383,7 +412,7 @@ static inline void caerPoint2DEventSetY(caerPoint2DEvent event, float y) {
 	for (int32_t caerPoint2DIteratorCounter = 0; \
 		caerPoint2DIteratorCounter < caerEventPacketHeaderGetEventNumber(&(POINT2D_PACKET)->packetHeader); \
 		caerPoint2DIteratorCounter++) { \
-		caerPoint2DEvent caerPoint2DIteratorElement = caerPoint2DEventPacketGetEvent(POINT2D_PACKET, caerPoint2DIteratorCounter); \
+		caerPoint2DEvent caerPoint2DIteratorElement = caerPoint2DEventPacketGetEventUnchecked(POINT2D_PACKET, caerPoint2DIteratorCounter); \
 		if (!caerPoint2DEventIsValid(caerPoint2DIteratorElement)) { continue; } // Skip invalid Point2D events.
 
 /**
@@ -398,7 +427,7 @@ static inline void caerPoint2DEventSetY(caerPoint2DEvent event, float y) {
 	for (int32_t caerPoint2DIteratorCounter = 0; \
 		caerPoint2DIteratorCounter < caerEventPacketHeaderGetEventNumber(&(POINT2D_PACKET)->packetHeader); \
 		caerPoint2DIteratorCounter++) { \
-		caerPoint2DEventConst caerPoint2DIteratorElement = caerPoint2DEventPacketGetEventConst(POINT2D_PACKET, caerPoint2DIteratorCounter); \
+		caerPoint2DEventConst caerPoint2DIteratorElement = caerPoint2DEventPacketGetEventConstUnchecked(POINT2D_PACKET, caerPoint2DIteratorCounter); \
 		if (!caerPoint2DEventIsValid(caerPoint2DIteratorElement)) { continue; } // Skip invalid Point2D events.
 
 /**
@@ -418,7 +447,7 @@ static inline void caerPoint2DEventSetY(caerPoint2DEvent event, float y) {
 	for (int32_t caerPoint2DIteratorCounter = caerEventPacketHeaderGetEventNumber(&(POINT2D_PACKET)->packetHeader) - 1; \
 		caerPoint2DIteratorCounter >= 0; \
 		caerPoint2DIteratorCounter--) { \
-		caerPoint2DEvent caerPoint2DIteratorElement = caerPoint2DEventPacketGetEvent(POINT2D_PACKET, caerPoint2DIteratorCounter);
+		caerPoint2DEvent caerPoint2DIteratorElement = caerPoint2DEventPacketGetEventUnchecked(POINT2D_PACKET, caerPoint2DIteratorCounter);
 /**
  * Const-Reverse iterator over all Point2D events in a packet.
  * Returns the current index in the 'caerPoint2DIteratorCounter' variable of type
@@ -431,7 +460,7 @@ static inline void caerPoint2DEventSetY(caerPoint2DEvent event, float y) {
 	for (int32_t caerPoint2DIteratorCounter = caerEventPacketHeaderGetEventNumber(&(POINT2D_PACKET)->packetHeader) - 1; \
 		caerPoint2DIteratorCounter >= 0; \
 		caerPoint2DIteratorCounter--) { \
-		caerPoint2DEventConst caerPoint2DIteratorElement = caerPoint2DEventPacketGetEventConst(POINT2D_PACKET, caerPoint2DIteratorCounter);
+		caerPoint2DEventConst caerPoint2DIteratorElement = caerPoint2DEventPacketGetEventConstUnchecked(POINT2D_PACKET, caerPoint2DIteratorCounter);
 
 /**
  * Reverse iterator close statement.
@@ -450,7 +479,7 @@ static inline void caerPoint2DEventSetY(caerPoint2DEvent event, float y) {
 	for (int32_t caerPoint2DIteratorCounter = caerEventPacketHeaderGetEventNumber(&(POINT2D_PACKET)->packetHeader) - 1; \
 		caerPoint2DIteratorCounter >= 0; \
 		caerPoint2DIteratorCounter--) { \
-		caerPoint2DEvent caerPoint2DIteratorElement = caerPoint2DEventPacketGetEvent(POINT2D_PACKET, caerPoint2DIteratorCounter); \
+		caerPoint2DEvent caerPoint2DIteratorElement = caerPoint2DEventPacketGetEventUnchecked(POINT2D_PACKET, caerPoint2DIteratorCounter); \
 		if (!caerPoint2DEventIsValid(caerPoint2DIteratorElement)) { continue; } // Skip invalid Point2D events.
 
 /**
@@ -465,7 +494,7 @@ static inline void caerPoint2DEventSetY(caerPoint2DEvent event, float y) {
 	for (int32_t caerPoint2DIteratorCounter = caerEventPacketHeaderGetEventNumber(&(POINT2D_PACKET)->packetHeader) - 1; \
 		caerPoint2DIteratorCounter >= 0; \
 		caerPoint2DIteratorCounter--) { \
-		caerPoint2DEventConst caerPoint2DIteratorElement = caerPoint2DEventPacketGetEventConst(POINT2D_PACKET, caerPoint2DIteratorCounter); \
+		caerPoint2DEventConst caerPoint2DIteratorElement = caerPoint2DEventPacketGetEventConstUnchecked(POINT2D_PACKET, caerPoint2DIteratorCounter); \
 		if (!caerPoint2DEventIsValid(caerPoint2DIteratorElement)) { continue; } // Skip invalid Point2D events.
 
 /**
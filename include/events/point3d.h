@@ -104,7 +104,7 @@ caerPoint3DEventPacket caerPoint3DEventPacketAllocate(int32_t eventCapacity, int
  */
 static inline caerPoint3DEvent caerPoint3DEventPacketGetEvent(caerPoint3DEventPacket packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Point3D Event",
 			"Called caerPoint3DEventPacketGetEvent() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -126,7 +126,7 @@ static inline caerPoint3DEvent caerPoint3DEventPacketGetEvent(caerPoint3DEventPa
  */
 static inline caerPoint3DEventConst caerPoint3DEventPacketGetEventConst(caerPoint3DEventPacketConst packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Point3D Event",
 			"Called caerPoint3DEventPacketGetEventConst() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -137,6 +137,35 @@ static inline caerPoint3DEventConst caerPoint3DEventPacketGetEventConst(caerPoin
 	return (packet->events + n);
 }
 
+/**
+ * Get the Point3D event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ *
+ * @param packet a valid Point3DEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested Point3D event.
+ */
+static inline caerPoint3DEvent caerPoint3DEventPacketGetEventUnchecked(caerPoint3DEventPacket packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
+/**
+ * Get the Point3D event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ * This is a read-only event, do not change its contents in any way!
+ *
+ * @param packet a valid Point3DEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested read-only Point3D event.
+ */
+static inline caerPoint3DEventConst caerPoint3DEventPacketGetEventConstUnchecked(caerPoint3DEventPacketConst packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
 /**
  * Get the 32bit event timestamp, in microseconds.
  * Be aware that this wraps around! You can either ignore this fact,
@@ -206,7 +235,7 @@ static inline bool caerPoint3DEventIsValid(caerPoint3DEventConst event) {
  * @param packet the Point3DEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerPoint3DEventValidate(caerPoint3DEvent event, caerPoint3DEventPacket packet) {
-	if (!caerPoint3DEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(!caerPoint3DEventIsValid(event))) {
 		SET_NUMBITS32(event->info, VALID_MARK_SHIFT, VALID_MARK_MASK, 1);
 
 		// Also increase number of events and valid events.
@@ -231,7 +260,7 @@ static inline void caerPoint3DEventValidate(caerPoint3DEvent event, caerPoint3DE
  * @param packet the Point3DEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerPoint3DEventInvalidate(caerPoint3DEvent event, caerPoint3DEventPacket packet) {
-	if (caerPoint3DEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(caerPoint3DEventIsValid(event))) {
 		CLEAR_NUMBITS32(event->info, VALID_MARK_SHIFT, VALID_MARK_MASK);
 
 		// Also decrease number of valid events. Number of total events doesn't change.
@@ -373,7 +402,7 @@ static inline void caerPoint3DEventSetZ(caerPoint3DEvent event, float z) {
 	for (int32_t caerPoint3DIteratorCounter = 0; \
 		caerPoint3DIteratorCounter < caerEventPacketHeaderGetEventNumber(&(POINT3D_PACKET)->packetHeader); \
 		caerPoint3DIteratorCounter++) { \
-		caerPoint3DEvent caerPoint3DIteratorElement = caerPoint3DEventPacketGetEvent(POINT3D_PACKET, caerPoint3DIteratorCounter);
+		caerPoint3DEvent caerPoint3DIteratorElement = caerPoint3DEventPacketGetEventUnchecked(POINT3D_PACKET, caerPoint3DIteratorCounter);
 
 /**
  * Const-Iterator over all Point3D events in a packet.
@@ -387,7 +416,7 @@ static inline void caerPoint3DEventSetZ(caerPoint3DEvent event, float z) {
 	for (int32_t caerPoint3DIteratorCounter = 0; \
 		caerPoint3DIteratorCounter < caerEventPacketHeaderGetEventNumber(&(POINT3D_PACKET)->packetHeader); \
 		caerPoint3DIteratorCounter++) { \
-		caerPoint3DEventConst caerPoint3DIteratorElement = caerPoint3DEventPacketGetEventConst(POINT3D_PACKET, caerPoint3DIteratorCounter);
+		caerPoint3DEventConst caerPoint3DIteratorElement = caerPoint3DEventPacketGetEventConstUnchecked(POINT3D_PACKET, caerPoint3DIteratorCounter);
 
 /**
  * Iterator close statement.
@@ -406,7 +435,7 @@ static inline void caerPoint3DEventSetZ(caerPoint3DEvent event, float z) {
 	for (int32_t caerPoint3DIteratorCounter = 0; \
 		caerPoint3DIteratorCounter < caerEventPacketHeaderGetEventNumber(&(POINT3D_PACKET)->packetHeader); \
 		caerPoint3DIteratorCounter++) { \
-		caerPoint3DEvent caerPoint3DIteratorElement = caerPoint3DEventPacketGetEvent(POINT3D_PACKET, caerPoint3DIteratorCounter); \
+		caerPoint3DEvent caerPoint3DIteratorElement = caerPoint3DEventPacketGetEventUnchecked(POINT3D_PACKET, caerPoint3DIteratorCounter); \
 		if (!caerPoint3DEventIsValid(caerPoint3DIteratorElement)) { continue; } // Skip invalid Point3D events.
 
 /**
@@ -421,7 +450,7 @@ static inline void caerPoint3DEventSetZ(caerPoint3DEvent event, float z) {
 	for (int32_t caerPoint3DIteratorCounter = 0; \
 		caerPoint3DIteratorCounter < caerEventPacketHeaderGetEventNumber(&(POINT3D_PACKET)->packetHeader); \
 		caerPoint3DIteratorCounter++) { \
-		caerPoint3DEventConst caerPoint3DIteratorElement = caerPoint3DEventPacketGetEventConst(POINT3D_PACKET, caerPoint3DIteratorCounter); \
+		caerPoint3DEventConst caerPoint3DIteratorElement = caerPoint3DEventPacketGetEventConstUnchecked(POINT3D_PACKET, caerPoint3DIteratorCounter); \
 		if (!caerPoint3DEventIsValid(caerPoint3DIteratorElement)) { continue; } // Skip invalid Point3D events.
 
 /**
@@ -441,7 +470,7 @@ static inline void caerPoint3DEventSetZ(caerPoint3DEvent event, float z) {
 	for (int32_t caerPoint3DIteratorCounter = caerEventPacketHeaderGetEventNumber(&(POINT3D_PACKET)->packetHeader) - 1; \
 		caerPoint3DIteratorCounter >= 0; \
 		caerPoint3DIteratorCounter--) { \
-		caerPoint3DEvent caerPoint3DIteratorElement = caerPoint3DEventPacketGetEvent(POINT3D_PACKET, caerPoint3DIteratorCounter);
+		caerPoint3DEvent caerPoint3DIteratorElement = caerPoint3DEventPacketGetEventUnchecked(POINT3D_PACKET, caerPoint3DIteratorCounter);
 /**
  * Const-Reverse iterator over all Point3D events in a packet.
  * Returns the current index in the 'caerPoint3DIteratorCounter' variable of type
@@ -454,7 +483,7 @@ static inline void caerPoint3DEventSetZ(caerPoint3DEvent event, float z) {
 	for (int32_t caerPoint3DIteratorCounter = caerEventPacketHeaderGetEventNumber(&(POINT3D_PACKET)->packetHeader) - 1; \
 		caerPoint3DIteratorCounter >= 0; \
 		caerPoint3DIteratorCounter--) { \
-		caerPoint3DEventConst caerPoint3DIteratorElement = caerPoint3DEventPacketGetEventConst(POINT3D_PACKET, caerPoint3DIteratorCounter);
+		caerPoint3DEventConst caerPoint3DIteratorElement = caerPoint3DEventPacketGetEventConstUnchecked(POINT3D_PACKET, caerPoint3DIteratorCounter);
 
 /**
  * Reverse iterator close statement.
@@ -473,7 +502,7 @@ static inline void caerPoint3DEventSetZ(caerPoint3DEvent event, float z) {
 	for (int32_t caerPoint3DIteratorCounter = caerEventPacketHeaderGetEventNumber(&(POINT3D_PACKET)->packetHeader) - 1; \
 		caerPoint3DIteratorCounter >= 0; \
 		caerPoint3DIteratorCounter--) { \
-		caerPoint3DEvent caerPoint3DIteratorElement = caerPoint3DEventPacketGetEvent(POINT3D_PACKET, caerPoint3DIteratorCounter); \
+		caerPoint3DEvent caerPoint3DIteratorElement = caerPoint3DEventPacketGetEventUnchecked(POINT3D_PACKET, caerPoint3DIteratorCounter); \
 		if (!caerPoint3DEventIsValid(caerPoint3DIteratorElement)) { continue; } // Skip invalid Point3D events.
 
 /**
@@ -488,7 +517,7 @@ static inline void caerPoint3DEventSetZ(caerPoint3DEvent event, float z) {
 	for (int32_t caerPoint3DIteratorCounter = caerEventPacketHeaderGetEventNumber(&(POINT3D_PACKET)->packetHeader) - 1; \
 		caerPoint3DIteratorCounter >= 0; \
 		caerPoint3DIteratorCounter--) { \
-		caerPoint3DEventConst caerPoint3DIteratorElement = caerPoint3DEventPacketGetEventConst(POINT3D_PACKET, caerPoint3DIteratorCounter); \
+		caerPoint3DEventConst caerPoint3DIteratorElement = caerPoint3DEventPacketGetEventConstUnchecked(POINT3D_PACKET, caerPoint3DIteratorCounter); \
 		if (!caerPoint3DEventIsValid(caerPoint3DIteratorElement)) { continue; } // Skip invalid Point3D events.
 
 /**
@@ -107,7 +107,7 @@ caerPoint4DEventPacket caerPoint4DEventPacketAllocate(int32_t eventCapacity, int
  */
 static inline caerPoint4DEvent caerPoint4DEventPacketGetEvent(caerPoint4DEventPacket packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Point4D Event",
 			"Called caerPoint4DEventPacketGetEvent() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -129,7 +129,7 @@ static inline caerPoint4DEvent caerPoint4DEventPacketGetEvent(caerPoint4DEventPa
  */
 static inline caerPoint4DEventConst caerPoint4DEventPacketGetEventConst(caerPoint4DEventPacketConst packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Point4D Event",
 			"Called caerPoint4DEventPacketGetEventConst() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -140,6 +140,35 @@ static inline caerPoint4DEventConst caerPoint4DEventPacketGetEventConst(caerPoin
 	return (packet->events + n);
 }
 
+/**
+ * Get the Point4D event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ *
+ * @param packet a valid Point4DEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested Point4D event.
+ */
+static inline caerPoint4DEvent caerPoint4DEventPacketGetEventUnchecked(caerPoint4DEventPacket packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
+/**
+ * Get the Point4D event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ * This is a read-only event, do not change its contents in any way!
+ *
+ * @param packet a valid Point4DEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested read-only Point4D event.
+ */
+static inline caerPoint4DEventConst caerPoint4DEventPacketGetEventConstUnchecked(caerPoint4DEventPacketConst packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
 /**
  * Get the 32bit event timestamp, in microseconds.
  * Be aware that this wraps around! You can either ignore this fact,
@@ -209,7 +238,7 @@ static inline bool caerPoint4DEventIsValid(caerPoint4DEventConst event) {
  * @param packet the Point4DEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerPoint4DEventValidate(caerPoint4DEvent event, caerPoint4DEventPacket packet) {
-	if (!caerPoint4DEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(!caerPoint4DEventIsValid(event))) {
 		SET_NUMBITS32(event->info, VALID_MARK_SHIFT, VALID_MARK_MASK, 1);
 
 		// Also increase number of events and valid events.
@@ -234,7 +263,7 @@ static inline void caerPoint4DEventValidate(caerPoint4DEvent event, caerPoint4DE
  * @param packet the Point4DEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerPoint4DEventInvalidate(caerPoint4DEvent event, caerPoint4DEventPacket packet) {
-	if (caerPoint4DEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(caerPoint4DEventIsValid(event))) {
 		CLEAR_NUMBITS32(event->info, VALID_MARK_SHIFT, VALID_MARK_MASK);
 
 		// Also decrease number of valid events. Number of total events doesn't change.
@@ -397,7 +426,7 @@ static inline void caerPoint4DEventSetW(caerPoint4DEvent event, float w) {
 	for (int32_t caerPoint4DIteratorCounter = 0; \
 		caerPoint4DIteratorCounter < caerEventPacketHeaderGetEventNumber(&(POINT4D_PACKET)->packetHeader); \
 		caerPoint4DIteratorCounter++) { \
-		caerPoint4DEvent caerPoint4DIteratorElement = caerPoint4DEventPacketGetEvent(POINT4D_PACKET, caerPoint4DIteratorCounter);
+		caerPoint4DEvent caerPoint4DIteratorElement = caerPoint4DEventPacketGetEventUnchecked(POINT4D_PACKET, caerPoint4DIteratorCounter);
 
 /**
  * Const-Iterator over all Point4D events in a packet.
@@ -411,7 +440,7 @@ static inline void caerPoint4DEventSetW(caerPoint4DEvent event, float w) {
 	for (int32_t caerPoint4DIteratorCounter = 0; \
 		caerPoint4DIteratorCounter < caerEventPacketHeaderGetEventNumber(&(POINT4D_PACKET)->packetHeader); \
 		caerPoint4DIteratorCounter++) { \
-		caerPoint4DEventConst caerPoint4DIteratorElement = caerPoint4DEventPacketGetEventConst(POINT4D_PACKET, caerPoint4DIteratorCounter);
+		caerPoint4DEventConst caerPoint4DIteratorElement = caerPoint4DEventPacketGetEventConstUnchecked(POINT4D_PACKET, caerPoint4DIteratorCounter);
 
 /**
  * Iterator close statement.
@@ -430,7 +459,7 @@ static inline void caerPoint4DEventSetW(caerPoint4DEvent event, float w) {
 	for (int32_t caerPoint4DIteratorCounter = 0; \
 		caerPoint4DIteratorCounter < caerEventPacketHeaderGetEventNumber(&(POINT4D_PACKET)->packetHeader); \
 		caerPoint4DIteratorCounter++) { \
-		caerPoint4DEvent caerPoint4DIteratorElement = caerPoint4DEventPacketGetEvent(POINT4D_PACKET, caerPoint4DIteratorCounter); \
+		caerPoint4DEvent caerPoint4DIteratorElement = caerPoint4DEventPacketGetEventUnchecked(POINT4D_PACKET, caerPoint4DIteratorCounter); \
 		if (!caerPoint4DEventIsValid(caerPoint4DIteratorElement)) { continue; } // Skip invalid Point4D events.
 
 /**
@@ -445,7 +474,7 @@ static inline void caerPoint4DEventSetW(caerPoint4DEvent event, float w) {
 	for (int32_t caerPoint4DIteratorCounter = 0; \
 		caerPoint4DIteratorCounter < caerEventPacketHeaderGetEventNumber(&(POINT4D_PACKET)->packetHeader); \
 		caerPoint4DIteratorCounter++) { \
-		caerPoint4DEventConst caerPoint4DIteratorElement = caerPoint4DEventPacketGetEventConst(POINT4D_PACKET, caerPoint4DIteratorCounter); \
+		caerPoint4DEventConst caerPoint4DIteratorElement = caerPoint4DEventPacketGetEventConstUnchecked(POINT4D_PACKET, caerPoint4DIteratorCounter); \
 		if (!caerPoint4DEventIsValid(caerPoint4DIteratorElement)) { continue; } // Skip invalid Point4D events.
 
 /**
@@ -465,7 +494,7 @@ static inline void caerPoint4DEventSetW(caerPoint4DEvent event, float w) {
 	for (int32_t caerPoint4DIteratorCounter = caerEventPacketHeaderGetEventNumber(&(POINT4D_PACKET)->packetHeader) - 1; \
 		caerPoint4DIteratorCounter >= 0; \
 		caerPoint4DIteratorCounter--) { \
-		caerPoint4DEvent caerPoint4DIteratorElement = caerPoint4DEventPacketGetEvent(POINT4D_PACKET, caerPoint4DIteratorCounter);
+		caerPoint4DEvent caerPoint4DIteratorElement = caerPoint4DEventPacketGetEventUnchecked(POINT4D_PACKET, caerPoint4DIteratorCounter);
 /**
  * Const-Reverse iterator over all Point4D events in a packet.
  * Returns the current index in the 'caerPoint4DIteratorCounter' variable of type
@@ -478,7 +507,7 @@ static inline void caerPoint4DEventSetW(caerPoint4DEvent event, float w) {
 	for (int32_t caerPoint4DIteratorCounter = caerEventPacketHeaderGetEventNumber(&(POINT4D_PACKET)->packetHeader) - 1; \
 		caerPoint4DIteratorCounter >= 0; \
 		caerPoint4DIteratorCounter--) { \
-		caerPoint4DEventConst caerPoint4DIteratorElement = caerPoint4DEventPacketGetEventConst(POINT4D_PACKET, caerPoint4DIteratorCounter);
+		caerPoint4DEventConst caerPoint4DIteratorElement = caerPoint4DEventPacketGetEventConstUnchecked(POINT4D_PACKET, caerPoint4DIteratorCounter);
 
 /**
  * Reverse iterator close statement.
@@ -497,7 +526,7 @@ static inline void caerPoint4DEventSetW(caerPoint4DEvent event, float w) {
 	for (int32_t caerPoint4DIteratorCounter = caerEventPacketHeaderGetEventNumber(&(POINT4D_PACKET)->packetHeader) - 1; \
 		caerPoint4DIteratorCounter >= 0; \
 		caerPoint4DIteratorCounter--) { \
-		caerPoint4DEvent caerPoint4DIteratorElement = caerPoint4DEventPacketGetEvent(POINT4D_PACKET, caerPoint4DIteratorCounter); \
+		caerPoint4DEvent caerPoint4DIteratorElement = caerPoint4DEventPacketGetEventUnchecked(POINT4D_PACKET, caerPoint4DIteratorCounter); \
 		if (!caerPoint4DEventIsValid(caerPoint4DIteratorElement)) { continue; } // Skip invalid Point4D events.
 
 /**
@@ -512,7 +541,7 @@ static inline void caerPoint4DEventSetW(caerPoint4DEvent event, float w) {
 	for (int32_t caerPoint4DIteratorCounter = caerEventPacketHeaderGetEventNumber(&(POINT4D_PACKET)->packetHeader) - 1; \
 		caerPoint4DIteratorCounter >= 0; \
 		caerPoint4DIteratorCounter--) { \
-		caerPoint4DEventConst caerPoint4DIteratorElement = caerPoint4DEventPacketGetEventConst(POINT4D_PACKET, caerPoint4DIteratorCounter); \
+		caerPoint4DEventConst caerPoint4DIteratorElement = caerPoint4DEventPacketGetEventConstUnchecked(POINT4D_PACKET, caerPoint4DIteratorCounter); \
 		if (!caerPoint4DEventIsValid(caerPoint4DIteratorElement)) { continue; } // Skip invalid Point4D events.
 
 /**
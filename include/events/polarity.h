@@ -98,7 +98,7 @@ caerPolarityEventPacket caerPolarityEventPacketAllocate(int32_t eventCapacity, i
  */
 static inline caerPolarityEvent caerPolarityEventPacketGetEvent(caerPolarityEventPacket packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Polarity Event",
 			"Called caerPolarityEventPacketGetEvent() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -120,7 +120,7 @@ static inline caerPolarityEvent caerPolarityEventPacketGetEvent(caerPolarityEven
  */
 static inline caerPolarityEventConst caerPolarityEventPacketGetEventConst(caerPolarityEventPacketConst packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Polarity Event",
 			"Called caerPolarityEventPacketGetEventConst() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -131,6 +131,35 @@ static inline caerPolarityEventConst caerPolarityEventPacketGetEventConst(caerPo
 	return (packet->events + n);
 }
 
+/**
+ * Get the polarity event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ *
+ * @param packet a valid PolarityEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested polarity event.
+ */
+static inline caerPolarityEvent caerPolarityEventPacketGetEventUnchecked(caerPolarityEventPacket packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
+/**
+ * Get the polarity event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ * This is a read-only event, do not change its contents in any way!
+ *
+ * @param packet a valid PolarityEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested read-only polarity event.
+ */
+static inline caerPolarityEventConst caerPolarityEventPacketGetEventConstUnchecked(caerPolarityEventPacketConst packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
 /**
  * Get the 32bit event timestamp, in microseconds.
  * Be aware that this wraps around! You can either ignore this fact,
@@ -200,7 +229,7 @@ static inline bool caerPolarityEventIsValid(caerPolarityEventConst event) {
  * @param packet the PolarityEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerPolarityEventValidate(caerPolarityEvent event, caerPolarityEventPacket packet) {
-	if (!caerPolarityEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(!caerPolarityEventIsValid(event))) {
 		SET_NUMBITS32(event->data, VALID_MARK_SHIFT, VALID_MARK_MASK, 1);
 
 		// Also increase number of events and valid events.
@@ -225,7 +254,7 @@ static inline void caerPolarityEventValidate(caerPolarityEvent event, caerPolari
  * @param packet the PolarityEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerPolarityEventInvalidate(caerPolarityEvent event, caerPolarityEventPacket packet) {
-	if (caerPolarityEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(caerPolarityEventIsValid(event))) {
 		CLEAR_NUMBITS32(event->data, VALID_MARK_SHIFT, VALID_MARK_MASK);
 
 		// Also decrease number of valid events. Number of total events doesn't change.
@@ -320,7 +349,7 @@ static inline void caerPolarityEventSetX(caerPolarityEvent event, uint16_t xAddr
 	for (int32_t caerPolarityIteratorCounter = 0; \
 		caerPolarityIteratorCounter < caerEventPacketHeaderGetEventNumber(&(POLARITY_PACKET)->packetHeader); \
 		caerPolarityIteratorCounter++) { \
-		caerPolarityEvent caerPolarityIteratorElement = caerPolarityEventPacketGetEvent(POLARITY_PACKET, caerPolarityIteratorCounter);
+		caerPolarityEvent caerPolarityIteratorElement = caerPolarityEventPacketGetEventUnchecked(POLARITY_PACKET, caerPolarityIteratorCounter);
 
 /**
  * Const-Iterator over all polarity events in a packet.
@@ -334,7 +363,7 @@ static inline void caerPolarityEventSetX(caerPolarityEvent event, uint16_t xAddr
 	for (int32_t caerPolarityIteratorCounter = 0; \
 		caerPolarityIteratorCounter < caerEventPacketHeaderGetEventNumber(&(POLARITY_PACKET)->packetHeader); \
 		caerPolarityIteratorCounter++) { \
-		caerPolarityEventConst caerPolarityIteratorElement = caerPolarityEventPacketGetEventConst(POLARITY_PACKET, caerPolarityIteratorCounter);
+		caerPolarityEventConst caerPolarityIteratorElement = caerPolarityEventPacketGetEventConstUnchecked(POLARITY_PACKET, caerPolarityIteratorCounter);
 
 /**
  * Iterator close statement.
@@ -353,7 +382,7 @@ static inline void caerPolarityEventSetX(caerPolarityEvent event, uint16_t xAddr
 	for (int32_t caerPolarityIteratorCounter = 0; \
 		caerPolarityIteratorCounter < caerEventPacketHeaderGetEventNumber(&(POLARITY_PACKET)->packetHeader); \
 		caerPolarityIteratorCounter++) { \
-		caerPolarityEvent caerPolarityIteratorElement = caerPolarityEventPacketGetEvent(POLARITY_PACKET, caerPolarityIteratorCounter); \
+		caerPolarityEvent caerPolarityIteratorElement = caerPolarityEventPacketGetEventUnchecked(POLARITY_PACKET, caerPolarityIteratorCounter); \
 		if (!caerPolarityEventIsValid(caerPolarityIteratorElement)) { continue; } // Skip invalid polarity events.
 
 /**
@@ -368,7 +397,7 @@ static inline void caerPolarityEventSetX(caerPolarityEvent event, uint16_t xAddr
 	for (int32_t caerPolarityIteratorCounter = 0; \
 		caerPolarityIteratorCounter < caerEventPacketHeaderGetEventNumber(&(POLARITY_PACKET)->packetHeader); \
 		caerPolarityIteratorCounter++) { \
-		caerPolarityEventConst caerPolarityIteratorElement = caerPolarityEventPacketGetEventConst(POLARITY_PACKET, caerPolarityIteratorCounter); \
+		caerPolarityEventConst caerPolarityIteratorElement = caerPolarityEventPacketGetEventConstUnchecked(POLARITY_PACKET, caerPolarityIteratorCounter); \
 		if (!caerPolarityEventIsValid(caerPolarityIteratorElement)) { continue; } // Skip invalid polarity events.
 
 /**
@@ -388,7 +417,7 @@ static inline void caerPolarityEventSetX(caerPolarityEvent event, uint16_t xAddr
 	for (int32_t caerPolarityIteratorCounter = caerEventPacketHeaderGetEventNumber(&(POLARITY_PACKET)->packetHeader) - 1; \
 		caerPolarityIteratorCounter >= 0; \
 		caerPolarityIteratorCounter--) { \
-		caerPolarityEvent caerPolarityIteratorElement = caerPolarityEventPacketGetEvent(POLARITY_PACKET, caerPolarityIteratorCounter);
+		caerPolarityEvent caerPolarityIteratorElement = caerPolarityEventPacketGetEventUnchecked(POLARITY_PACKET, caerPolarityIteratorCounter);
 
 /**
  * Const-Reverse iterator over all polarity events in a packet.
@@ -402,7 +431,7 @@ static inline void caerPolarityEventSetX(caerPolarityEvent event, uint16_t xAddr
 	for (int32_t caerPolarityIteratorCounter = caerEventPacketHeaderGetEventNumber(&(POLARITY_PACKET)->packetHeader) - 1; \
 		caerPolarityIteratorCounter >= 0; \
 		caerPolarityIteratorCounter--) { \
-		caerPolarityEventConst caerPolarityIteratorElement = caerPolarityEventPacketGetEventConst(POLARITY_PACKET, caerPolarityIteratorCounter);
+		caerPolarityEventConst caerPolarityIteratorElement = caerPolarityEventPacketGetEventConstUnchecked(POLARITY_PACKET, caerPolarityIteratorCounter);
 
 /**
  * Reverse iterator close statement.
@@ -421,7 +450,7 @@ static inline void caerPolarityEventSetX(caerPolarityEvent event, uint16_t xAddr
 	for (int32_t caerPolarityIteratorCounter = caerEventPacketHeaderGetEventNumber(&(POLARITY_PACKET)->packetHeader) - 1; \
 		caerPolarityIteratorCounter >= 0; \
 		caerPolarityIteratorCounter--) { \
-		caerPolarityEvent caerPolarityIteratorElement = caerPolarityEventPacketGetEvent(POLARITY_PACKET, caerPolarityIteratorCounter); \
+		caerPolarityEvent caerPolarityIteratorElement = caerPolarityEventPacketGetEventUnchecked(POLARITY_PACKET, caerPolarityIteratorCounter); \
 		if (!caerPolarityEventIsValid(caerPolarityIteratorElement)) { continue; } // Skip invalid polarity events.
 
 /**
@@ -436,7 +465,7 @@ static inline void caerPolarityEventSetX(caerPolarityEvent event, uint16_t xAddr
 	for (int32_t caerPolarityIteratorCounter = caerEventPacketHeaderGetEventNumber(&(POLARITY_PACKET)->packetHeader) - 1; \
 		caerPolarityIteratorCounter >= 0; \
 		caerPolarityIteratorCounter--) { \
-		caerPolarityEventConst caerPolarityIteratorElement = caerPolarityEventPacketGetEventConst(POLARITY_PACKET, caerPolarityIteratorCounter); \
+		caerPolarityEventConst caerPolarityIteratorElement = caerPolarityEventPacketGetEventConstUnchecked(POLARITY_PACKET, caerPolarityIteratorCounter); \
 		if (!caerPolarityEventIsValid(caerPolarityIteratorElement)) { continue; } // Skip invalid polarity events.
 
 /**
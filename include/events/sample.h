@@ -94,7 +94,7 @@ caerSampleEventPacket caerSampleEventPacketAllocate(int32_t eventCapacity, int16
  */
 static inline caerSampleEvent caerSampleEventPacketGetEvent(caerSampleEventPacket packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Sample Event",
 			"Called caerSampleEventPacketGetEvent() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -116,7 +116,7 @@ static inline caerSampleEvent caerSampleEventPacketGetEvent(caerSampleEventPacke
  */
 static inline caerSampleEventConst caerSampleEventPacketGetEventConst(caerSampleEventPacketConst packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Sample Event",
 			"Called caerSampleEventPacketGetEventConst() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -127,6 +127,35 @@ static inline caerSampleEventConst caerSampleEventPacketGetEventConst(caerSample
 	return (packet->events + n);
 }
 
+/**
+ * Get the ADC sample event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ *
+ * @param packet a valid SampleEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested ADC sample event.
+ */
+static inline caerSampleEvent caerSampleEventPacketGetEventUnchecked(caerSampleEventPacket packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
+/**
+ * Get the ADC sample event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ * This is a read-only event, do not change its contents in any way!
+ *
+ * @param packet a valid SampleEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested read-only ADC sample event.
+ */
+static inline caerSampleEventConst caerSampleEventPacketGetEventConstUnchecked(caerSampleEventPacketConst packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
 /**
  * Get the 32bit event timestamp, in microseconds.
  * Be aware that this wraps around! You can either ignore this fact,
@@ -196,7 +225,7 @@ static inline bool caerSampleEventIsValid(caerSampleEventConst event) {
  * @param packet the SampleEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerSampleEventValidate(caerSampleEvent event, caerSampleEventPacket packet) {
-	if (!caerSampleEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(!caerSampleEventIsValid(event))) {
 		SET_NUMBITS32(event->data, VALID_MARK_SHIFT, VALID_MARK_MASK, 1);
 
 		// Also increase number of events and valid events.
@@ -221,7 +250,7 @@ static inline void caerSampleEventValidate(caerSampleEvent event, caerSampleEven
  * @param packet the SampleEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerSampleEventInvalidate(caerSampleEvent event, caerSampleEventPacket packet) {
-	if (caerSampleEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(caerSampleEventIsValid(event))) {
 		CLEAR_NUMBITS32(event->data, VALID_MARK_SHIFT, VALID_MARK_MASK);
 
 		// Also decrease number of valid events. Number of total events doesn't change.
@@ -296,7 +325,7 @@ static inline void caerSampleEventSetSample(caerSampleEvent event, uint32_t samp
 	for (int32_t caerSampleIteratorCounter = 0; \
 		caerSampleIteratorCounter < caerEventPacketHeaderGetEventNumber(&(SAMPLE_PACKET)->packetHeader); \
 		caerSampleIteratorCounter++) { \
-		caerSampleEvent caerSampleIteratorElement = caerSampleEventPacketGetEvent(SAMPLE_PACKET, caerSampleIteratorCounter);
+		caerSampleEvent caerSampleIteratorElement = caerSampleEventPacketGetEventUnchecked(SAMPLE_PACKET, caerSampleIteratorCounter);
 
 /**
  * Const-Iterator over all sample events in a packet.
@@ -310,7 +339,7 @@ static inline void caerSampleEventSetSample(caerSampleEvent event, uint32_t samp
 	for (int32_t caerSampleIteratorCounter = 0; \
 		caerSampleIteratorCounter < caerEventPacketHeaderGetEventNumber(&(SAMPLE_PACKET)->packetHeader); \
 		caerSampleIteratorCounter++) { \
-		caerSampleEventConst caerSampleIteratorElement = caerSampleEventPacketGetEventConst(SAMPLE_PACKET, caerSampleIteratorCounter);
+		caerSampleEventConst caerSampleIteratorElement = caerSampleEventPacketGetEventConstUnchecked(SAMPLE_PACKET, caerSampleIteratorCounter);
 
 /**
  * Iterator close statement.
@@ -329,7 +358,7 @@ static inline void caerSampleEventSetSample(caerSampleEvent event, uint32_t samp
 	for (int32_t caerSampleIteratorCounter = 0; \
 		caerSampleIteratorCounter < caerEventPacketHeaderGetEventNumber(&(SAMPLE_PACKET)->packetHeader); \
 		caerSampleIteratorCounter++) { \
-		caerSampleEvent caerSampleIteratorElement = caerSampleEventPacketGetEvent(SAMPLE_PACKET, caerSampleIteratorCounter); \
+		caerSampleEvent caerSampleIteratorElement = caerSampleEventPacketGetEventUnchecked(SAMPLE_PACKET, caerSampleIteratorCounter); \
 		if (!caerSampleEventIsValid(caerSampleIteratorElement)) { continue; } // Skip invalid sample events.
 
 /**
@@ -344,7 +373,7 @@ static inline void caerSampleEventSetSample(caerSampleEvent event, uint32_t samp
 	for (int32_t caerSampleIteratorCounter = 0; \
 		caerSampleIteratorCounter < caerEventPacketHeaderGetEventNumber(&(SAMPLE_PACKET)->packetHeader); \
 		caerSampleIteratorCounter++) { \
-		caerSampleEventConst caerSampleIteratorElement = caerSampleEventPacketGetEventConst(SAMPLE_PACKET, caerSampleIteratorCounter); \
+		caerSampleEventConst caerSampleIteratorElement = caerSampleEventPacketGetEventConstUnchecked(SAMPLE_PACKET, caerSampleIteratorCounter); \
 		if (!caerSampleEventIsValid(caerSampleIteratorElement)) { continue; } // Skip invalid sample events.
 
 /**
@@ -364,7 +393,7 @@ static inline void caerSampleEventSetSample(caerSampleEvent event, uint32_t samp
 	for (int32_t caerSampleIteratorCounter = caerEventPacketHeaderGetEventNumber(&(SAMPLE_PACKET)->packetHeader) - 1; \
 		caerSampleIteratorCounter >= 0; \
 		caerSampleIteratorCounter--) { \
-		caerSampleEvent caerSampleIteratorElement = caerSampleEventPacketGetEvent(SAMPLE_PACKET, caerSampleIteratorCounter);
+		caerSampleEvent caerSampleIteratorElement = caerSampleEventPacketGetEventUnchecked(SAMPLE_PACKET, caerSampleIteratorCounter);
 /**
  * Const-Reverse iterator over all sample events in a packet.
  * Returns the current index in the 'caerSampleIteratorCounter' variable of type
@@ -377,7 +406,7 @@ static inline void caerSampleEventSetSample(caerSampleEvent event, uint32_t samp
 	for (int32_t caerSampleIteratorCounter = caerEventPacketHeaderGetEventNumber(&(SAMPLE_PACKET)->packetHeader) - 1; \
 		caerSampleIteratorCounter >= 0; \
 		caerSampleIteratorCounter--) { \
-		caerSampleEventConst caerSampleIteratorElement = caerSampleEventPacketGetEventConst(SAMPLE_PACKET, caerSampleIteratorCounter);
+		caerSampleEventConst caerSampleIteratorElement = caerSampleEventPacketGetEventConstUnchecked(SAMPLE_PACKET, caerSampleIteratorCounter);
 
 /**
  * Reverse iterator close statement.
@@ -396,7 +425,7 @@ static inline void caerSampleEventSetSample(caerSampleEvent event, uint32_t samp
 	for (int32_t caerSampleIteratorCounter = caerEventPacketHeaderGetEventNumber(&(SAMPLE_PACKET)->packetHeader) - 1; \
 		caerSampleIteratorCounter >= 0; \
 		caerSampleIteratorCounter--) { \
-		caerSampleEvent caerSampleIteratorElement = caerSampleEventPacketGetEvent(SAMPLE_PACKET, caerSampleIteratorCounter); \
+		caerSampleEvent caerSampleIteratorElement = caerSampleEventPacketGetEventUnchecked(SAMPLE_PACKET, caerSampleIteratorCounter); \
 		if (!caerSampleEventIsValid(caerSampleIteratorElement)) { continue; } // Skip invalid sample events.
 
 /**
@@ -411,7 +440,7 @@ static inline void caerSampleEventSetSample(caerSampleEvent event, uint32_t samp
 	for (int32_t caerSampleIteratorCounter = caerEventPacketHeaderGetEventNumber(&(SAMPLE_PACKET)->packetHeader) - 1; \
 		caerSampleIteratorCounter >= 0; \
 		caerSampleIteratorCounter--) { \
-		caerSampleEventConst caerSampleIteratorElement = caerSampleEventPacketGetEventConst(SAMPLE_PACKET, caerSampleIteratorCounter); \
+		caerSampleEventConst caerSampleIteratorElement = caerSampleEventPacketGetEventConstUnchecked(SAMPLE_PACKET, caerSampleIteratorCounter); \
 		if (!caerSampleEventIsValid(caerSampleIteratorElement)) { continue; } // Skip invalid sample events.
 
 /**
@@ -116,7 +116,7 @@ caerSpecialEventPacket caerSpecialEventPacketAllocate(int32_t eventCapacity, int
  */
 static inline caerSpecialEvent caerSpecialEventPacketGetEvent(caerSpecialEventPacket packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Special Event",
 			"Called caerSpecialEventPacketGetEvent() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -138,7 +138,7 @@ static inline caerSpecialEvent caerSpecialEventPacketGetEvent(caerSpecialEventPa
  */
 static inline caerSpecialEventConst caerSpecialEventPacketGetEventConst(caerSpecialEventPacketConst packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Special Event",
 			"Called caerSpecialEventPacketGetEventConst() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -149,6 +149,35 @@ static inline caerSpecialEventConst caerSpecialEventPacketGetEventConst(caerSpec
 	return (packet->events + n);
 }
 
+/**
+ * Get the special event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ *
+ * @param packet a valid SpecialEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested special event.
+ */
+static inline caerSpecialEvent caerSpecialEventPacketGetEventUnchecked(caerSpecialEventPacket packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
+/**
+ * Get the special event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ * This is a read-only event, do not change its contents in any way!
+ *
+ * @param packet a valid SpecialEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested read-only special event.
+ */
+static inline caerSpecialEventConst caerSpecialEventPacketGetEventConstUnchecked(caerSpecialEventPacketConst packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
 /**
  * Get the 32bit event timestamp, in microseconds.
  * Be aware that this wraps around! You can either ignore this fact,
@@ -218,7 +247,7 @@ static inline bool caerSpecialEventIsValid(caerSpecialEventConst event) {
  * @param packet the SpecialEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerSpecialEventValidate(caerSpecialEvent event, caerSpecialEventPacket packet) {
-	if (!caerSpecialEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(!caerSpecialEventIsValid(event))) {
 		SET_NUMBITS32(event->data, VALID_MARK_SHIFT, VALID_MARK_MASK, 1);
 
 		// Also increase number of events and valid events.
@@ -243,7 +272,7 @@ static inline void caerSpecialEventValidate(caerSpecialEvent event, caerSpecialE
  * @param packet the SpecialEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerSpecialEventInvalidate(caerSpecialEvent event, caerSpecialEventPacket packet) {
-	if (caerSpecialEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(caerSpecialEventIsValid(event))) {
 		CLEAR_NUMBITS32(event->data, VALID_MARK_SHIFT, VALID_MARK_MASK);
 
 		// Also decrease number of valid events. Number of total events doesn't change.
@@ -316,7 +345,7 @@ static inline void caerSpecialEventSetData(caerSpecialEvent event, uint32_t data
 	for (int32_t caerSpecialIteratorCounter = 0; \
 		caerSpecialIteratorCounter < caerEventPacketHeaderGetEventNumber(&(SPECIAL_PACKET)->packetHeader); \
 		caerSpecialIteratorCounter++) { \
-		caerSpecialEvent caerSpecialIteratorElement = caerSpecialEventPacketGetEvent(SPECIAL_PACKET, caerSpecialIteratorCounter);
+		caerSpecialEvent caerSpecialIteratorElement = caerSpecialEventPacketGetEventUnchecked(SPECIAL_PACKET, caerSpecialIteratorCounter);
 
 /**
  * Const-Iterator over all special events in a packet.
@@ -330,7 +359,7 @@ static inline void caerSpecialEventSetData(caerSpecialEvent event, uint32_t data
 	for (int32_t caerSpecialIteratorCounter = 0; \
 		caerSpecialIteratorCounter < caerEventPacketHeaderGetEventNumber(&(SPECIAL_PACKET)->packetHeader); \
 		caerSpecialIteratorCounter++) { \
-		caerSpecialEventConst caerSpecialIteratorElement = caerSpecialEventPacketGetEventConst(SPECIAL_PACKET, caerSpecialIteratorCounter);
+		caerSpecialEventConst caerSpecialIteratorElement = caerSpecialEventPacketGetEventConstUnchecked(SPECIAL_PACKET, caerSpecialIteratorCounter);
 
 /**
  * Iterator close statement.
@@ -349,7 +378,7 @@ static inline void caerSpecialEventSetData(caerSpecialEvent event, uint32_t data
 	for (int32_t caerSpecialIteratorCounter = 0; \
 		caerSpecialIteratorCounter < caerEventPacketHeaderGetEventNumber(&(SPECIAL_PACKET)->packetHeader); \
 		caerSpecialIteratorCounter++) { \
-		caerSpecialEvent caerSpecialIteratorElement = caerSpecialEventPacketGetEvent(SPECIAL_PACKET, caerSpecialIteratorCounter); \
+		caerSpecialEvent caerSpecialIteratorElement = caerSpecialEventPacketGetEventUnchecked(SPECIAL_PACKET, caerSpecialIteratorCounter); \
 		if (!caerSpecialEventIsValid(caerSpecialIteratorElement)) { continue; } // Skip invalid special events.
 
 /**
@@ -364,7 +393,7 @@ static inline void caerSpecialEventSetData(caerSpecialEvent event, uint32_t data
 	for (int32_t caerSpecialIteratorCounter = 0; \
 		caerSpecialIteratorCounter < caerEventPacketHeaderGetEventNumber(&(SPECIAL_PACKET)->packetHeader); \
 		caerSpecialIteratorCounter++) { \
-		caerSpecialEventConst caerSpecialIteratorElement = caerSpecialEventPacketGetEventConst(SPECIAL_PACKET, caerSpecialIteratorCounter); \
+		caerSpecialEventConst caerSpecialIteratorElement = caerSpecialEventPacketGetEventConstUnchecked(SPECIAL_PACKET, caerSpecialIteratorCounter); \
 		if (!caerSpecialEventIsValid(caerSpecialIteratorElement)) { continue; } // Skip invalid special events.
 
 /**
@@ -384,7 +413,7 @@ static inline void caerSpecialEventSetData(caerSpecialEvent event, uint32_t data
 	for (int32_t caerSpecialIteratorCounter = caerEventPacketHeaderGetEventNumber(&(SPECIAL_PACKET)->packetHeader) - 1; \
 		caerSpecialIteratorCounter >= 0; \
 		caerSpecialIteratorCounter--) { \
-		caerSpecialEvent caerSpecialIteratorElement = caerSpecialEventPacketGetEvent(SPECIAL_PACKET, caerSpecialIteratorCounter);
+		caerSpecialEvent caerSpecialIteratorElement = caerSpecialEventPacketGetEventUnchecked(SPECIAL_PACKET, caerSpecialIteratorCounter);
 /**
  * Const-Reverse iterator over all special events in a packet.
  * Returns the current index in the 'caerSpecialIteratorCounter' variable of type
@@ -397,7 +426,7 @@ static inline void caerSpecialEventSetData(caerSpecialEvent event, uint32_t data
 	for (int32_t caerSpecialIteratorCounter = caerEventPacketHeaderGetEventNumber(&(SPECIAL_PACKET)->packetHeader) - 1; \
 		caerSpecialIteratorCounter >= 0; \
 		caerSpecialIteratorCounter--) { \
-		caerSpecialEventConst caerSpecialIteratorElement = caerSpecialEventPacketGetEventConst(SPECIAL_PACKET, caerSpecialIteratorCounter);
+		caerSpecialEventConst caerSpecialIteratorElement = caerSpecialEventPacketGetEventConstUnchecked(SPECIAL_PACKET, caerSpecialIteratorCounter);
 
 /**
  * Reverse iterator close statement.
@@ -416,7 +445,7 @@ static inline void caerSpecialEventSetData(caerSpecialEvent event, uint32_t data
 	for (int32_t caerSpecialIteratorCounter = caerEventPacketHeaderGetEventNumber(&(SPECIAL_PACKET)->packetHeader) - 1; \
 		caerSpecialIteratorCounter >= 0; \
 		caerSpecialIteratorCounter--) { \
-		caerSpecialEvent caerSpecialIteratorElement = caerSpecialEventPacketGetEvent(SPECIAL_PACKET, caerSpecialIteratorCounter); \
+		caerSpecialEvent caerSpecialIteratorElement = caerSpecialEventPacketGetEventUnchecked(SPECIAL_PACKET, caerSpecialIteratorCounter); \
 		if (!caerSpecialEventIsValid(caerSpecialIteratorElement)) { continue; } // Skip invalid special events.
 
 /**
@@ -431,7 +460,7 @@ static inline void caerSpecialEventSetData(caerSpecialEvent event, uint32_t data
 	for (int32_t caerSpecialIteratorCounter = caerEventPacketHeaderGetEventNumber(&(SPECIAL_PACKET)->packetHeader) - 1; \
 		caerSpecialIteratorCounter >= 0; \
 		caerSpecialIteratorCounter--) { \
-		caerSpecialEventConst caerSpecialIteratorElement = caerSpecialEventPacketGetEventConst(SPECIAL_PACKET, caerSpecialIteratorCounter); \
+		caerSpecialEventConst caerSpecialIteratorElement = caerSpecialEventPacketGetEventConstUnchecked(SPECIAL_PACKET, caerSpecialIteratorCounter); \
 		if (!caerSpecialEventIsValid(caerSpecialIteratorElement)) { continue; } // Skip invalid special events.
 
 /**
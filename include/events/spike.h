@@ -97,7 +97,7 @@ caerSpikeEventPacket caerSpikeEventPacketAllocate(int32_t eventCapacity, int16_t
  */
 static inline caerSpikeEvent caerSpikeEventPacketGetEvent(caerSpikeEventPacket packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Spike Event",
 			"Called caerSpikeEventPacketGetEvent() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -119,7 +119,7 @@ static inline caerSpikeEvent caerSpikeEventPacketGetEvent(caerSpikeEventPacket p
  */
 static inline caerSpikeEventConst caerSpikeEventPacketGetEventConst(caerSpikeEventPacketConst packet, int32_t n) {
 	// Check that we're not out of bounds.
-	if (n < 0 || n >= caerEventPacketHeaderGetEventCapacity(&packet->packetHeader)) {
+	if (!CAER_ACCESS_CHECK(n >= 0 && n < caerEventPacketHeaderGetEventCapacity(&packet->packetHeader))) {
 		caerLog(CAER_LOG_CRITICAL, "Spike Event",
 			"Called caerSpikeEventPacketGetEventConst() with invalid event offset %" PRIi32 ", while maximum allowed value is %" PRIi32 ".",
 			n, caerEventPacketHeaderGetEventCapacity(&packet->packetHeader) - 1);
@@ -130,6 +130,35 @@ static inline caerSpikeEventConst caerSpikeEventPacketGetEventConst(caerSpikeEve
 	return (packet->events + n);
 }
 
+/**
+ * Get the Spike event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ *
+ * @param packet a valid SpikeEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested Spike event.
+ */
+static inline caerSpikeEvent caerSpikeEventPacketGetEventUnchecked(caerSpikeEventPacket packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
+/**
+ * Get the Spike event at the given index from the event packet.
+ * No bounds check is done: n must be valid, else behavior is undefined.
+ * This is a read-only event, do not change its contents in any way!
+ *
+ * @param packet a valid SpikeEventPacket pointer. Cannot be NULL.
+ * @param n the index of the returned event. Must be within [0,eventCapacity[ bounds.
+ *
+ * @return the requested read-only Spike event.
+ */
+static inline caerSpikeEventConst caerSpikeEventPacketGetEventConstUnchecked(caerSpikeEventPacketConst packet, int32_t n) {
+	// Return a pointer to the specified event.
+	return (packet->events + n);
+}
+
 /**
  * Get the 32bit event timestamp, in microseconds.
  * Be aware that this wraps around! You can either ignore this fact,
@@ -199,7 +228,7 @@ static inline bool caerSpikeEventIsValid(caerSpikeEventConst event) {
  * @param packet the SpikeEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerSpikeEventValidate(caerSpikeEvent event, caerSpikeEventPacket packet) {
-	if (!caerSpikeEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(!caerSpikeEventIsValid(event))) {
 		SET_NUMBITS32(event->data, VALID_MARK_SHIFT, VALID_MARK_MASK, 1);
 
 		// Also increase number of events and valid events.
@@ -224,7 +253,7 @@ static inline void caerSpikeEventValidate(caerSpikeEvent event, caerSpikeEventPa
  * @param packet the SpikeEventPacket pointer for the packet containing this event. Cannot be NULL.
  */
 static inline void caerSpikeEventInvalidate(caerSpikeEvent event, caerSpikeEventPacket packet) {
-	if (caerSpikeEventIsValid(event)) {
+	if (CAER_ACCESS_CHECK(caerSpikeEventIsValid(event))) {
 		CLEAR_NUMBITS32(event->data, VALID_MARK_SHIFT, VALID_MARK_MASK);
 
 		// Also decrease number of valid events. Number of total events doesn't change.
@@ -358,7 +387,7 @@ static inline uint16_t caerSpikeEventGetX(caerSpikeEventConst event) {
 	for (int32_t caerSpikeIteratorCounter = 0; \
 		caerSpikeIteratorCounter < caerEventPacketHeaderGetEventNumber(&(SPIKE_PACKET)->packetHeader); \
 		caerSpikeIteratorCounter++) { \
-		caerSpikeEvent caerSpikeIteratorElement = caerSpikeEventPacketGetEvent(SPIKE_PACKET, caerSpikeIteratorCounter);
+		caerSpikeEvent caerSpikeIteratorElement = caerSpikeEventPacketGetEventUnchecked(SPIKE_PACKET, caerSpikeIteratorCounter);
 
 /**
  * Const-Iterator over all Spike events in a packet.
@@ -372,7 +401,7 @@ static inline uint16_t caerSpikeEventGetX(caerSpikeEventConst event) {
 	for (int32_t caerSpikeIteratorCounter = 0; \
 		caerSpikeIteratorCounter < caerEventPacketHeaderGetEventNumber(&(SPIKE_PACKET)->packetHeader); \
 		caerSpikeIteratorCounter++) { \
-		caerSpikeEventConst caerSpikeIteratorElement = caerSpikeEventPacketGetEventConst(SPIKE_PACKET, caerSpikeIteratorCounter);
+		caerSpikeEventConst caerSpikeIteratorElement = caerSpikeEventPacketGetEventConstUnchecked(SPIKE_PACKET, caerSpikeIteratorCounter);
 
 /**
  * Iterator close statement.
@@ -391,7 +420,7 @@ static inline uint16_t caerSpikeEventGetX(caerSpikeEventConst event) {
 	for (int32_t caerSpikeIteratorCounter = 0; \
 		caerSpikeIteratorCounter < caerEventPacketHeaderGetEventNumber(&(SPIKE_PACKET)->packetHeader); \
 		caerSpikeIteratorCounter++) { \
-		caerSpikeEvent caerSpikeIteratorElement = caerSpikeEventPacketGetEvent(SPIKE_PACKET, caerSpikeIteratorCounter); \
+		caerSpikeEvent caerSpikeIteratorElement = caerSpikeEventPacketGetEventUnchecked(SPIKE_PACKET, caerSpikeIteratorCounter); \
 		if (!caerSpikeEventIsValid(caerSpikeIteratorElement)) { continue; } // Skip invalid Spike events.
 
 /**
@@ -406,7 +435,7 @@ static inline uint16_t caerSpikeEventGetX(caerSpikeEventConst event) {
 	for (int32_t caerSpikeIteratorCounter = 0; \
 		caerSpikeIteratorCounter < caerEventPacketHeaderGetEventNumber(&(SPIKE_PACKET)->packetHeader); \
 		caerSpikeIteratorCounter++) { \
-		caerSpikeEventConst caerSpikeIteratorElement = caerSpikeEventPacketGetEventConst(SPIKE_PACKET, caerSpikeIteratorCounter); \
+		caerSpikeEventConst caerSpikeIteratorElement = caerSpikeEventPacketGetEventConstUnchecked(SPIKE_PACKET, caerSpikeIteratorCounter); \
 		if (!caerSpikeEventIsValid(caerSpikeIteratorElement)) { continue; } // Skip invalid Spike events.
 
 /**
@@ -426,7 +455,7 @@ static inline uint16_t caerSpikeEventGetX(caerSpikeEventConst event) {
 	for (int32_t caerSpikeIteratorCounter = caerEventPacketHeaderGetEventNumber(&(SPIKE_PACKET)->packetHeader) - 1; \
 		caerSpikeIteratorCounter >= 0; \
 		caerSpikeIteratorCounter--) { \
-		caerSpikeEvent caerSpikeIteratorElement = caerSpikeEventPacketGetEvent(SPIKE_PACKET, caerSpikeIteratorCounter);
+		caerSpikeEvent caerSpikeIteratorElement = caerSpikeEventPacketGetEventUnchecked(SPIKE_PACKET, caerSpikeIteratorCounter);
 /**
  * Const-Reverse iterator over all spike events in a packet.
  * Returns the current index in the 'caerSpikeIteratorCounter' variable of type
@@ -439,7 +468,7 @@ static inline uint16_t caerSpikeEventGetX(caerSpikeEventConst event) {
 	for (int32_t caerSpikeIteratorCounter = caerEventPacketHeaderGetEventNumber(&(SPIKE_PACKET)->packetHeader) - 1; \
 		caerSpikeIteratorCounter >= 0; \
 		caerSpikeIteratorCounter--) { \
-		caerSpikeEventConst caerSpikeIteratorElement = caerSpikeEventPacketGetEventConst(SPIKE_PACKET, caerSpikeIteratorCounter);
+		caerSpikeEventConst caerSpikeIteratorElement = caerSpikeEventPacketGetEventConstUnchecked(SPIKE_PACKET, caerSpikeIteratorCounter);
 
 /**
  * Reverse iterator close statement.
@@ -458,7 +487,7 @@ static inline uint16_t caerSpikeEventGetX(caerSpikeEventConst event) {
 	for (int32_t caerSpikeIteratorCounter = caerEventPacketHeaderGetEventNumber(&(SPIKE_PACKET)->packetHeader) - 1; \
 		caerSpikeIteratorCounter >= 0; \
 		caerSpikeIteratorCounter--) { \
-		caerSpikeEvent caerSpikeIteratorElement = caerSpikeEventPacketGetEvent(SPIKE_PACKET, caerSpikeIteratorCounter); \
+		caerSpikeEvent caerSpikeIteratorElement = caerSpikeEventPacketGetEventUnchecked(SPIKE_PACKET, caerSpikeIteratorCounter); \
 		if (!caerSpikeEventIsValid(caerSpikeIteratorElement)) { continue; } // Skip invalid spike events.
 
 /**
@@ -473,7 +502,7 @@ static inline uint16_t caerSpikeEventGetX(caerSpikeEventConst event) {
 	for (int32_t caerSpikeIteratorCounter = caerEventPacketHeaderGetEventNumber(&(SPIKE_PACKET)->packetHeader) - 1; \
 		caerSpikeIteratorCounter >= 0; \
 		caerSpikeIteratorCounter--) { \
-		caerSpikeEventConst caerSpikeIteratorElement = caerSpikeEventPacketGetEventConst(SPIKE_PACKET, caerSpikeIteratorCounter); \
+		caerSpikeEventConst caerSpikeIteratorElement = caerSpikeEventPacketGetEventConstUnchecked(SPIKE_PACKET, caerSpikeIteratorCounter); \
 		if (!caerSpikeEventIsValid(caerSpikeIteratorElement)) { continue; } // Skip invalid spike events.
 
 /**
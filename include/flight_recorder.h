@@ -0,0 +1,129 @@
+/**
+ * @file flight_recorder.h
+ *
+ * Black-box flight recorder for event data: always keeps the most
+ * recent packet containers in a bounded circular memory region, and
+ * only writes them to disk when something interesting happens, as
+ * AEDAT 3.1 files. Each trigger saves a time window around it: the
+ * data from before the trigger that is still held in memory, and the
+ * data that comes after it, up to the post-trigger time. Files are
+ * written asynchronously by a separate thread, so storing data and
+ * triggering never wait for disk I/O.
+ */
+
+#ifndef LIBCAER_FLIGHT_RECORDER_H_
+#define LIBCAER_FLIGHT_RECORDER_H_
+
+#include "events/packetContainer.h"
+#include "events/special.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Default special event types that trigger a recording: all the
+ * EXTERNAL_INPUT_* types (rising edge, falling edge and pulse, on
+ * all external inputs). See caerFlightRecorderSetTriggerTypes().
+ */
+#define CAER_FLIGHT_RECORDER_DEFAULT_TRIGGER_TYPES \
+	((UINT64_C(1) << EXTERNAL_INPUT_RISING_EDGE) | (UINT64_C(1) << EXTERNAL_INPUT_FALLING_EDGE) \
+		| (UINT64_C(1) << EXTERNAL_INPUT_PULSE) | (UINT64_C(1) << EXTERNAL_INPUT1_RISING_EDGE) \
+		| (UINT64_C(1) << EXTERNAL_INPUT1_FALLING_EDGE) | (UINT64_C(1) << EXTERNAL_INPUT1_PULSE) \
+		| (UINT64_C(1) << EXTERNAL_INPUT2_RISING_EDGE) | (UINT64_C(1) << EXTERNAL_INPUT2_FALLING_EDGE) \
+		| (UINT64_C(1) << EXTERNAL_INPUT2_PULSE))
+
+/**
+ * Pointer to a flight recorder.
+ */
+typedef struct caer_flight_recorder *caerFlightRecorder;
+
+/**
+ * Create a new flight recorder, and start its file writing thread.
+ * Recorded data is held in a memory mapping of fixed size, allocated
+ * up-front: the oldest containers are overwritten to make room for
+ * new ones, so the pre-trigger window is bounded by both preTrigger
+ * and the amount of data that fits in memory.
+ * Each trigger writes a new file, named '<filePrefix>-<N>.aedat', with
+ * N counting up from 1. Triggers that happen while the post-trigger window
+ * of a previous one is still open extend that window into the same file.
+ *
+ * @param memorySize size of the circular memory region, in bytes.
+ * @param preTrigger length of the time window to save before a trigger, in µs.
+ * @param postTrigger length of the time window to save after a trigger, in µs.
+ * @param filePrefix path and start of the name of the files to write.
+ *
+ * @return a valid flight recorder, or NULL on error.
+ */
+caerFlightRecorder caerFlightRecorderCreate(size_t memorySize, int64_t preTrigger, int64_t postTrigger,
+	const char *filePrefix);
+
+/**
+ * Free a flight recorder. A recording in progress is cut short at the
+ * data stored so far, and fully written to disk before returning.
+ *
+ * @param recorder a flight recorder. Can be NULL.
+ */
+void caerFlightRecorderFree(caerFlightRecorder recorder);
+
+/**
+ * Store a copy of a packet container, as committed by a device, and check
+ * its special events for triggers. The container stays owned by the caller.
+ * The timestamps of the stored data decide what is part of a recording, so
+ * containers from one source only should be stored, in order. Data only
+ * leaves the post-trigger window once a container past its end is stored,
+ * or when the recorder is freed.
+ * Containers that don't fit in memory, or would overwrite data that was
+ * not yet written to a file, are dropped, see caerFlightRecorderGetDroppedContainers().
+ *
+ * @param recorder a valid flight recorder.
+ * @param container a packet container. Empty containers are ignored.
+ *
+ * @return true if the container was stored, false if it was dropped or on invalid arguments.
+ */
+bool caerFlightRecorderPut(caerFlightRecorder recorder, caerEventPacketContainerConst container);
+
+/**
+ * Trigger a recording from the application, at the time of the latest
+ * stored data.
+ *
+ * @param recorder a valid flight recorder.
+ */
+void caerFlightRecorderTrigger(caerFlightRecorder recorder);
+
+/**
+ * Set which special event types trigger a recording when stored:
+ * bit N set means special events of type N (see 'enum caer_special_event_types')
+ * are a trigger. Zero disables automatic triggers. The default is
+ * CAER_FLIGHT_RECORDER_DEFAULT_TRIGGER_TYPES.
+ *
+ * @param recorder a valid flight recorder.
+ * @param triggerTypes bit-mask of special event types.
+ */
+void caerFlightRecorderSetTriggerTypes(caerFlightRecorder recorder, uint64_t triggerTypes);
+
+/**
+ * Get the number of recordings that were fully written to files.
+ *
+ * @param recorder a valid flight recorder.
+ *
+ * @return number of written files.
+ */
+uint32_t caerFlightRecorderGetRecordingsNumber(caerFlightRecorder recorder);
+
+/**
+ * Get the number of containers that could not be stored, either because
+ * they are bigger than the whole memory region, or because they would have
+ * overwritten data of a recording that was not yet written to disk.
+ *
+ * @param recorder a valid flight recorder.
+ *
+ * @return number of dropped containers.
+ */
+uint64_t caerFlightRecorderGetDroppedContainers(caerFlightRecorder recorder);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBCAER_FLIGHT_RECORDER_H_ */
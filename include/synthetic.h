@@ -0,0 +1,163 @@
+/**
+ * @file synthetic.h
+ *
+ * Synthetic event workload generator, to load-test event processing
+ * without any hardware. Generates packet containers laid out exactly
+ * like the ones coming from DAVIS devices (same packet positions,
+ * timestamp overflow handling and special events), at configurable
+ * rates and with several spatial and temporal event distributions.
+ * Generation is deterministic for a given seed and configuration.
+ */
+
+#ifndef LIBCAER_SYNTHETIC_H_
+#define LIBCAER_SYNTHETIC_H_
+
+#include "events/packetContainer.h"
+#include "events/special.h"
+#include "events/polarity.h"
+#include "events/frame.h"
+#include "events/imu6.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Parameter address: uniform noise, polarity events per second
+ * at random pixels, with random polarity. Default 0 (disabled).
+ */
+#define CAER_SYNTHETIC_NOISE_RATE        0
+/**
+ * Parameter address: moving edge, polarity events per second
+ * along a vertical ON edge moving from left to right, wrapping
+ * around at the right border. Default 0 (disabled).
+ */
+#define CAER_SYNTHETIC_EDGE_RATE         1
+/**
+ * Parameter address: moving edge speed, in pixels per second.
+ * Default 100.
+ */
+#define CAER_SYNTHETIC_EDGE_SPEED        2
+/**
+ * Parameter address: flicker, number of pixels that all toggle
+ * between ON and OFF at the same time, like under a flickering
+ * light. Each toggle generates one event per pixel. Default 0 (disabled).
+ */
+#define CAER_SYNTHETIC_FLICKER_PIXELS    3
+/**
+ * Parameter address: flicker frequency, in Hz (two toggles per period).
+ * Default 100.
+ */
+#define CAER_SYNTHETIC_FLICKER_FREQUENCY 4
+/**
+ * Parameter address: number of hot pixels, firing with random
+ * polarity at CAER_SYNTHETIC_HOT_PIXEL_RATE each. Default 0 (disabled).
+ */
+#define CAER_SYNTHETIC_HOT_PIXELS        5
+/**
+ * Parameter address: events per second of each hot pixel.
+ * Default 1000.
+ */
+#define CAER_SYNTHETIC_HOT_PIXEL_RATE    6
+/**
+ * Parameter address: IMU6 samples per second, at a fixed rate,
+ * showing a device lying still. Default 0 (disabled).
+ */
+#define CAER_SYNTHETIC_IMU_RATE          7
+/**
+ * Parameter address: interval between the start of periodic
+ * full-size grayscale frames, in µs. Each frame comes with its
+ * APS_FRAME_START, APS_EXPOSURE_START, APS_EXPOSURE_END and
+ * APS_FRAME_END special events. Default 0 (disabled).
+ */
+#define CAER_SYNTHETIC_FRAME_INTERVAL    8
+/**
+ * Parameter address: frame exposure time, in µs. Default 4000.
+ */
+#define CAER_SYNTHETIC_FRAME_EXPOSURE    9
+
+/**
+ * Pointer to a synthetic event generator.
+ */
+typedef struct caer_synthetic_generator *caerSyntheticGenerator;
+
+/**
+ * Create a new synthetic event generator. Time starts at zero.
+ *
+ * @param sourceID source ID of the generated event packets.
+ * @param sizeX width of the simulated sensor, in pixels.
+ * @param sizeY height of the simulated sensor, in pixels.
+ * @param seed seed for the pseudo-random number generator.
+ *
+ * @return a valid generator, or NULL on error.
+ */
+caerSyntheticGenerator caerSyntheticGeneratorCreate(int16_t sourceID, int16_t sizeX, int16_t sizeY, uint64_t seed);
+
+/**
+ * Free a synthetic event generator.
+ *
+ * @param generator a generator. Can be NULL.
+ */
+void caerSyntheticGeneratorFree(caerSyntheticGenerator generator);
+
+/**
+ * Configure the generated workload, see the CAER_SYNTHETIC_* parameters.
+ * Changes take effect with the next call to caerSyntheticGeneratorDataGet().
+ *
+ * @param generator a valid generator.
+ * @param paramAddr a parameter address, one of the CAER_SYNTHETIC_* defines.
+ * @param param the new parameter value.
+ *
+ * @return true on success, false on invalid arguments or errors.
+ */
+bool caerSyntheticGeneratorConfigSet(caerSyntheticGenerator generator, uint8_t paramAddr, uint32_t param);
+
+/**
+ * Get the current value of a workload parameter.
+ *
+ * @param generator a valid generator.
+ * @param paramAddr a parameter address, one of the CAER_SYNTHETIC_* defines.
+ * @param param pointer to store the current parameter value in.
+ *
+ * @return true on success, false on invalid arguments.
+ */
+bool caerSyntheticGeneratorConfigGet(caerSyntheticGenerator generator, uint8_t paramAddr, uint32_t *param);
+
+/**
+ * Generate the events of the next time interval, and advance time.
+ * Intervals are shortened so they never cross a timestamp overflow
+ * (every 2^31 µs); the last container before one carries a
+ * TIMESTAMP_WRAP special event, like with real devices.
+ * Frames that would straddle a timestamp overflow are skipped.
+ *
+ * @param generator a valid generator.
+ * @param interval length of the time interval to generate, in µs.
+ *
+ * @return a packet container holding the events of the interval, owned by the
+ *         caller. NULL if no events were generated, or on errors.
+ */
+caerEventPacketContainer caerSyntheticGeneratorDataGet(caerSyntheticGenerator generator, int32_t interval);
+
+/**
+ * Reset time to zero. The next call to caerSyntheticGeneratorDataGet() returns
+ * a container holding only a TIMESTAMP_RESET special event, like devices do.
+ *
+ * @param generator a valid generator.
+ */
+void caerSyntheticGeneratorTimestampReset(caerSyntheticGenerator generator);
+
+/**
+ * Get the current time of the generator: the start of the next interval
+ * caerSyntheticGeneratorDataGet() will generate, in µs.
+ *
+ * @param generator a valid generator.
+ *
+ * @return the current full 64bit timestamp.
+ */
+int64_t caerSyntheticGeneratorGetTimestamp(caerSyntheticGenerator generator);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBCAER_SYNTHETIC_H_ */
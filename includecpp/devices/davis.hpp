@@ -8,6 +8,7 @@
 #include "../events/frame.hpp"
 #include "../events/imu6.hpp"
 #include "../events/sample.hpp"
+#include "../events/pcm.hpp"
 
 namespace libcaer {
 namespace devices {
@@ -5,6 +5,7 @@
 #include "usb.hpp"
 #include "../events/spike.hpp"
 #include "../events/special.hpp"
+#include <vector>
 
 namespace libcaer {
 namespace devices {
@@ -31,6 +32,37 @@ public:
 		}
 	}
 
+	double sendDataToUSBPipelined(const uint32_t *data, size_t numConfig, size_t maxTransfersInFlight = 0,
+		size_t verifyInterval = 0) const {
+		double configsPerSecond = 0;
+
+		bool success = caerDynapseSendDataToUSBPipelined(handle.get(), data, numConfig, maxTransfersInFlight,
+			verifyInterval, &configsPerSecond);
+		if (!success) {
+			throw std::runtime_error("Failed to send config data to device.");
+		}
+
+		return (configsPerSecond);
+	}
+
+	size_t writeBiases(uint8_t chipId, const struct caer_dynapse_bias_value *biases, size_t biasesNumber) const {
+		size_t biasesSent = 0;
+
+		bool success = caerDynapseWriteBiases(handle.get(), chipId, biases, biasesNumber, &biasesSent);
+		if (!success) {
+			throw std::runtime_error("Failed to write biases.");
+		}
+
+		return (biasesSent);
+	}
+
+	void biasCacheInvalidate(int16_t chipId = -1) const {
+		bool success = caerDynapseBiasCacheInvalidate(handle.get(), chipId);
+		if (!success) {
+			throw std::runtime_error("Failed to invalidate bias cache.");
+		}
+	}
+
 	void writeSramWords(const uint16_t *data, uint32_t baseAddr, uint32_t numWords) const {
 		bool success = caerDynapseWriteSramWords(handle.get(), data, baseAddr, numWords);
 		if (!success) {
@@ -38,6 +70,45 @@ public:
 		}
 	}
 
+	void stimulusStreamStart(uint32_t baseAddr, uint32_t halfSize) const {
+		bool success = caerDynapseStimulusStreamStart(handle.get(), baseAddr, halfSize);
+		if (!success) {
+			throw std::runtime_error("Failed to start stimulus stream.");
+		}
+	}
+
+	void stimulusStreamQueue(const uint16_t *data, uint32_t numWords, uint32_t stimCount) const {
+		bool success = caerDynapseStimulusStreamQueue(handle.get(), data, numWords, stimCount);
+		if (!success) {
+			throw std::runtime_error("Failed to queue stimulus segment.");
+		}
+	}
+
+	void stimulusStreamSwap() const {
+		bool success = caerDynapseStimulusStreamSwap(handle.get());
+		if (!success) {
+			throw std::runtime_error("Failed to swap stimulus segment.");
+		}
+	}
+
+	void stimulusStreamStop() const {
+		bool success = caerDynapseStimulusStreamStop(handle.get());
+		if (!success) {
+			throw std::runtime_error("Failed to stop stimulus stream.");
+		}
+	}
+
+	std::vector<uint32_t> spikeCountersGet(int64_t *timestamp = nullptr) const {
+		std::vector<uint32_t> counters(DYNAPSE_SPIKE_COUNTERS_NUMBER);
+
+		bool success = caerDynapseSpikeCountersGet(handle.get(), counters.data(), timestamp);
+		if (!success) {
+			throw std::runtime_error("Failed to get spike counters.");
+		}
+
+		return (counters);
+	}
+
 	void writeSram(uint16_t coreId, uint32_t neuronId, uint16_t virtualCoreId, bool sx, uint8_t dx, bool sy, uint8_t dy,
 		uint16_t sramId, uint16_t destinationCore) const {
 		bool success = caerDynapseWriteSram(handle.get(), coreId, neuronId, virtualCoreId, sx, dx, sy, dy, sramId,
@@ -58,6 +129,24 @@ public:
 		int16_t synapseType) const {
 		return (caerDynapseGenerateCamBits(preNeuronAddr, postNeuronAddr, camId, synapseType));
 	}
+
+	size_t applyNetwork(caerDynapseNetwork network) const {
+		size_t configsSent = 0;
+
+		bool success = caerDynapseNetworkApply(handle.get(), network, &configsSent);
+		if (!success) {
+			throw std::runtime_error("Failed to apply network to device.");
+		}
+
+		return (configsSent);
+	}
+
+	void invalidateNetwork(int16_t chipId = -1) const {
+		bool success = caerDynapseNetworkInvalidate(handle.get(), chipId);
+		if (!success) {
+			throw std::runtime_error("Failed to invalidate network image.");
+		}
+	}
 };
 
 }
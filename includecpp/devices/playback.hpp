@@ -0,0 +1,24 @@
+#ifndef LIBCAER_DEVICES_PLAYBACK_HPP_
+#define LIBCAER_DEVICES_PLAYBACK_HPP_
+
+#include <libcaer/devices/playback.h>
+#include "usb.hpp"
+
+namespace libcaer {
+namespace devices {
+
+class playback final: public usb {
+public:
+	playback(uint16_t deviceID, const std::string &fileName) :
+			usb(caerPlaybackOpen(deviceID, fileName.c_str())) {
+	}
+
+	struct caer_playback_info infoGet() const noexcept {
+		return (caerPlaybackInfoGet(handle.get()));
+	}
+};
+
+}
+}
+
+#endif /* LIBCAER_DEVICES_PLAYBACK_HPP_ */
@@ -18,12 +18,15 @@ protected:
 	}
 
 	usb(uint16_t deviceID, uint16_t deviceType, uint8_t busNumberRestrict, uint8_t devAddressRestrict,
-		const std::string &serialNumberRestrict) {
-		caerDeviceHandle h = caerDeviceOpen(deviceID, deviceType, busNumberRestrict, devAddressRestrict,
-			(serialNumberRestrict.empty()) ? (nullptr) : (serialNumberRestrict.c_str()));
+		const std::string &serialNumberRestrict) :
+			usb(caerDeviceOpen(deviceID, deviceType, busNumberRestrict, devAddressRestrict,
+				(serialNumberRestrict.empty()) ? (nullptr) : (serialNumberRestrict.c_str()))) {
+	}
 
+	// Take ownership of an already opened device handle, for devices with their own open function.
+	usb(caerDeviceHandle deviceHandle) {
 		// Handle constructor failure.
-		if (h == nullptr) {
+		if (deviceHandle == nullptr) {
 			throw std::runtime_error("Failed to open device.");
 		}
 
@@ -34,7 +37,7 @@ protected:
 			caerDeviceClose(&h);
 		};
 
-		handle = std::shared_ptr<struct caer_device_handle>(h, deleteDeviceHandle);
+		handle = std::shared_ptr<struct caer_device_handle>(deviceHandle, deleteDeviceHandle);
 	}
 
 public:
@@ -85,8 +88,43 @@ public:
 		}
 	}
 
+	void dataWatermarkNotifySet(void (*dataWatermarkNotify)(void *ptr, bool high), void *dataWatermarkUserPtr) const {
+		bool success = caerDeviceDataWatermarkNotifySet(handle.get(), dataWatermarkNotify, dataWatermarkUserPtr);
+		if (!success) {
+			throw std::runtime_error("Failed to set data watermark notification.");
+		}
+	}
+
+	int64_t timestampToHost(int64_t deviceTimestamp) const noexcept {
+		return (caerDeviceTimestampToHost(handle.get(), deviceTimestamp));
+	}
+
 	std::unique_ptr<libcaer::events::EventPacketContainer> dataGet() const {
-		caerEventPacketContainer cContainer = caerDeviceDataGet(handle.get());
+		return (convertContainer(caerDeviceDataGet(handle.get())));
+	}
+
+	std::vector<std::unique_ptr<libcaer::events::EventPacketContainer>> dataGetBatch(size_t maxContainers) const {
+		std::vector<caerEventPacketContainer> cContainers(maxContainers);
+
+		size_t containersNumber = caerDeviceDataGetBatch(handle.get(), cContainers.data(), maxContainers);
+
+		std::vector<std::unique_ptr<libcaer::events::EventPacketContainer>> cppContainers;
+		cppContainers.reserve(containersNumber);
+
+		for (size_t i = 0; i < containersNumber; i++) {
+			cppContainers.push_back(convertContainer(cContainers[i]));
+		}
+
+		return (cppContainers);
+	}
+
+	std::unique_ptr<libcaer::events::EventPacketContainer> dataGetQueue(uint8_t queue) const {
+		return (convertContainer(caerDeviceDataGetQueue(handle.get(), queue)));
+	}
+
+private:
+	static std::unique_ptr<libcaer::events::EventPacketContainer> convertContainer(
+		caerEventPacketContainer cContainer) {
 		if (cContainer == nullptr) {
 			// NULL return means no data, forward that.
 			return (nullptr);
@@ -108,6 +146,8 @@ public:
 			}
 		}
 
+		cppContainer->setHostTimestamp(caerEventPacketContainerGetHostTimestamp(cContainer));
+
 		// Free original C container. The event packet memory is now managed by
 		// the EventPacket classes inside the new C++ EventPacketContainer.
 		free(cContainer);
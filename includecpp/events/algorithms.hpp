@@ -0,0 +1,562 @@
+#ifndef LIBCAER_EVENTS_ALGORITHMS_HPP_
+#define LIBCAER_EVENTS_ALGORITHMS_HPP_
+
+#include "common.hpp"
+#include "polarity.hpp"
+#include "spike.hpp"
+#include <algorithm>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace libcaer {
+namespace events {
+namespace algorithms {
+
+/**
+ * Execution policy for the algorithms in this header.
+ * PARALLEL splits the packet into contiguous ranges, one per hardware
+ * thread, but only if the packet is big enough to amortize the thread
+ * creation cost; smaller packets are always processed sequentially.
+ * Functors passed to an algorithm running in PARALLEL mode must be
+ * thread-safe and must not throw.
+ */
+enum class executionTypes {
+	SEQUENTIAL,
+	PARALLEL
+};
+
+namespace detail {
+
+/**
+ * Minimum number of events each thread should get in PARALLEL mode.
+ */
+constexpr int32_t PARALLEL_MIN_EVENTS_PER_THREAD = 32768;
+
+inline size_t rangesNumber(int32_t eventNumber, executionTypes exec) noexcept {
+	if (exec == executionTypes::SEQUENTIAL || eventNumber < (2 * PARALLEL_MIN_EVENTS_PER_THREAD)) {
+		return (1);
+	}
+
+	size_t threads = std::thread::hardware_concurrency();
+	if (threads <= 1) {
+		return (1);
+	}
+
+	size_t maxRanges = static_cast<size_t>(eventNumber / PARALLEL_MIN_EVENTS_PER_THREAD);
+
+	return ((threads < maxRanges) ? (threads) : (maxRanges));
+}
+
+/**
+ * Call func(rangeIndex, start, end) for 'ranges' contiguous sub-ranges of
+ * [0, eventNumber). The first range is always run on the calling thread,
+ * as are any ranges for which no new thread could be started.
+ */
+template<class FUNC>
+void forEachRange(int32_t eventNumber, size_t ranges, FUNC func) {
+	// Index arithmetic is unsigned, all bounds lie within [0, eventNumber].
+	size_t events = static_cast<size_t>(eventNumber);
+	size_t rangeSize = events / ranges;
+
+	auto rangeStart = [=](size_t range) {
+		return (static_cast<int32_t>(range * rangeSize));
+	};
+	auto rangeEnd = [=](size_t range) {
+		return ((range == (ranges - 1)) ? (eventNumber) : (static_cast<int32_t>((range + 1) * rangeSize)));
+	};
+
+	std::vector<std::thread> threads;
+	threads.reserve(ranges - 1);
+
+	size_t range = 1;
+
+	try {
+		for (; range < ranges; range++) {
+			threads.emplace_back(func, range, rangeStart(range), rangeEnd(range));
+		}
+	}
+	catch (const std::system_error &) {
+		// Out of threads, the remaining ranges run below.
+	}
+	catch (const std::bad_alloc &) {
+		// Same, no memory for the new thread's state.
+	}
+
+	func(0, 0, rangeEnd(0));
+
+	for (; range < ranges; range++) {
+		func(range, rangeStart(range), rangeEnd(range));
+	}
+
+	for (auto &t : threads) {
+		t.join();
+	}
+}
+
+/**
+ * Every event's first 32 bits hold the validity mark in bit 0, stored as
+ * little-endian, so it's always in the first byte, on any host.
+ * This allows invalidating events from multiple threads concurrently,
+ * while the shared header's valid counter is updated once at the end.
+ */
+inline void clearValidMark(void *event) noexcept {
+	*static_cast<uint8_t *>(event) = static_cast<uint8_t>(*static_cast<uint8_t *>(event) & 0xFE);
+}
+
+/**
+ * Invalidate all valid events for which ((data & mask) != value).
+ * Works on 8-byte events that have a 32-bit data word first, such as
+ * polarity and spike events. Returns the number of invalidated events.
+ */
+inline int32_t invalidateMaskedNotEqual(uint8_t *events, int32_t start, int32_t end, uint32_t mask,
+	uint32_t value) noexcept {
+	int32_t invalidated = 0;
+	size_t i = static_cast<size_t>(start);
+	size_t last = static_cast<size_t>(end);
+
+#if defined(__SSE2__)
+	// Two events per 128-bit vector, lanes 0 and 2 are the data words.
+	const __m128i validBit = _mm_set_epi32(0, 1, 0, 1);
+	const __m128i maskVec = _mm_set_epi32(0, static_cast<int>(mask), 0, static_cast<int>(mask));
+	const __m128i valueVec = _mm_set_epi32(0, static_cast<int>(value), 0, static_cast<int>(value));
+
+	for (; (i + 2) <= last; i += 2) {
+		__m128i *ptr = reinterpret_cast<__m128i *>(events + (i * 8));
+		__m128i evts = _mm_loadu_si128(ptr);
+
+		__m128i valid = _mm_cmpeq_epi32(_mm_and_si128(evts, validBit), validBit);
+		__m128i match = _mm_cmpeq_epi32(_mm_and_si128(evts, maskVec), valueVec);
+		__m128i drop = _mm_andnot_si128(match, valid);
+
+		int dropBits = _mm_movemask_ps(_mm_castsi128_ps(drop));
+		if (dropBits != 0) {
+			_mm_storeu_si128(ptr, _mm_andnot_si128(_mm_and_si128(drop, validBit), evts));
+			invalidated += (dropBits & 0x01) + ((dropBits >> 2) & 0x01);
+		}
+	}
+#endif
+
+	for (; i < last; i++) {
+		uint8_t *evt = events + (i * 8);
+		uint32_t data = le32toh(*reinterpret_cast<uint32_t *>(evt));
+
+		if ((data & 0x01) && ((data & mask) != value)) {
+			clearValidMark(evt);
+			invalidated++;
+		}
+	}
+
+	return (invalidated);
+}
+
+/**
+ * Clamp an inclusive [low, high] range to the values a field extracted
+ * with the given mask can take, without changing which of them it holds.
+ * A low bound above the mask leaves no value inside: the range is then
+ * replaced by the empty [1, 0].
+ */
+inline void clampRangeToMask(uint32_t &low, uint32_t &high, uint32_t mask) noexcept {
+	if (low > mask) {
+		low = 1;
+		high = 0;
+	}
+	else if (high > mask) {
+		high = mask;
+	}
+}
+
+/**
+ * Invalidate all valid events for which one of the two fields extracted
+ * from the data word, as ((data >> shift) & mask), lies outside of its
+ * inclusive [low, high] range. Masks must be smaller than 2^31, bounds
+ * can be any value. Returns the number of invalidated events.
+ */
+inline int32_t invalidateOutsideRanges(uint8_t *events, int32_t start, int32_t end, uint8_t shift1, uint32_t mask1,
+	uint32_t low1, uint32_t high1, uint8_t shift2, uint32_t mask2, uint32_t low2, uint32_t high2) noexcept {
+	int32_t invalidated = 0;
+	size_t i = static_cast<size_t>(start);
+	size_t last = static_cast<size_t>(end);
+
+	// Bounds within the masks fit in 31 bits, so the vector loop can compare
+	// them signed, and both loops keep or drop exactly the same events.
+	clampRangeToMask(low1, high1, mask1);
+	clampRangeToMask(low2, high2, mask2);
+
+#if defined(__SSE2__)
+	// Two events per 128-bit vector, lanes 0 and 2 are the data words.
+	// Fields and bounds are always positive after masking and clamping,
+	// so signed compares are fine.
+	const __m128i validBit = _mm_set_epi32(0, 1, 0, 1);
+	const __m128i shift1Vec = _mm_cvtsi32_si128(shift1);
+	const __m128i mask1Vec = _mm_set1_epi32(static_cast<int>(mask1));
+	const __m128i low1Vec = _mm_set1_epi32(static_cast<int>(low1));
+	const __m128i high1Vec = _mm_set1_epi32(static_cast<int>(high1));
+	const __m128i shift2Vec = _mm_cvtsi32_si128(shift2);
+	const __m128i mask2Vec = _mm_set1_epi32(static_cast<int>(mask2));
+	const __m128i low2Vec = _mm_set1_epi32(static_cast<int>(low2));
+	const __m128i high2Vec = _mm_set1_epi32(static_cast<int>(high2));
+
+	for (; (i + 2) <= last; i += 2) {
+		__m128i *ptr = reinterpret_cast<__m128i *>(events + (i * 8));
+		__m128i evts = _mm_loadu_si128(ptr);
+
+		__m128i valid = _mm_cmpeq_epi32(_mm_and_si128(evts, validBit), validBit);
+
+		__m128i field1 = _mm_and_si128(_mm_srl_epi32(evts, shift1Vec), mask1Vec);
+		__m128i field2 = _mm_and_si128(_mm_srl_epi32(evts, shift2Vec), mask2Vec);
+
+		__m128i outside = _mm_or_si128(_mm_cmplt_epi32(field1, low1Vec), _mm_cmpgt_epi32(field1, high1Vec));
+		outside = _mm_or_si128(outside, _mm_cmplt_epi32(field2, low2Vec));
+		outside = _mm_or_si128(outside, _mm_cmpgt_epi32(field2, high2Vec));
+
+		__m128i drop = _mm_and_si128(outside, valid);
+
+		int dropBits = _mm_movemask_ps(_mm_castsi128_ps(drop));
+		if (dropBits != 0) {
+			_mm_storeu_si128(ptr, _mm_andnot_si128(_mm_and_si128(drop, validBit), evts));
+			invalidated += (dropBits & 0x01) + ((dropBits >> 2) & 0x01);
+		}
+	}
+#endif
+
+	for (; i < last; i++) {
+		uint8_t *evt = events + (i * 8);
+		uint32_t data = le32toh(*reinterpret_cast<uint32_t *>(evt));
+
+		if (!(data & 0x01)) {
+			continue;
+		}
+
+		uint32_t field1 = (data >> shift1) & mask1;
+		uint32_t field2 = (data >> shift2) & mask2;
+
+		if (field1 < low1 || field1 > high1 || field2 < low2 || field2 > high2) {
+			clearValidMark(evt);
+			invalidated++;
+		}
+	}
+
+	return (invalidated);
+}
+
+template<class PKT, class KERNEL>
+int32_t runInvalidationKernel(PKT &packet, executionTypes exec, KERNEL kernel) {
+	static_assert(sizeof(typename PKT::value_type) == 8, "Kernel requires 8-byte events.");
+
+	int32_t eventNumber = packet.size();
+	if (eventNumber == 0) {
+		return (0);
+	}
+
+	uint8_t *events = reinterpret_cast<uint8_t *>(&packet.front());
+
+	size_t ranges = rangesNumber(eventNumber, exec);
+	std::vector<int32_t> invalidated(ranges, 0);
+
+	forEachRange(eventNumber, ranges, [&](size_t range, int32_t start, int32_t end) {
+		invalidated[range] = kernel(events, start, end);
+	});
+
+	int32_t totalInvalidated = 0;
+	for (int32_t inv : invalidated) {
+		totalInvalidated += inv;
+	}
+
+	packet.setEventValid(packet.getEventValid() - totalInvalidated);
+
+	return (totalInvalidated);
+}
+
+}
+
+/**
+ * Invalidate all valid events for which the predicate returns false.
+ * The predicate is called as pred(const EVT &).
+ *
+ * @param packet the event packet to filter in-place.
+ * @param pred predicate deciding which events to keep.
+ * @param exec execution policy.
+ *
+ * @return the number of events that were invalidated.
+ */
+template<class PKT, class PRED>
+int32_t filter(PKT &packet, PRED pred, executionTypes exec = executionTypes::SEQUENTIAL) {
+	int32_t eventNumber = packet.size();
+	if (eventNumber == 0) {
+		return (0);
+	}
+
+	auto eventsBegin = packet.begin();
+
+	size_t ranges = detail::rangesNumber(eventNumber, exec);
+	std::vector<int32_t> invalidated(ranges, 0);
+
+	detail::forEachRange(eventNumber, ranges, [&](size_t range, int32_t start, int32_t end) {
+		for (auto evt = eventsBegin + start; evt != (eventsBegin + end); evt++) {
+			if (evt->isValid() && !pred(static_cast<const typename PKT::value_type &>(*evt))) {
+				detail::clearValidMark(&(*evt));
+				invalidated[range]++;
+			}
+		}
+	});
+
+	int32_t totalInvalidated = 0;
+	for (int32_t inv : invalidated) {
+		totalInvalidated += inv;
+	}
+
+	packet.setEventValid(packet.getEventValid() - totalInvalidated);
+
+	return (totalInvalidated);
+}
+
+/**
+ * Apply a function to all valid events, modifying them in-place.
+ * The function is called as func(EVT &). It must not change the
+ * validity mark of the event, use filter() for that.
+ *
+ * @param packet the event packet to transform in-place.
+ * @param func function to apply to each valid event.
+ * @param exec execution policy.
+ */
+template<class PKT, class FUNC>
+void transform(PKT &packet, FUNC func, executionTypes exec = executionTypes::SEQUENTIAL) {
+	int32_t eventNumber = packet.size();
+	if (eventNumber == 0) {
+		return;
+	}
+
+	auto eventsBegin = packet.begin();
+
+	detail::forEachRange(eventNumber, detail::rangesNumber(eventNumber, exec),
+		[&](size_t, int32_t start, int32_t end) {
+			for (auto evt = eventsBegin + start; evt != (eventsBegin + end); evt++) {
+				if (evt->isValid()) {
+					func(*evt);
+				}
+			}
+		});
+}
+
+/**
+ * Count valid events into bins. The key function is called as
+ * key(const EVT &) and returns the bin index; events mapping to an
+ * index bigger or equal to bins.size() are ignored.
+ * Counts are added to the existing content of bins.
+ *
+ * @param packet the event packet to analyze.
+ * @param key function mapping an event to its bin.
+ * @param bins the bins to accumulate counts in.
+ * @param exec execution policy.
+ */
+template<class PKT, class KEY>
+void histogram(const PKT &packet, KEY key, std::vector<uint32_t> &bins, executionTypes exec =
+	executionTypes::SEQUENTIAL) {
+	int32_t eventNumber = packet.size();
+	if (eventNumber == 0 || bins.empty()) {
+		return;
+	}
+
+	auto eventsBegin = packet.cbegin();
+
+	size_t ranges = detail::rangesNumber(eventNumber, exec);
+
+	// Each additional range counts into its own bins, merged at the end.
+	std::vector<std::vector<uint32_t>> rangeBins(ranges - 1, std::vector<uint32_t>(bins.size(), 0));
+
+	detail::forEachRange(eventNumber, ranges, [&](size_t range, int32_t start, int32_t end) {
+		std::vector<uint32_t> &localBins = (range == 0) ? (bins) : (rangeBins[range - 1]);
+
+		for (auto evt = eventsBegin + start; evt != (eventsBegin + end); evt++) {
+			if (evt->isValid()) {
+				size_t idx = static_cast<size_t>(key(*evt));
+
+				if (idx < localBins.size()) {
+					localBins[idx]++;
+				}
+			}
+		}
+	});
+
+	for (const auto &localBins : rangeBins) {
+		for (size_t i = 0; i < bins.size(); i++) {
+			bins[i] += localBins[i];
+		}
+	}
+}
+
+/**
+ * Count valid events per pixel, for any event type with getX()/getY().
+ *
+ * @param packet the event packet to analyze.
+ * @param sizeX width of the pixel array.
+ * @param sizeY height of the pixel array.
+ * @param exec execution policy.
+ *
+ * @return per-pixel counts, indexed as (y * sizeX) + x.
+ */
+template<class PKT>
+std::vector<uint32_t> pixelHistogram(const PKT &packet, uint16_t sizeX, uint16_t sizeY, executionTypes exec =
+	executionTypes::SEQUENTIAL) {
+	std::vector<uint32_t> bins(static_cast<size_t>(sizeX) * sizeY, 0);
+
+	histogram(packet, [sizeX, sizeY](const typename PKT::value_type &evt) -> size_t {
+		size_t x = evt.getX();
+		size_t y = evt.getY();
+
+		// Out of range coordinates map to an ignored bin.
+		return ((x < sizeX && y < sizeY) ? ((y * sizeX) + x) : (SIZE_MAX));
+	}, bins, exec);
+
+	return (bins);
+}
+
+/**
+ * Find the index of the first event with a timestamp bigger or
+ * equal to the given one. Events in a packet are ordered by time.
+ *
+ * @param packet the event packet to search.
+ * @param timestamp the 32-bit timestamp to search for.
+ *
+ * @return the index of the found event, or packet.size() if none.
+ */
+template<class PKT>
+int32_t lowerBound(const PKT &packet, int32_t timestamp) {
+	int32_t eventNumber = packet.size();
+	if (eventNumber == 0) {
+		return (0);
+	}
+
+	auto eventsBegin = packet.cbegin();
+
+	int32_t low = 0;
+	int32_t count = eventNumber;
+
+	while (count > 0) {
+		int32_t step = count / 2;
+
+		if ((eventsBegin + (low + step))->getTimestamp() < timestamp) {
+			low += step + 1;
+			count -= step + 1;
+		}
+		else {
+			count = step;
+		}
+	}
+
+	return (low);
+}
+
+/**
+ * Find the index of the first event with a timestamp strictly
+ * bigger than the given one. Events in a packet are ordered by time.
+ * Together with lowerBound(), this gives the [start, end) range of
+ * events that fall into a time window.
+ *
+ * @param packet the event packet to search.
+ * @param timestamp the 32-bit timestamp to search for.
+ *
+ * @return the index of the found event, or packet.size() if none.
+ */
+template<class PKT>
+int32_t upperBound(const PKT &packet, int32_t timestamp) {
+	if (timestamp == INT32_MAX) {
+		return (packet.size());
+	}
+
+	return (lowerBound(packet, timestamp + 1));
+}
+
+/**
+ * Keep only valid polarity events with the given polarity.
+ * Specialized for the 8-byte polarity layout, uses SSE2 if available.
+ *
+ * @return the number of events that were invalidated.
+ */
+inline int32_t filterPolarity(PolarityEventPacket &packet, bool polarity, executionTypes exec =
+	executionTypes::SEQUENTIAL) {
+	const uint32_t mask = U32T(1) << POLARITY_SHIFT;
+	const uint32_t value = (polarity) ? (mask) : (0);
+
+	return (detail::runInvalidationKernel(packet, exec, [mask, value](uint8_t *events, int32_t start, int32_t end) {
+		return (detail::invalidateMaskedNotEqual(events, start, end, mask, value));
+	}));
+}
+
+/**
+ * Keep only valid polarity events inside the inclusive rectangular region
+ * [xMin, xMax] x [yMin, yMax].
+ * Specialized for the 8-byte polarity layout, uses SSE2 if available.
+ *
+ * @return the number of events that were invalidated.
+ */
+inline int32_t filterRegion(PolarityEventPacket &packet, uint16_t xMin, uint16_t yMin, uint16_t xMax, uint16_t yMax,
+	executionTypes exec = executionTypes::SEQUENTIAL) {
+	return (detail::runInvalidationKernel(packet, exec,
+		[xMin, yMin, xMax, yMax](uint8_t *events, int32_t start, int32_t end) {
+			return (detail::invalidateOutsideRanges(events, start, end, POLARITY_X_ADDR_SHIFT, POLARITY_X_ADDR_MASK,
+				xMin, xMax, POLARITY_Y_ADDR_SHIFT, POLARITY_Y_ADDR_MASK, yMin, yMax));
+		}));
+}
+
+/**
+ * Keep only valid spike events coming from the given chip.
+ * Specialized for the 8-byte spike layout, uses SSE2 if available.
+ *
+ * @return the number of events that were invalidated.
+ */
+inline int32_t filterChip(SpikeEventPacket &packet, uint8_t chipID, executionTypes exec =
+	executionTypes::SEQUENTIAL) {
+	const uint32_t mask = U32T(SPIKE_CHIP_ID_MASK) << SPIKE_CHIP_ID_SHIFT;
+	const uint32_t value = (U32T(chipID) << SPIKE_CHIP_ID_SHIFT) & mask;
+
+	return (detail::runInvalidationKernel(packet, exec, [mask, value](uint8_t *events, int32_t start, int32_t end) {
+		return (detail::invalidateMaskedNotEqual(events, start, end, mask, value));
+	}));
+}
+
+/**
+ * Keep only valid spike events coming from the given core of the given chip.
+ * Specialized for the 8-byte spike layout, uses SSE2 if available.
+ *
+ * @return the number of events that were invalidated.
+ */
+inline int32_t filterCore(SpikeEventPacket &packet, uint8_t chipID, uint8_t coreID, executionTypes exec =
+	executionTypes::SEQUENTIAL) {
+	const uint32_t mask = (U32T(SPIKE_CHIP_ID_MASK) << SPIKE_CHIP_ID_SHIFT)
+		| (U32T(SPIKE_SOURCE_CORE_ID_MASK) << SPIKE_SOURCE_CORE_ID_SHIFT);
+	const uint32_t value = ((U32T(chipID) << SPIKE_CHIP_ID_SHIFT) | (U32T(coreID) << SPIKE_SOURCE_CORE_ID_SHIFT))
+		& mask;
+
+	return (detail::runInvalidationKernel(packet, exec, [mask, value](uint8_t *events, int32_t start, int32_t end) {
+		return (detail::invalidateMaskedNotEqual(events, start, end, mask, value));
+	}));
+}
+
+/**
+ * Keep only valid spike events whose neuron ID lies in the inclusive
+ * range [neuronMin, neuronMax], on the given chip.
+ * Specialized for the 8-byte spike layout, uses SSE2 if available.
+ *
+ * @return the number of events that were invalidated.
+ */
+inline int32_t filterNeurons(SpikeEventPacket &packet, uint8_t chipID, uint32_t neuronMin, uint32_t neuronMax,
+	executionTypes exec = executionTypes::SEQUENTIAL) {
+	return (detail::runInvalidationKernel(packet, exec,
+		[chipID, neuronMin, neuronMax](uint8_t *events, int32_t start, int32_t end) {
+			return (detail::invalidateOutsideRanges(events, start, end, SPIKE_NEURON_ID_SHIFT, SPIKE_NEURON_ID_MASK,
+				neuronMin, neuronMax, SPIKE_CHIP_ID_SHIFT, SPIKE_CHIP_ID_MASK, chipID, chipID));
+		}));
+}
+
+}
+}
+}
+
+#endif /* LIBCAER_EVENTS_ALGORITHMS_HPP_ */
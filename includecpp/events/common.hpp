@@ -4,8 +4,19 @@
 #include <libcaer/events/common.h>
 #include "../libcaer.hpp"
 #include <cassert>
+#include <cstddef>
+#include <cstring>
 #include <memory>
 
+// Polymorphic memory resources (std::pmr) are only available from C++17 on.
+// When present, packets can be allocated from a user-supplied memory_resource.
+#if __cplusplus >= 201703L && defined(__has_include)
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#define LIBCAER_HAVE_PMR 1
+#endif
+#endif
+
 namespace libcaer {
 namespace events {
 
@@ -144,14 +155,26 @@ public:
 };
 
 class EventPacket {
+public:
+#if defined(LIBCAER_HAVE_PMR)
+	using memory_resource_pointer = std::pmr::memory_resource *;
+#else
+	// Keep the same object layout when std::pmr is not available.
+	using memory_resource_pointer = void *;
+#endif
+
 protected:
 	caerEventPacketHeader header;
 	bool isMemoryOwner;
+	// Memory resource the packet memory was allocated from, nullptr for
+	// memory coming from the C allocator (malloc/calloc/realloc).
+	memory_resource_pointer memoryResource;
 
 	// Constructors.
 	EventPacket() :
 			header(nullptr),
-			isMemoryOwner(true) {
+			isMemoryOwner(true),
+			memoryResource(nullptr) {
 	}
 
 public:
@@ -166,23 +189,23 @@ public:
 
 		header = packetHeader;
 		isMemoryOwner = takeMemoryOwnership;
+		memoryResource = nullptr;
 	}
 
 	// Destructor.
 	virtual ~EventPacket() {
 		// Support not freeing memory, when this packet doesn't own the memory.
 		if (isMemoryOwner) {
-			// All EventPackets must have been allocated somewhere on the heap,
-			// and can thus always be passed to free(). free(nullptr) does nothing.
-			free(header);
+			freeHeader(header, memoryResource);
 		}
 	}
 
 	// Copy constructor.
 	EventPacket(const EventPacket &rhs) {
-		// Full copy.
+		// Full copy. Copies always use the C allocator.
 		header = internalCopy(rhs.header, copyTypes::FULL);
 		isMemoryOwner = true; // Always memory owner on copy!
+		memoryResource = nullptr;
 	}
 
 	// Copy assignment.
@@ -200,11 +223,12 @@ public:
 
 			// Destroy current data, only if actually owned.
 			if (isMemoryOwner) {
-				free(header);
+				freeHeader(header, memoryResource);
 			}
 
 			header = copy;
 			isMemoryOwner = true; // Always memory owner on copy!
+			memoryResource = nullptr;
 		}
 
 		return (*this);
@@ -219,6 +243,7 @@ public:
 		// Move data here.
 		header = rhs.header;
 		isMemoryOwner = rhs.isMemoryOwner; // Move memory ownership too!
+		memoryResource = rhs.memoryResource;
 
 		// Reset old data (ready for destruction).
 		rhs.header = nullptr;
@@ -239,12 +264,13 @@ public:
 
 		// Destroy current data, only if actually owned.
 		if (isMemoryOwner) {
-			free(header);
+			freeHeader(header, memoryResource);
 		}
 
 		// Move data here.
 		header = rhs.header;
 		isMemoryOwner = rhs.isMemoryOwner; // Move memory ownership too!
+		memoryResource = rhs.memoryResource;
 
 		// Reset old data (ready for destruction).
 		rhs.header = nullptr;
@@ -420,6 +446,22 @@ public:
 			throw std::invalid_argument("Negative or zero event capacity not allowed.");
 		}
 
+		if (memoryResource != nullptr) {
+			// Same semantics as caerEventPacketResize(), see there.
+			caerEventPacketClean(header);
+
+			int32_t eventNumber = getEventNumber();
+
+			resourceReallocate(newEventCapacity);
+
+			if (newEventCapacity < eventNumber) {
+				caerEventPacketHeaderSetEventValid(header, newEventCapacity);
+				caerEventPacketHeaderSetEventNumber(header, newEventCapacity);
+			}
+
+			return;
+		}
+
 		caerEventPacketHeader resizedPacket = caerEventPacketResize(header, newEventCapacity);
 		if (resizedPacket == nullptr) {
 			throw std::bad_alloc();
@@ -441,6 +483,11 @@ public:
 			throw std::invalid_argument("New event capacity must be strictly bigger than old one.");
 		}
 
+		if (memoryResource != nullptr) {
+			resourceReallocate(newEventCapacity);
+			return;
+		}
+
 		caerEventPacketHeader enlargedPacket = caerEventPacketGrow(header, newEventCapacity);
 		if (enlargedPacket == nullptr) {
 			throw std::bad_alloc();
@@ -461,6 +508,25 @@ public:
 			throw std::invalid_argument("Event TS overflow must be the same.");
 		}
 
+		if (memoryResource != nullptr) {
+			// Same semantics as caerEventPacketAppend(), see there.
+			int32_t eventValid = getEventValid();
+			int32_t eventNumber = getEventNumber();
+			int32_t appendEventValid = appendPacket.getEventValid();
+			int32_t appendEventNumber = appendPacket.getEventNumber();
+
+			resourceReallocate(getEventCapacity() + appendPacket.getEventCapacity());
+
+			memcpy(reinterpret_cast<uint8_t *>(header) + CAER_EVENT_PACKET_HEADER_SIZE
+				+ (static_cast<size_t>(eventNumber) * static_cast<size_t>(getEventSize())),
+				reinterpret_cast<const uint8_t *>(appendPacket.header) + CAER_EVENT_PACKET_HEADER_SIZE,
+				static_cast<size_t>(appendEventNumber) * static_cast<size_t>(getEventSize()));
+
+			caerEventPacketHeaderSetEventValid(header, eventValid + appendEventValid);
+			caerEventPacketHeaderSetEventNumber(header, eventNumber + appendEventNumber);
+			return;
+		}
+
 		caerEventPacketHeader mergedPacket = caerEventPacketAppend(header, appendPacket.header);
 		if (mergedPacket == nullptr) {
 			throw std::bad_alloc();
@@ -488,6 +554,7 @@ public:
 
 		std::swap(header, rhs.header);
 		std::swap(isMemoryOwner, rhs.isMemoryOwner);
+		std::swap(memoryResource, rhs.memoryResource);
 	}
 
 	// Direct underlying pointer access.
@@ -504,6 +571,11 @@ public:
 		return (isMemoryOwner);
 	}
 
+	// Memory resource backing this packet, nullptr if the C allocator is used.
+	memory_resource_pointer getMemoryResource() const noexcept {
+		return (memoryResource);
+	}
+
 	// Convenience methods.
 	size_type capacity() const noexcept {
 		return (getEventCapacity());
@@ -547,6 +619,84 @@ protected:
 		return (packetCopy);
 	}
 
+	// Memory management for packets that can come either from the C allocator
+	// or from a std::pmr::memory_resource.
+	static size_t packetMemorySize(caerEventPacketHeaderConst packetHeader, int32_t eventCapacity) noexcept {
+		return (CAER_EVENT_PACKET_HEADER_SIZE
+			+ (static_cast<size_t>(eventCapacity)
+				* static_cast<size_t>(caerEventPacketHeaderGetEventSize(packetHeader))));
+	}
+
+	static void freeHeader(caerEventPacketHeader packetHeader, memory_resource_pointer resource) noexcept {
+		// free(nullptr) does nothing, so no check needed in that case.
+		if (resource == nullptr || packetHeader == nullptr) {
+			free(packetHeader);
+			return;
+		}
+
+#if defined(LIBCAER_HAVE_PMR)
+		resource->deallocate(packetHeader,
+			packetMemorySize(packetHeader, caerEventPacketHeaderGetEventCapacity(packetHeader)),
+			alignof(std::max_align_t));
+#endif
+	}
+
+	void resourceReallocate(int32_t newEventCapacity) {
+#if defined(LIBCAER_HAVE_PMR)
+		int32_t oldEventCapacity = getEventCapacity();
+
+		size_t oldSize = packetMemorySize(header, oldEventCapacity);
+		size_t newSize = packetMemorySize(header, newEventCapacity);
+
+		// Throws std::bad_alloc on failure, like all memory resources.
+		void *newMemory = memoryResource->allocate(newSize, alignof(std::max_align_t));
+
+		// Copy old content, zero out any new event memory (all events invalid).
+		memcpy(newMemory, header, (oldSize < newSize) ? (oldSize) : (newSize));
+
+		if (newSize > oldSize) {
+			memset(static_cast<uint8_t *>(newMemory) + oldSize, 0, newSize - oldSize);
+		}
+
+		memoryResource->deallocate(header, oldSize, alignof(std::max_align_t));
+
+		header = static_cast<caerEventPacketHeader>(newMemory);
+
+		caerEventPacketHeaderSetEventCapacity(header, newEventCapacity);
+#else
+		(void) (newEventCapacity);
+		throw std::runtime_error("Memory resources are not supported.");
+#endif
+	}
+
+#if defined(LIBCAER_HAVE_PMR)
+	// Allocate a zeroed-out event packet (all events invalid) from a memory resource,
+	// filling in the header fields just like the C <Type>EventPacketAllocate() functions.
+	void resourceAllocate(std::pmr::memory_resource *resource, size_type eventCapacity, int16_t eventSource,
+		int32_t tsOverflow, int16_t eventType, size_t eventSize, size_t eventTSOffset) {
+		constructorCheckNullptr(resource);
+
+		size_t packetSize = CAER_EVENT_PACKET_HEADER_SIZE + (static_cast<size_t>(eventCapacity) * eventSize);
+
+		// Throws std::bad_alloc on failure, like all memory resources.
+		void *packetMemory = resource->allocate(packetSize, alignof(std::max_align_t));
+		memset(packetMemory, 0, packetSize);
+
+		caerEventPacketHeader packetHeader = static_cast<caerEventPacketHeader>(packetMemory);
+
+		caerEventPacketHeaderSetEventType(packetHeader, eventType);
+		caerEventPacketHeaderSetEventSource(packetHeader, eventSource);
+		caerEventPacketHeaderSetEventSize(packetHeader, static_cast<int32_t>(eventSize));
+		caerEventPacketHeaderSetEventTSOffset(packetHeader, static_cast<int32_t>(eventTSOffset));
+		caerEventPacketHeaderSetEventTSOverflow(packetHeader, tsOverflow);
+		caerEventPacketHeaderSetEventCapacity(packetHeader, eventCapacity);
+
+		header = packetHeader;
+		isMemoryOwner = true; // Always owner on new allocation!
+		memoryResource = resource;
+	}
+#endif
+
 	// Constructor checks.
 	static void constructorCheckCapacitySourceTSOverflow(size_type eventCapacity, int16_t eventSource,
 		int32_t tsOverflow) {
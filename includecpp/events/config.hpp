@@ -79,6 +79,16 @@ public:
 		isMemoryOwner = true; // Always owner on new allocation!
 	}
 
+#if defined(LIBCAER_HAVE_PMR)
+	ConfigurationEventPacket(size_type eventCapacity, int16_t eventSource, int32_t tsOverflow,
+		std::pmr::memory_resource *resource) {
+		constructorCheckCapacitySourceTSOverflow(eventCapacity, eventSource, tsOverflow);
+
+		resourceAllocate(resource, eventCapacity, eventSource, tsOverflow, CONFIG_EVENT,
+			sizeof(struct caer_configuration_event), offsetof(struct caer_configuration_event, timestamp));
+	}
+#endif
+
 	ConfigurationEventPacket(caerConfigurationEventPacket packet, bool takeMemoryOwnership = true) {
 		constructorCheckNullptr(packet);
 
@@ -100,7 +110,7 @@ public:
 protected:
 	// Event access methods.
 	reference virtualGetEvent(size_type index) noexcept override {
-		caerConfigurationEvent evtBase = caerConfigurationEventPacketGetEvent(
+		caerConfigurationEvent evtBase = caerConfigurationEventPacketGetEventUnchecked(
 			reinterpret_cast<caerConfigurationEventPacket>(header), index);
 		ConfigurationEvent *evt = static_cast<ConfigurationEvent *>(evtBase);
 
@@ -108,7 +118,7 @@ protected:
 	}
 
 	const_reference virtualGetEvent(size_type index) const noexcept override {
-		caerConfigurationEventConst evtBase = caerConfigurationEventPacketGetEventConst(
+		caerConfigurationEventConst evtBase = caerConfigurationEventPacketGetEventConstUnchecked(
 			reinterpret_cast<caerConfigurationEventPacketConst>(header), index);
 		const ConfigurationEvent *evt = static_cast<const ConfigurationEvent *>(evtBase);
 
@@ -84,6 +84,16 @@ public:
 		isMemoryOwner = true; // Always owner on new allocation!
 	}
 
+#if defined(LIBCAER_HAVE_PMR)
+	EarEventPacket(size_type eventCapacity, int16_t eventSource, int32_t tsOverflow,
+		std::pmr::memory_resource *resource) {
+		constructorCheckCapacitySourceTSOverflow(eventCapacity, eventSource, tsOverflow);
+
+		resourceAllocate(resource, eventCapacity, eventSource, tsOverflow, EAR_EVENT,
+			sizeof(struct caer_ear_event), offsetof(struct caer_ear_event, timestamp));
+	}
+#endif
+
 	EarEventPacket(caerEarEventPacket packet, bool takeMemoryOwnership = true) {
 		constructorCheckNullptr(packet);
 
@@ -105,15 +115,15 @@ public:
 protected:
 	// Event access methods.
 	reference virtualGetEvent(size_type index) noexcept override {
-		caerEarEvent evtBase = caerEarEventPacketGetEvent(reinterpret_cast<caerEarEventPacket>(header), index);
+		caerEarEvent evtBase = caerEarEventPacketGetEventUnchecked(reinterpret_cast<caerEarEventPacket>(header), index);
 		EarEvent *evt = static_cast<EarEvent *>(evtBase);
 
 		return (*evt);
 	}
 
 	const_reference virtualGetEvent(size_type index) const noexcept override {
-		caerEarEventConst evtBase = caerEarEventPacketGetEventConst(reinterpret_cast<caerEarEventPacketConst>(header),
-			index);
+		caerEarEventConst evtBase = caerEarEventPacketGetEventConstUnchecked(
+			reinterpret_cast<caerEarEventPacketConst>(header), index);
 		const EarEvent *evt = static_cast<const EarEvent *>(evtBase);
 
 		return (*evt);
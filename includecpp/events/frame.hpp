@@ -361,6 +361,31 @@ public:
 		isMemoryOwner = true; // Always owner on new allocation!
 	}
 
+#if defined(LIBCAER_HAVE_PMR)
+	FrameEventPacket(size_type eventCapacity, int16_t eventSource, int32_t tsOverflow, int32_t maxLengthX,
+		int32_t maxLengthY, int16_t maxChannelNumber, std::pmr::memory_resource *resource) {
+		constructorCheckCapacitySourceTSOverflow(eventCapacity, eventSource, tsOverflow);
+
+		if (maxLengthX <= 0) {
+			throw std::invalid_argument("Negative or zero maximum X length not allowed.");
+		}
+		if (maxLengthY <= 0) {
+			throw std::invalid_argument("Negative or zero maximum Y length not allowed.");
+		}
+		if (maxChannelNumber <= 0) {
+			throw std::invalid_argument("Negative or zero maximum number of channels not allowed.");
+		}
+
+		// Same event size as caerFrameEventPacketAllocate(), see there.
+		size_t pixelSize = sizeof(uint16_t) * static_cast<size_t>(maxLengthX) * static_cast<size_t>(maxLengthY)
+			* static_cast<size_t>(maxChannelNumber);
+		size_t eventSize = (sizeof(struct caer_frame_event) - sizeof(uint16_t)) + pixelSize;
+
+		resourceAllocate(resource, eventCapacity, eventSource, tsOverflow, FRAME_EVENT, eventSize,
+			offsetof(struct caer_frame_event, ts_endframe));
+	}
+#endif
+
 	FrameEventPacket(caerFrameEventPacket packet, bool takeMemoryOwnership = true) {
 		constructorCheckNullptr(packet);
 
@@ -382,14 +407,15 @@ public:
 protected:
 	// Event access methods.
 	reference virtualGetEvent(size_type index) noexcept override {
-		caerFrameEvent evtBase = caerFrameEventPacketGetEvent(reinterpret_cast<caerFrameEventPacket>(header), index);
+		caerFrameEvent evtBase = caerFrameEventPacketGetEventUnchecked(
+			reinterpret_cast<caerFrameEventPacket>(header), index);
 		FrameEvent *evt = static_cast<FrameEvent *>(evtBase);
 
 		return (*evt);
 	}
 
 	const_reference virtualGetEvent(size_type index) const noexcept override {
-		caerFrameEventConst evtBase = caerFrameEventPacketGetEventConst(
+		caerFrameEventConst evtBase = caerFrameEventPacketGetEventConstUnchecked(
 			reinterpret_cast<caerFrameEventPacketConst>(header), index);
 		const FrameEvent *evt = static_cast<const FrameEvent *>(evtBase);
 
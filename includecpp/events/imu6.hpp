@@ -108,6 +108,16 @@ public:
 		isMemoryOwner = true; // Always owner on new allocation!
 	}
 
+#if defined(LIBCAER_HAVE_PMR)
+	IMU6EventPacket(size_type eventCapacity, int16_t eventSource, int32_t tsOverflow,
+		std::pmr::memory_resource *resource) {
+		constructorCheckCapacitySourceTSOverflow(eventCapacity, eventSource, tsOverflow);
+
+		resourceAllocate(resource, eventCapacity, eventSource, tsOverflow, IMU6_EVENT,
+			sizeof(struct caer_imu6_event), offsetof(struct caer_imu6_event, timestamp));
+	}
+#endif
+
 	IMU6EventPacket(caerIMU6EventPacket packet, bool takeMemoryOwnership = true) {
 		constructorCheckNullptr(packet);
 
@@ -129,14 +139,15 @@ public:
 protected:
 	// Event access methods.
 	reference virtualGetEvent(size_type index) noexcept override {
-		caerIMU6Event evtBase = caerIMU6EventPacketGetEvent(reinterpret_cast<caerIMU6EventPacket>(header), index);
+		caerIMU6Event evtBase = caerIMU6EventPacketGetEventUnchecked(
+			reinterpret_cast<caerIMU6EventPacket>(header), index);
 		IMU6Event *evt = static_cast<IMU6Event *>(evtBase);
 
 		return (*evt);
 	}
 
 	const_reference virtualGetEvent(size_type index) const noexcept override {
-		caerIMU6EventConst evtBase = caerIMU6EventPacketGetEventConst(
+		caerIMU6EventConst evtBase = caerIMU6EventPacketGetEventConstUnchecked(
 			reinterpret_cast<caerIMU6EventPacketConst>(header), index);
 		const IMU6Event *evt = static_cast<const IMU6Event *>(evtBase);
 
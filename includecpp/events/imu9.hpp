@@ -132,6 +132,16 @@ public:
 		isMemoryOwner = true; // Always owner on new allocation!
 	}
 
+#if defined(LIBCAER_HAVE_PMR)
+	IMU9EventPacket(size_type eventCapacity, int16_t eventSource, int32_t tsOverflow,
+		std::pmr::memory_resource *resource) {
+		constructorCheckCapacitySourceTSOverflow(eventCapacity, eventSource, tsOverflow);
+
+		resourceAllocate(resource, eventCapacity, eventSource, tsOverflow, IMU9_EVENT,
+			sizeof(struct caer_imu9_event), offsetof(struct caer_imu9_event, timestamp));
+	}
+#endif
+
 	IMU9EventPacket(caerIMU9EventPacket packet, bool takeMemoryOwnership = true) {
 		constructorCheckNullptr(packet);
 
@@ -153,14 +163,15 @@ public:
 protected:
 	// Event access methods.
 	reference virtualGetEvent(size_type index) noexcept override {
-		caerIMU9Event evtBase = caerIMU9EventPacketGetEvent(reinterpret_cast<caerIMU9EventPacket>(header), index);
+		caerIMU9Event evtBase = caerIMU9EventPacketGetEventUnchecked(
+			reinterpret_cast<caerIMU9EventPacket>(header), index);
 		IMU9Event *evt = static_cast<IMU9Event *>(evtBase);
 
 		return (*evt);
 	}
 
 	const_reference virtualGetEvent(size_type index) const noexcept override {
-		caerIMU9EventConst evtBase = caerIMU9EventPacketGetEventConst(
+		caerIMU9EventConst evtBase = caerIMU9EventPacketGetEventConstUnchecked(
 			reinterpret_cast<caerIMU9EventPacketConst>(header), index);
 		const IMU9Event *evt = static_cast<const IMU9Event *>(evtBase);
 
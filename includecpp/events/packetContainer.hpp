@@ -152,7 +152,20 @@ public:
 	}
 };
 
-class EventPacketContainer {
+/**
+ * Event packet container, storing its event packet pointers in a vector
+ * using the given allocator. Use EventPacketContainer for the default
+ * std::allocator, or pmr::EventPacketContainer (C++17 or newer) for a
+ * std::pmr::memory_resource. The allocator is part of the type, so the
+ * same name always refers to the same class, independent of the language
+ * standard a translation unit is compiled with.
+ */
+template<class Allocator = std::allocator<std::shared_ptr<EventPacket>>>
+class BasicEventPacketContainer {
+public:
+	using allocator_type = Allocator;
+	using packets_vector_type = std::vector<std::shared_ptr<EventPacket>, Allocator>;
+
 private:
 	/// Smallest event timestamp contained in this packet container.
 	int64_t lowestEventTimestamp;
@@ -162,8 +175,10 @@ private:
 	int32_t eventsNumber;
 	/// Number of valid events contained within all the packets in this container.
 	int32_t eventsValidNumber;
+	/// Host time (CLOCK_MONOTONIC, in µs) corresponding to the largest event timestamp.
+	int64_t hostTimestamp;
 	/// Vector of pointers to the actual event packets.
-	std::vector<std::shared_ptr<EventPacket>> eventPackets;
+	packets_vector_type eventPackets;
 
 public:
 	// Container traits (not really STL compatible).
@@ -175,11 +190,12 @@ public:
 	/**
 	 * Construct a new EventPacketContainer.
 	 */
-	EventPacketContainer() :
+	BasicEventPacketContainer() :
 			lowestEventTimestamp(-1),
 			highestEventTimestamp(-1),
 			eventsNumber(0),
-			eventsValidNumber(0) {
+			eventsValidNumber(0),
+			hostTimestamp(-1) {
 	}
 
 	/**
@@ -191,23 +207,67 @@ public:
 	 *                           that can be stored in this container.
 	 *                           Must be equal to one or higher.
 	 */
-	EventPacketContainer(size_type eventPacketsNumber) :
+	BasicEventPacketContainer(size_type eventPacketsNumber) :
 			lowestEventTimestamp(-1),
 			highestEventTimestamp(-1),
 			eventsNumber(0),
-			eventsValidNumber(0) {
+			eventsValidNumber(0),
+			hostTimestamp(-1) {
 		if (eventPacketsNumber <= 0) {
 			throw std::invalid_argument("Negative or zero capacity not allowed on explicit construction.");
 		}
 
 		// Initialize and fill vector after having checked size value.
-		eventPackets = std::vector<std::shared_ptr<EventPacket>>(static_cast<size_t>(eventPacketsNumber));
+		eventPackets = packets_vector_type(static_cast<size_t>(eventPacketsNumber));
 
 		for (size_type i = 0; i < eventPacketsNumber; i++) {
 			eventPackets.emplace_back(); // Call empty constructor.
 		}
 	}
 
+	/**
+	 * Construct a new EventPacketContainer, whose internal storage for
+	 * event packet pointers is allocated using the given allocator.
+	 * For pmr::EventPacketContainer, this can be a std::pmr::memory_resource
+	 * pointer, which cannot be nullptr. Use makeSharedEventPacket() to also
+	 * allocate the event packets themselves from a memory resource.
+	 *
+	 * @param alloc the allocator to use for internal storage.
+	 */
+	explicit BasicEventPacketContainer(const allocator_type &alloc) :
+			lowestEventTimestamp(-1),
+			highestEventTimestamp(-1),
+			eventsNumber(0),
+			eventsValidNumber(0),
+			hostTimestamp(-1),
+			eventPackets(alloc) {
+	}
+
+	/**
+	 * Construct a new EventPacketContainer with enough space to
+	 * store up to the given number of event packet pointers, whose
+	 * internal storage is allocated using the given allocator.
+	 * The pointers are present and initialized to nullptr.
+	 *
+	 * @param eventPacketsNumber the initial number of event packet pointers
+	 *                           that can be stored in this container.
+	 *                           Must be equal to one or higher.
+	 * @param alloc the allocator to use for internal storage.
+	 */
+	BasicEventPacketContainer(size_type eventPacketsNumber, const allocator_type &alloc) :
+			lowestEventTimestamp(-1),
+			highestEventTimestamp(-1),
+			eventsNumber(0),
+			eventsValidNumber(0),
+			hostTimestamp(-1),
+			eventPackets(alloc) {
+		if (eventPacketsNumber <= 0) {
+			throw std::invalid_argument("Negative or zero capacity not allowed on explicit construction.");
+		}
+
+		eventPackets.resize(static_cast<size_t>(eventPacketsNumber));
+	}
+
 	// The default destructor is fine here, as it will call the vector's
 	// destructor, which will call all of its content's destructors; those
 	// are shared_ptr, so if their count reaches zero it will then call the
@@ -342,6 +402,26 @@ public:
 		return (highestEventTimestamp);
 	}
 
+	/**
+	 * Get the host time corresponding to the highest timestamp contained in this
+	 * event packet container, see caerEventPacketContainerGetHostTimestamp().
+	 *
+	 * @return the host time (CLOCK_MONOTONIC, in µs) or -1 if not known.
+	 */
+	int64_t getHostTimestamp() const noexcept {
+		return (hostTimestamp);
+	}
+
+	/**
+	 * Set the host time corresponding to the highest timestamp contained in this
+	 * event packet container.
+	 *
+	 * @param hostTs the host time (CLOCK_MONOTONIC, in µs) or -1 if not known.
+	 */
+	void setHostTimestamp(int64_t hostTs) noexcept {
+		hostTimestamp = hostTs;
+	}
+
 	/**
 	 * Get the number of events contained in this event packet container.
 	 *
@@ -577,9 +657,9 @@ public:
 	 *
 	 * @return a deep copy of this event packet container, containing all events.
 	 */
-	std::unique_ptr<EventPacketContainer> copyAllEvents() const {
-		std::unique_ptr<EventPacketContainer> newContainer = std::unique_ptr<EventPacketContainer>(
-			new EventPacketContainer());
+	std::unique_ptr<BasicEventPacketContainer> copyAllEvents() const {
+		std::unique_ptr<BasicEventPacketContainer> newContainer = std::unique_ptr<BasicEventPacketContainer>(
+			new BasicEventPacketContainer());
 
 		for (auto &packet : *this) {
 			if (packet == nullptr) {
@@ -606,9 +686,9 @@ public:
 	 *
 	 * @return a deep copy of this event packet container, containing only valid events.
 	 */
-	std::unique_ptr<EventPacketContainer> copyValidEvents() const {
-		std::unique_ptr<EventPacketContainer> newContainer = std::unique_ptr<EventPacketContainer>(
-			new EventPacketContainer());
+	std::unique_ptr<BasicEventPacketContainer> copyValidEvents() const {
+		std::unique_ptr<BasicEventPacketContainer> newContainer = std::unique_ptr<BasicEventPacketContainer>(
+			new BasicEventPacketContainer());
 
 		for (auto &packet : *this) {
 			if (packet == nullptr) {
@@ -625,8 +705,8 @@ public:
 
 	// Iterator support (the returned shared_ptr are always read-only copies, so actual modifications to
 	// what is pointed to can only happen through setEventPacket() and addEventPacket()).
-	using iterator = EventPacketContainerCopyIterator<std::vector<std::shared_ptr<EventPacket>>::iterator, std::shared_ptr<EventPacket>>;
-	using const_iterator = EventPacketContainerCopyIterator<std::vector<std::shared_ptr<EventPacket>>::const_iterator, std::shared_ptr<const EventPacket>>;
+	using iterator = EventPacketContainerCopyIterator<typename packets_vector_type::iterator, std::shared_ptr<EventPacket>>;
+	using const_iterator = EventPacketContainerCopyIterator<typename packets_vector_type::const_iterator, std::shared_ptr<const EventPacket>>;
 	using reverse_iterator = std::reverse_iterator<iterator>;
 	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
@@ -680,6 +760,41 @@ public:
 }
 ;
 
+using EventPacketContainer = BasicEventPacketContainer<>;
+
+#if defined(LIBCAER_HAVE_PMR)
+namespace pmr {
+/**
+ * Event packet container whose internal storage is allocated from
+ * a std::pmr::memory_resource, see BasicEventPacketContainer.
+ */
+using EventPacketContainer = BasicEventPacketContainer<std::pmr::polymorphic_allocator<std::shared_ptr<EventPacket>>>;
+}
+
+/**
+ * Allocate a new event packet of type PKT, together with its shared_ptr
+ * control block, from the given memory resource. The arguments are
+ * passed to the PKT constructor, followed by the memory resource.
+ * This way all memory used by a processing stage can come from one
+ * arena, for example a std::pmr::monotonic_buffer_resource, and be
+ * released in one step, after all packets referring to it are gone.
+ *
+ * @param resource the memory resource to allocate from. Cannot be nullptr.
+ * @param args the arguments to the PKT memory resource constructor.
+ *
+ * @return a shared pointer to the new event packet.
+ */
+template<class PKT, class ... Args>
+std::shared_ptr<PKT> makeSharedEventPacket(std::pmr::memory_resource *resource, Args &&... args) {
+	if (resource == nullptr) {
+		throw std::invalid_argument("Memory resource cannot be nullptr.");
+	}
+
+	return (std::allocate_shared<PKT>(std::pmr::polymorphic_allocator<PKT>(resource), std::forward<Args>(args)...,
+		resource));
+}
+#endif
+
 }
 }
 
@@ -0,0 +1,187 @@
+#ifndef LIBCAER_EVENTS_PCM_HPP_
+#define LIBCAER_EVENTS_PCM_HPP_
+
+#include <libcaer/events/pcm.h>
+#include "common.hpp"
+
+namespace libcaer {
+namespace events {
+
+struct PCMEvent: public caer_pcm_event {
+	int32_t getTimestamp() const noexcept {
+		return (caerPCMEventGetTimestamp(this));
+	}
+
+	int64_t getTimestamp64(const EventPacket &packet) const noexcept {
+		return (caerPCMEventGetTimestamp64(this, reinterpret_cast<caerPCMEventPacketConst>(packet.getHeaderPointer())));
+	}
+
+	void setTimestamp(int32_t ts) {
+		if (ts < 0) {
+			throw std::invalid_argument("Negative timestamp not allowed.");
+		}
+
+		caerPCMEventSetTimestamp(this, ts);
+	}
+
+	bool isValid() const noexcept {
+		return (caerPCMEventIsValid(this));
+	}
+
+	void validate(EventPacket &packet) noexcept {
+		caerPCMEventValidate(this, reinterpret_cast<caerPCMEventPacket>(packet.getHeaderPointer()));
+	}
+
+	void invalidate(EventPacket &packet) noexcept {
+		caerPCMEventInvalidate(this, reinterpret_cast<caerPCMEventPacket>(packet.getHeaderPointer()));
+	}
+
+	uint8_t getChannel() const noexcept {
+		return (caerPCMEventGetChannel(this));
+	}
+
+	void setChannel(uint8_t c) noexcept {
+		return (caerPCMEventSetChannel(this, c));
+	}
+
+	int32_t getSampleRate() const noexcept {
+		return (caerPCMEventGetSampleRate(this));
+	}
+
+	void setSampleRate(int32_t rate) {
+		if (rate <= 0) {
+			throw std::invalid_argument("Negative or zero sample rate not allowed.");
+		}
+
+		caerPCMEventSetSampleRate(this, rate);
+	}
+
+	int32_t getSampleNumber() const noexcept {
+		return (caerPCMEventGetSampleNumber(this));
+	}
+
+	void setSampleNumber(int32_t number, const EventPacket &packet) {
+		if (number < 0) {
+			throw std::invalid_argument("Negative number of samples not allowed.");
+		}
+
+		if (static_cast<size_t>(number) > caerPCMEventPacketGetSamplesMaxIndex(
+			reinterpret_cast<caerPCMEventPacketConst>(packet.getHeaderPointer()))) {
+			throw std::invalid_argument("Number of samples exceeds maximum allocated space.");
+		}
+
+		caerPCMEventSetSampleNumber(this, number, reinterpret_cast<caerPCMEventPacketConst>(packet.getHeaderPointer()));
+	}
+
+	int32_t getSample(int32_t index) const {
+		// Check samples bounds first.
+		if (index < 0 || index >= caerPCMEventGetSampleNumber(this)) {
+			throw std::invalid_argument("Invalid sample index.");
+		}
+
+		// Get sample value at specified position.
+		return (static_cast<int32_t>(le32toh(this->samples[index])));
+	}
+
+	void setSample(int32_t index, int32_t sampleValue) {
+		// Check samples bounds first.
+		if (index < 0 || index >= caerPCMEventGetSampleNumber(this)) {
+			throw std::invalid_argument("Invalid sample index.");
+		}
+
+		// Set sample value at specified position.
+		this->samples[index] = static_cast<int32_t>(htole32(sampleValue));
+	}
+
+	int32_t *getSampleArrayUnsafe() noexcept {
+		return (this->samples);
+	}
+
+	const int32_t *getSampleArrayUnsafe() const noexcept {
+		return (this->samples);
+	}
+};
+
+static_assert(std::is_pod<PCMEvent>::value, "PCMEvent is not POD.");
+
+class PCMEventPacket: public EventPacketCommon<PCMEventPacket, PCMEvent> {
+public:
+	// Constructors.
+	PCMEventPacket(size_type eventCapacity, int16_t eventSource, int32_t tsOverflow, int32_t maxSampleNumber) {
+		constructorCheckCapacitySourceTSOverflow(eventCapacity, eventSource, tsOverflow);
+
+		if (maxSampleNumber <= 0) {
+			throw std::invalid_argument("Negative or zero maximum number of samples not allowed.");
+		}
+
+		caerPCMEventPacket packet = caerPCMEventPacketAllocate(eventCapacity, eventSource, tsOverflow,
+			maxSampleNumber);
+		constructorCheckNullptr(packet);
+
+		header = &packet->packetHeader;
+		isMemoryOwner = true; // Always owner on new allocation!
+	}
+
+#if defined(LIBCAER_HAVE_PMR)
+	PCMEventPacket(size_type eventCapacity, int16_t eventSource, int32_t tsOverflow, int32_t maxSampleNumber,
+		std::pmr::memory_resource *resource) {
+		constructorCheckCapacitySourceTSOverflow(eventCapacity, eventSource, tsOverflow);
+
+		if (maxSampleNumber <= 0) {
+			throw std::invalid_argument("Negative or zero maximum number of samples not allowed.");
+		}
+
+		// Same event size as caerPCMEventPacketAllocate(), see there.
+		size_t samplesSize = sizeof(int32_t) * static_cast<size_t>(maxSampleNumber);
+		size_t eventSize = (sizeof(struct caer_pcm_event) - sizeof(int32_t)) + samplesSize;
+
+		resourceAllocate(resource, eventCapacity, eventSource, tsOverflow, PCM_EVENT, eventSize,
+			offsetof(struct caer_pcm_event, timestamp));
+	}
+#endif
+
+	PCMEventPacket(caerPCMEventPacket packet, bool takeMemoryOwnership = true) {
+		constructorCheckNullptr(packet);
+
+		constructorCheckEventType(&packet->packetHeader, PCM_EVENT);
+
+		header = &packet->packetHeader;
+		isMemoryOwner = takeMemoryOwnership;
+	}
+
+	PCMEventPacket(caerEventPacketHeader packetHeader, bool takeMemoryOwnership = true) {
+		constructorCheckNullptr(packetHeader);
+
+		constructorCheckEventType(packetHeader, PCM_EVENT);
+
+		header = packetHeader;
+		isMemoryOwner = takeMemoryOwnership;
+	}
+
+protected:
+	// Event access methods.
+	reference virtualGetEvent(size_type index) noexcept override {
+		caerPCMEvent evtBase = caerPCMEventPacketGetEventUnchecked(reinterpret_cast<caerPCMEventPacket>(header), index);
+		PCMEvent *evt = static_cast<PCMEvent *>(evtBase);
+
+		return (*evt);
+	}
+
+	const_reference virtualGetEvent(size_type index) const noexcept override {
+		caerPCMEventConst evtBase = caerPCMEventPacketGetEventConstUnchecked(
+			reinterpret_cast<caerPCMEventPacketConst>(header), index);
+		const PCMEvent *evt = static_cast<const PCMEvent *>(evtBase);
+
+		return (*evt);
+	}
+
+public:
+	size_t getSamplesMaxIndex() const noexcept {
+		return (caerPCMEventPacketGetSamplesMaxIndex(reinterpret_cast<caerPCMEventPacketConst>(header)));
+	}
+};
+
+}
+}
+
+#endif /* LIBCAER_EVENTS_PCM_HPP_ */
@@ -77,6 +77,16 @@ public:
 		isMemoryOwner = true; // Always owner on new allocation!
 	}
 
+#if defined(LIBCAER_HAVE_PMR)
+	Point1DEventPacket(size_type eventCapacity, int16_t eventSource, int32_t tsOverflow,
+		std::pmr::memory_resource *resource) {
+		constructorCheckCapacitySourceTSOverflow(eventCapacity, eventSource, tsOverflow);
+
+		resourceAllocate(resource, eventCapacity, eventSource, tsOverflow, POINT1D_EVENT,
+			sizeof(struct caer_point1d_event), offsetof(struct caer_point1d_event, timestamp));
+	}
+#endif
+
 	Point1DEventPacket(caerPoint1DEventPacket packet, bool takeMemoryOwnership = true) {
 		constructorCheckNullptr(packet);
 
@@ -98,15 +108,15 @@ public:
 protected:
 	// Event access methods.
 	reference virtualGetEvent(size_type index) noexcept override {
-		caerPoint1DEvent evtBase = caerPoint1DEventPacketGetEvent(reinterpret_cast<caerPoint1DEventPacket>(header),
-			index);
+		caerPoint1DEvent evtBase = caerPoint1DEventPacketGetEventUnchecked(
+			reinterpret_cast<caerPoint1DEventPacket>(header), index);
 		Point1DEvent *evt = static_cast<Point1DEvent *>(evtBase);
 
 		return (*evt);
 	}
 
 	const_reference virtualGetEvent(size_type index) const noexcept override {
-		caerPoint1DEventConst evtBase = caerPoint1DEventPacketGetEventConst(
+		caerPoint1DEventConst evtBase = caerPoint1DEventPacketGetEventConstUnchecked(
 			reinterpret_cast<caerPoint1DEventPacketConst>(header), index);
 		const Point1DEvent *evt = static_cast<const Point1DEvent *>(evtBase);
 
@@ -85,6 +85,16 @@ public:
 		isMemoryOwner = true; // Always owner on new allocation!
 	}
 
+#if defined(LIBCAER_HAVE_PMR)
+	Point2DEventPacket(size_type eventCapacity, int16_t eventSource, int32_t tsOverflow,
+		std::pmr::memory_resource *resource) {
+		constructorCheckCapacitySourceTSOverflow(eventCapacity, eventSource, tsOverflow);
+
+		resourceAllocate(resource, eventCapacity, eventSource, tsOverflow, POINT2D_EVENT,
+			sizeof(struct caer_point2d_event), offsetof(struct caer_point2d_event, timestamp));
+	}
+#endif
+
 	Point2DEventPacket(caerPoint2DEventPacket packet, bool takeMemoryOwnership = true) {
 		constructorCheckNullptr(packet);
 
@@ -106,15 +116,15 @@ public:
 protected:
 	// Event access methods.
 	reference virtualGetEvent(size_type index) noexcept override {
-		caerPoint2DEvent evtBase = caerPoint2DEventPacketGetEvent(reinterpret_cast<caerPoint2DEventPacket>(header),
-			index);
+		caerPoint2DEvent evtBase = caerPoint2DEventPacketGetEventUnchecked(
+			reinterpret_cast<caerPoint2DEventPacket>(header), index);
 		Point2DEvent *evt = static_cast<Point2DEvent *>(evtBase);
 
 		return (*evt);
 	}
 
 	const_reference virtualGetEvent(size_type index) const noexcept override {
-		caerPoint2DEventConst evtBase = caerPoint2DEventPacketGetEventConst(
+		caerPoint2DEventConst evtBase = caerPoint2DEventPacketGetEventConstUnchecked(
 			reinterpret_cast<caerPoint2DEventPacketConst>(header), index);
 		const Point2DEvent *evt = static_cast<const Point2DEvent *>(evtBase);
 
@@ -93,6 +93,16 @@ public:
 		isMemoryOwner = true; // Always owner on new allocation!
 	}
 
+#if defined(LIBCAER_HAVE_PMR)
+	Point3DEventPacket(size_type eventCapacity, int16_t eventSource, int32_t tsOverflow,
+		std::pmr::memory_resource *resource) {
+		constructorCheckCapacitySourceTSOverflow(eventCapacity, eventSource, tsOverflow);
+
+		resourceAllocate(resource, eventCapacity, eventSource, tsOverflow, POINT3D_EVENT,
+			sizeof(struct caer_point3d_event), offsetof(struct caer_point3d_event, timestamp));
+	}
+#endif
+
 	Point3DEventPacket(caerPoint3DEventPacket packet, bool takeMemoryOwnership = true) {
 		constructorCheckNullptr(packet);
 
@@ -114,15 +124,15 @@ public:
 protected:
 	// Event access methods.
 	reference virtualGetEvent(size_type index) noexcept override {
-		caerPoint3DEvent evtBase = caerPoint3DEventPacketGetEvent(reinterpret_cast<caerPoint3DEventPacket>(header),
-			index);
+		caerPoint3DEvent evtBase = caerPoint3DEventPacketGetEventUnchecked(
+			reinterpret_cast<caerPoint3DEventPacket>(header), index);
 		Point3DEvent *evt = static_cast<Point3DEvent *>(evtBase);
 
 		return (*evt);
 	}
 
 	const_reference virtualGetEvent(size_type index) const noexcept override {
-		caerPoint3DEventConst evtBase = caerPoint3DEventPacketGetEventConst(
+		caerPoint3DEventConst evtBase = caerPoint3DEventPacketGetEventConstUnchecked(
 			reinterpret_cast<caerPoint3DEventPacketConst>(header), index);
 		const Point3DEvent *evt = static_cast<const Point3DEvent *>(evtBase);
 
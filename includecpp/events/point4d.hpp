@@ -101,6 +101,16 @@ public:
 		isMemoryOwner = true; // Always owner on new allocation!
 	}
 
+#if defined(LIBCAER_HAVE_PMR)
+	Point4DEventPacket(size_type eventCapacity, int16_t eventSource, int32_t tsOverflow,
+		std::pmr::memory_resource *resource) {
+		constructorCheckCapacitySourceTSOverflow(eventCapacity, eventSource, tsOverflow);
+
+		resourceAllocate(resource, eventCapacity, eventSource, tsOverflow, POINT4D_EVENT,
+			sizeof(struct caer_point4d_event), offsetof(struct caer_point4d_event, timestamp));
+	}
+#endif
+
 	Point4DEventPacket(caerPoint4DEventPacket packet, bool takeMemoryOwnership = true) {
 		constructorCheckNullptr(packet);
 
@@ -122,15 +132,15 @@ public:
 protected:
 	// Event access methods.
 	reference virtualGetEvent(size_type index) noexcept override {
-		caerPoint4DEvent evtBase = caerPoint4DEventPacketGetEvent(reinterpret_cast<caerPoint4DEventPacket>(header),
-			index);
+		caerPoint4DEvent evtBase = caerPoint4DEventPacketGetEventUnchecked(
+			reinterpret_cast<caerPoint4DEventPacket>(header), index);
 		Point4DEvent *evt = static_cast<Point4DEvent *>(evtBase);
 
 		return (*evt);
 	}
 
 	const_reference virtualGetEvent(size_type index) const noexcept override {
-		caerPoint4DEventConst evtBase = caerPoint4DEventPacketGetEventConst(
+		caerPoint4DEventConst evtBase = caerPoint4DEventPacketGetEventConstUnchecked(
 			reinterpret_cast<caerPoint4DEventPacketConst>(header), index);
 		const Point4DEvent *evt = static_cast<const Point4DEvent *>(evtBase);
 
@@ -77,6 +77,16 @@ public:
 		isMemoryOwner = true; // Always owner on new allocation!
 	}
 
+#if defined(LIBCAER_HAVE_PMR)
+	PolarityEventPacket(size_type eventCapacity, int16_t eventSource, int32_t tsOverflow,
+		std::pmr::memory_resource *resource) {
+		constructorCheckCapacitySourceTSOverflow(eventCapacity, eventSource, tsOverflow);
+
+		resourceAllocate(resource, eventCapacity, eventSource, tsOverflow, POLARITY_EVENT,
+			sizeof(struct caer_polarity_event), offsetof(struct caer_polarity_event, timestamp));
+	}
+#endif
+
 	PolarityEventPacket(caerPolarityEventPacket packet, bool takeMemoryOwnership = true) {
 		constructorCheckNullptr(packet);
 
@@ -98,15 +108,15 @@ public:
 protected:
 	// Event access methods.
 	reference virtualGetEvent(size_type index) noexcept override {
-		caerPolarityEvent evtBase = caerPolarityEventPacketGetEvent(reinterpret_cast<caerPolarityEventPacket>(header),
-			index);
+		caerPolarityEvent evtBase = caerPolarityEventPacketGetEventUnchecked(
+			reinterpret_cast<caerPolarityEventPacket>(header), index);
 		PolarityEvent *evt = static_cast<PolarityEvent *>(evtBase);
 
 		return (*evt);
 	}
 
 	const_reference virtualGetEvent(size_type index) const noexcept override {
-		caerPolarityEventConst evtBase = caerPolarityEventPacketGetEventConst(
+		caerPolarityEventConst evtBase = caerPolarityEventPacketGetEventConstUnchecked(
 			reinterpret_cast<caerPolarityEventPacketConst>(header), index);
 		const PolarityEvent *evt = static_cast<const PolarityEvent *>(evtBase);
 
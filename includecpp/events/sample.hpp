@@ -69,6 +69,16 @@ public:
 		isMemoryOwner = true; // Always owner on new allocation!
 	}
 
+#if defined(LIBCAER_HAVE_PMR)
+	SampleEventPacket(size_type eventCapacity, int16_t eventSource, int32_t tsOverflow,
+		std::pmr::memory_resource *resource) {
+		constructorCheckCapacitySourceTSOverflow(eventCapacity, eventSource, tsOverflow);
+
+		resourceAllocate(resource, eventCapacity, eventSource, tsOverflow, SAMPLE_EVENT,
+			sizeof(struct caer_sample_event), offsetof(struct caer_sample_event, timestamp));
+	}
+#endif
+
 	SampleEventPacket(caerSampleEventPacket packet, bool takeMemoryOwnership = true) {
 		constructorCheckNullptr(packet);
 
@@ -90,14 +100,15 @@ public:
 protected:
 	// Event access methods.
 	reference virtualGetEvent(size_type index) noexcept override {
-		caerSampleEvent evtBase = caerSampleEventPacketGetEvent(reinterpret_cast<caerSampleEventPacket>(header), index);
+		caerSampleEvent evtBase = caerSampleEventPacketGetEventUnchecked(
+			reinterpret_cast<caerSampleEventPacket>(header), index);
 		SampleEvent *evt = static_cast<SampleEvent *>(evtBase);
 
 		return (*evt);
 	}
 
 	const_reference virtualGetEvent(size_type index) const noexcept override {
-		caerSampleEventConst evtBase = caerSampleEventPacketGetEventConst(
+		caerSampleEventConst evtBase = caerSampleEventPacketGetEventConstUnchecked(
 			reinterpret_cast<caerSampleEventPacketConst>(header), index);
 		const SampleEvent *evt = static_cast<const SampleEvent *>(evtBase);
 
@@ -69,6 +69,16 @@ public:
 		isMemoryOwner = true; // Always owner on new allocation!
 	}
 
+#if defined(LIBCAER_HAVE_PMR)
+	SpecialEventPacket(size_type eventCapacity, int16_t eventSource, int32_t tsOverflow,
+		std::pmr::memory_resource *resource) {
+		constructorCheckCapacitySourceTSOverflow(eventCapacity, eventSource, tsOverflow);
+
+		resourceAllocate(resource, eventCapacity, eventSource, tsOverflow, SPECIAL_EVENT,
+			sizeof(struct caer_special_event), offsetof(struct caer_special_event, timestamp));
+	}
+#endif
+
 	SpecialEventPacket(caerSpecialEventPacket packet, bool takeMemoryOwnership = true) {
 		constructorCheckNullptr(packet);
 
@@ -90,15 +100,15 @@ public:
 protected:
 	// Event access methods.
 	reference virtualGetEvent(size_type index) noexcept override {
-		caerSpecialEvent evtBase = caerSpecialEventPacketGetEvent(reinterpret_cast<caerSpecialEventPacket>(header),
-			index);
+		caerSpecialEvent evtBase = caerSpecialEventPacketGetEventUnchecked(
+			reinterpret_cast<caerSpecialEventPacket>(header), index);
 		SpecialEvent *evt = static_cast<SpecialEvent *>(evtBase);
 
 		return (*evt);
 	}
 
 	const_reference virtualGetEvent(size_type index) const noexcept override {
-		caerSpecialEventConst evtBase = caerSpecialEventPacketGetEventConst(
+		caerSpecialEventConst evtBase = caerSpecialEventPacketGetEventConstUnchecked(
 			reinterpret_cast<caerSpecialEventPacketConst>(header), index);
 		const SpecialEvent *evt = static_cast<const SpecialEvent *>(evtBase);
 
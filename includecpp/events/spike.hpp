@@ -85,6 +85,16 @@ public:
 		isMemoryOwner = true; // Always owner on new allocation!
 	}
 
+#if defined(LIBCAER_HAVE_PMR)
+	SpikeEventPacket(size_type eventCapacity, int16_t eventSource, int32_t tsOverflow,
+		std::pmr::memory_resource *resource) {
+		constructorCheckCapacitySourceTSOverflow(eventCapacity, eventSource, tsOverflow);
+
+		resourceAllocate(resource, eventCapacity, eventSource, tsOverflow, SPIKE_EVENT,
+			sizeof(struct caer_spike_event), offsetof(struct caer_spike_event, timestamp));
+	}
+#endif
+
 	SpikeEventPacket(caerSpikeEventPacket packet, bool takeMemoryOwnership = true) {
 		constructorCheckNullptr(packet);
 
@@ -106,14 +116,15 @@ public:
 protected:
 	// Event access methods.
 	reference virtualGetEvent(size_type index) noexcept override {
-		caerSpikeEvent evtBase = caerSpikeEventPacketGetEvent(reinterpret_cast<caerSpikeEventPacket>(header), index);
+		caerSpikeEvent evtBase = caerSpikeEventPacketGetEventUnchecked(
+			reinterpret_cast<caerSpikeEventPacket>(header), index);
 		SpikeEvent *evt = static_cast<SpikeEvent *>(evtBase);
 
 		return (*evt);
 	}
 
 	const_reference virtualGetEvent(size_type index) const noexcept override {
-		caerSpikeEventConst evtBase = caerSpikeEventPacketGetEventConst(
+		caerSpikeEventConst evtBase = caerSpikeEventPacketGetEventConstUnchecked(
 			reinterpret_cast<caerSpikeEventPacketConst>(header), index);
 		const SpikeEvent *evt = static_cast<const SpikeEvent *>(evtBase);
 
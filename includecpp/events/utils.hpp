@@ -7,6 +7,7 @@
 #include "frame.hpp"
 #include "imu6.hpp"
 #include "imu9.hpp"
+#include "pcm.hpp"
 #include "point1d.hpp"
 #include "point2d.hpp"
 #include "point3d.hpp"
@@ -78,6 +79,10 @@ std::unique_ptr<EventPacket> makeUniqueFromCStruct(caerEventPacketHeader packet)
 			return (std::unique_ptr<SpikeEventPacket>(new SpikeEventPacket(packet)));
 			break;
 
+		case PCM_EVENT:
+			return (std::unique_ptr<PCMEventPacket>(new PCMEventPacket(packet)));
+			break;
+
 		default:
 			return (std::unique_ptr<EventPacket>(new EventPacket(packet)));
 			break;
@@ -138,6 +143,10 @@ std::shared_ptr<EventPacket> makeSharedFromCStruct(caerEventPacketHeader packet)
 			return (std::make_shared<SpikeEventPacket>(packet));
 			break;
 
+		case PCM_EVENT:
+			return (std::make_shared<PCMEventPacket>(packet));
+			break;
+
 		default:
 			return (std::make_shared<EventPacket>(packet));
 			break;
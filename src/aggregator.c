@@ -0,0 +1,538 @@
+#include "aggregator.h"
+
+static const char *aggregatorString = "Device Aggregator";
+
+static bool aggregatorSlotPush(struct aggregator_slot *slot, caerEventPacketHeader packet);
+static int64_t aggregatorSlotFirstTimestamp(struct aggregator_slot *slot);
+static int32_t aggregatorSlotTake(struct aggregator_slot *slot, int64_t end, caerEventPacketHeader *taken);
+static void aggregatorSlotClear(struct aggregator_slot *slot);
+static caerEventPacketHeader aggregatorPacketSlice(caerEventPacketHeaderConst packet, int32_t first, int32_t last);
+static bool aggregatorContainerPush(caerEventPacketContainer **containers, size_t *size, size_t *capacity,
+	caerEventPacketContainer container);
+static bool aggregatorContainerIsTimestampReset(caerEventPacketContainerConst container);
+static void aggregatorDeviceIngest(caerDeviceAggregator aggregator, size_t deviceIndex,
+	caerEventPacketContainer container);
+static caerEventPacketContainer aggregatorWindowGet(caerDeviceAggregator aggregator, bool force);
+static bool aggregatorTimestampResetReady(caerDeviceAggregator aggregator);
+static void aggregatorTimestampReset(caerDeviceAggregator aggregator);
+
+caerDeviceAggregator caerDeviceAggregatorCreate(const caerDeviceHandle *handles, size_t handlesNumber,
+	int32_t packetsPerDevice, int64_t interval, int64_t maxLateness) {
+	if (handles == NULL || handlesNumber == 0 || packetsPerDevice <= 0 || interval <= 0 || maxLateness < 0) {
+		caerLog(CAER_LOG_ERROR, aggregatorString, "Invalid arguments passed to aggregator creation.");
+		return (NULL);
+	}
+
+	// All packets of all devices must fit into one container.
+	if (handlesNumber > (size_t) (INT32_MAX / packetsPerDevice)) {
+		caerLog(CAER_LOG_ERROR, aggregatorString, "Too many devices or packets per device: %zu * %" PRIi32 ".",
+			handlesNumber, packetsPerDevice);
+		return (NULL);
+	}
+
+	for (size_t i = 0; i < handlesNumber; i++) {
+		if (handles[i] == NULL) {
+			caerLog(CAER_LOG_ERROR, aggregatorString, "Device handle %zu is NULL.", i);
+			return (NULL);
+		}
+	}
+
+	caerDeviceAggregator aggregator = calloc(1, sizeof(*aggregator));
+	if (aggregator == NULL) {
+		caerLog(CAER_LOG_CRITICAL, aggregatorString, "Failed to allocate aggregator memory.");
+		return (NULL);
+	}
+
+	aggregator->devicesNumber = handlesNumber;
+	aggregator->packetsPerDevice = packetsPerDevice;
+	aggregator->interval = interval;
+	aggregator->maxLateness = maxLateness;
+	aggregator->windowStart = -1;
+
+	aggregator->devices = calloc(handlesNumber, sizeof(struct aggregator_device));
+	if (aggregator->devices == NULL) {
+		free(aggregator);
+
+		caerLog(CAER_LOG_CRITICAL, aggregatorString, "Failed to allocate aggregator device memory.");
+		return (NULL);
+	}
+
+	for (size_t i = 0; i < handlesNumber; i++) {
+		aggregator->devices[i].handle = handles[i];
+		aggregator->devices[i].watermark = -1;
+
+		aggregator->devices[i].slots = calloc((size_t) packetsPerDevice, sizeof(struct aggregator_slot));
+		if (aggregator->devices[i].slots == NULL) {
+			caerDeviceAggregatorFree(aggregator);
+
+			caerLog(CAER_LOG_CRITICAL, aggregatorString, "Failed to allocate aggregator slot memory.");
+			return (NULL);
+		}
+	}
+
+	return (aggregator);
+}
+
+void caerDeviceAggregatorFree(caerDeviceAggregator aggregator) {
+	if (aggregator == NULL) {
+		return;
+	}
+
+	for (size_t i = 0; i < aggregator->devicesNumber; i++) {
+		struct aggregator_device *device = &aggregator->devices[i];
+
+		if (device->slots != NULL) {
+			for (size_t p = 0; p < (size_t) aggregator->packetsPerDevice; p++) {
+				aggregatorSlotClear(&device->slots[p]);
+			}
+
+			free(device->slots);
+		}
+
+		caerEventPacketContainerFree(device->resetContainer);
+
+		for (size_t h = 0; h < device->heldSize; h++) {
+			caerEventPacketContainerFree(device->held[h]);
+		}
+
+		free(device->held);
+	}
+
+	for (size_t i = 0; i < aggregator->output.size; i++) {
+		caerEventPacketContainerFree(aggregator->output.containers[i]);
+	}
+
+	free(aggregator->output.containers);
+
+	free(aggregator->devices);
+	free(aggregator);
+}
+
+caerEventPacketContainer caerDeviceAggregatorDataGet(caerDeviceAggregator aggregator) {
+	if (aggregator == NULL) {
+		return (NULL);
+	}
+
+	// Get all currently available data from all devices.
+	for (size_t i = 0; i < aggregator->devicesNumber; i++) {
+		caerEventPacketContainer container;
+
+		while ((container = caerDeviceDataGet(aggregator->devices[i].handle)) != NULL) {
+			aggregatorDeviceIngest(aggregator, i, container);
+		}
+	}
+
+	while (aggregatorTimestampResetReady(aggregator)) {
+		aggregatorTimestampReset(aggregator);
+	}
+
+	// Flushed data and timestamp resets first, in order.
+	if (aggregator->output.size > 0) {
+		caerEventPacketContainer container = aggregator->output.containers[0];
+
+		aggregator->output.size--;
+		memmove(aggregator->output.containers, aggregator->output.containers + 1,
+			aggregator->output.size * sizeof(caerEventPacketContainer));
+
+		return (container);
+	}
+
+	return (aggregatorWindowGet(aggregator, false));
+}
+
+int32_t caerDeviceAggregatorGetPacketPosition(caerDeviceAggregator aggregator, size_t deviceIndex,
+	int32_t packetPosition) {
+	if (aggregator == NULL || deviceIndex >= aggregator->devicesNumber || packetPosition < 0
+		|| packetPosition >= aggregator->packetsPerDevice) {
+		return (-1);
+	}
+
+	return (I32T(deviceIndex) * aggregator->packetsPerDevice + packetPosition);
+}
+
+uint64_t caerDeviceAggregatorGetLateEvents(caerDeviceAggregator aggregator) {
+	if (aggregator == NULL) {
+		return (0);
+	}
+
+	return (aggregator->lateEvents);
+}
+
+static bool aggregatorSlotPush(struct aggregator_slot *slot, caerEventPacketHeader packet) {
+	if (slot->packetsSize == slot->packetsCapacity) {
+		size_t newCapacity = (slot->packetsCapacity == 0) ? (4) : (slot->packetsCapacity * 2);
+
+		caerEventPacketHeader *newPackets = realloc(slot->packets, newCapacity * sizeof(caerEventPacketHeader));
+		if (newPackets == NULL) {
+			return (false);
+		}
+
+		slot->packets = newPackets;
+		slot->packetsCapacity = newCapacity;
+	}
+
+	slot->packets[slot->packetsSize++] = packet;
+
+	return (true);
+}
+
+static int64_t aggregatorSlotFirstTimestamp(struct aggregator_slot *slot) {
+	if (slot->packetsSize == 0) {
+		return (AGGREGATOR_TIMESTAMP_MAX);
+	}
+
+	return (caerGenericEventGetTimestamp64(caerGenericEventGetEvent(slot->packets[0], slot->headPosition),
+		slot->packets[0]));
+}
+
+/**
+ * Remove all pending events with a timestamp smaller than 'end' from the slot.
+ * If 'taken' is not NULL, they are returned there as one packet (or NULL if there
+ * were none), else they are discarded. Callers must ensure all taken events
+ * share the same timestamp overflow epoch.
+ * Returns the number of valid events removed.
+ */
+static int32_t aggregatorSlotTake(struct aggregator_slot *slot, int64_t end, caerEventPacketHeader *taken) {
+	int32_t validEvents = 0;
+
+	if (taken != NULL) {
+		*taken = NULL;
+	}
+
+	while (slot->packetsSize > 0) {
+		caerEventPacketHeader packet = slot->packets[0];
+		int32_t eventNumber = caerEventPacketHeaderGetEventNumber(packet);
+
+		int32_t first = slot->headPosition;
+		int32_t last = first;
+
+		while (last < eventNumber
+			&& caerGenericEventGetTimestamp64(caerGenericEventGetEvent(packet, last), packet) < end) {
+			if (caerGenericEventIsValid(caerGenericEventGetEvent(packet, last))) {
+				validEvents++;
+			}
+
+			last++;
+		}
+
+		if (taken != NULL && last > first) {
+			caerEventPacketHeader slice = aggregatorPacketSlice(packet, first, last);
+
+			if (slice == NULL) {
+				caerLog(CAER_LOG_CRITICAL, aggregatorString, "Failed to allocate memory for packet slice.");
+			}
+			else if (*taken == NULL) {
+				*taken = slice;
+			}
+			else {
+				caerEventPacketHeader merged = caerEventPacketAppend(*taken, slice);
+				free(slice);
+
+				if (merged == NULL) {
+					caerLog(CAER_LOG_CRITICAL, aggregatorString, "Failed to append packet slice.");
+				}
+				else {
+					*taken = merged;
+				}
+			}
+		}
+
+		if (last < eventNumber) {
+			// Rest of the packet is after the end, keep it.
+			slot->headPosition = last;
+			break;
+		}
+
+		// Packet fully consumed.
+		free(packet);
+
+		slot->packetsSize--;
+		memmove(slot->packets, slot->packets + 1, slot->packetsSize * sizeof(caerEventPacketHeader));
+		slot->headPosition = 0;
+	}
+
+	return (validEvents);
+}
+
+static void aggregatorSlotClear(struct aggregator_slot *slot) {
+	for (size_t i = 0; i < slot->packetsSize; i++) {
+		free(slot->packets[i]);
+	}
+
+	free(slot->packets);
+
+	slot->packets = NULL;
+	slot->packetsSize = 0;
+	slot->packetsCapacity = 0;
+	slot->headPosition = 0;
+}
+
+static caerEventPacketHeader aggregatorPacketSlice(caerEventPacketHeaderConst packet, int32_t first, int32_t last) {
+	int32_t eventSize = caerEventPacketHeaderGetEventSize(packet);
+	int32_t eventNumber = last - first;
+
+	caerEventPacketHeader slice = malloc(CAER_EVENT_PACKET_HEADER_SIZE + (size_t) (eventNumber * eventSize));
+	if (slice == NULL) {
+		return (NULL);
+	}
+
+	memcpy(slice, packet, CAER_EVENT_PACKET_HEADER_SIZE);
+	memcpy(((uint8_t *) slice) + CAER_EVENT_PACKET_HEADER_SIZE, caerGenericEventGetEvent(packet, first),
+		(size_t) (eventNumber * eventSize));
+
+	int32_t eventValid = 0;
+	for (int32_t i = first; i < last; i++) {
+		if (caerGenericEventIsValid(caerGenericEventGetEvent(packet, i))) {
+			eventValid++;
+		}
+	}
+
+	caerEventPacketHeaderSetEventCapacity(slice, eventNumber);
+	caerEventPacketHeaderSetEventNumber(slice, eventNumber);
+	caerEventPacketHeaderSetEventValid(slice, eventValid);
+
+	return (slice);
+}
+
+static bool aggregatorContainerPush(caerEventPacketContainer **containers, size_t *size, size_t *capacity,
+	caerEventPacketContainer container) {
+	if (*size == *capacity) {
+		size_t newCapacity = (*capacity == 0) ? (4) : (*capacity * 2);
+
+		caerEventPacketContainer *newContainers = realloc(*containers,
+			newCapacity * sizeof(caerEventPacketContainer));
+		if (newContainers == NULL) {
+			return (false);
+		}
+
+		*containers = newContainers;
+		*capacity = newCapacity;
+	}
+
+	(*containers)[(*size)++] = container;
+
+	return (true);
+}
+
+static bool aggregatorContainerIsTimestampReset(caerEventPacketContainerConst container) {
+	caerSpecialEventPacketConst special = (caerSpecialEventPacketConst) caerEventPacketContainerFindEventPacketByTypeConst(
+		container, SPECIAL_EVENT);
+	if (special == NULL) {
+		return (false);
+	}
+
+	return (caerSpecialEventPacketFindValidEventByTypeConst(special, TIMESTAMP_RESET) != NULL);
+}
+
+static void aggregatorDeviceIngest(caerDeviceAggregator aggregator, size_t deviceIndex,
+	caerEventPacketContainer container) {
+	struct aggregator_device *device = &aggregator->devices[deviceIndex];
+
+	// After a timestamp reset, hold back everything until all devices have reset.
+	if (device->resetContainer != NULL) {
+		if (!aggregatorContainerPush(&device->held, &device->heldSize, &device->heldCapacity, container)) {
+			caerLog(CAER_LOG_CRITICAL, aggregatorString,
+				"Failed to hold back container of device %zu during timestamp reset, dropping it.", deviceIndex);
+			caerEventPacketContainerFree(container);
+		}
+
+		return;
+	}
+
+	if (aggregatorContainerIsTimestampReset(container)) {
+		device->resetContainer = container;
+		return;
+	}
+
+	for (int32_t p = 0; p < caerEventPacketContainerGetEventPacketsNumber(container); p++) {
+		caerEventPacketHeader packet = caerEventPacketContainerGetEventPacket(container, p);
+		if (packet == NULL) {
+			continue;
+		}
+
+		// Take ownership of the packet.
+		caerEventPacketContainerSetEventPacket(container, p, NULL);
+
+		int32_t eventNumber = caerEventPacketHeaderGetEventNumber(packet);
+
+		if (eventNumber == 0) {
+			free(packet);
+			continue;
+		}
+
+		if (p >= aggregator->packetsPerDevice) {
+			caerLog(CAER_LOG_WARNING, aggregatorString,
+				"Device %zu packet at position %" PRIi32 " exceeds %" PRIi32 " packets per device, dropping it.",
+				deviceIndex, p, aggregator->packetsPerDevice);
+			free(packet);
+			continue;
+		}
+
+		if (!aggregatorSlotPush(&device->slots[p], packet)) {
+			caerLog(CAER_LOG_CRITICAL, aggregatorString,
+				"Failed to queue packet of device %zu at position %" PRIi32 ", dropping it.", deviceIndex, p);
+			free(packet);
+			continue;
+		}
+
+		int64_t lastTimestamp = caerGenericEventGetTimestamp64(caerGenericEventGetEvent(packet, eventNumber - 1),
+			packet);
+
+		if (lastTimestamp > device->watermark) {
+			device->watermark = lastTimestamp;
+		}
+	}
+
+	caerEventPacketContainerFree(container);
+}
+
+static caerEventPacketContainer aggregatorWindowGet(caerDeviceAggregator aggregator, bool force) {
+	int64_t firstTimestamp = AGGREGATOR_TIMESTAMP_MAX;
+	int64_t minWatermark = AGGREGATOR_TIMESTAMP_MAX;
+	int64_t maxWatermark = -1;
+
+	for (size_t i = 0; i < aggregator->devicesNumber; i++) {
+		struct aggregator_device *device = &aggregator->devices[i];
+
+		for (size_t p = 0; p < (size_t) aggregator->packetsPerDevice; p++) {
+			// Drop anything older than the current window, its time was already returned.
+			if (aggregator->windowStart >= 0) {
+				aggregator->lateEvents += U64T(aggregatorSlotTake(&device->slots[p], aggregator->windowStart, NULL));
+			}
+
+			int64_t slotTimestamp = aggregatorSlotFirstTimestamp(&device->slots[p]);
+			if (slotTimestamp < firstTimestamp) {
+				firstTimestamp = slotTimestamp;
+			}
+		}
+
+		if (device->watermark < minWatermark) {
+			minWatermark = device->watermark;
+		}
+
+		if (device->watermark > maxWatermark) {
+			maxWatermark = device->watermark;
+		}
+	}
+
+	if (firstTimestamp == AGGREGATOR_TIMESTAMP_MAX) {
+		// Nothing pending.
+		return (NULL);
+	}
+
+	// Skip empty windows: start at the window holding the first pending event.
+	int64_t start = (firstTimestamp / aggregator->interval) * aggregator->interval;
+	if (start < aggregator->windowStart) {
+		start = aggregator->windowStart;
+	}
+
+	// Never cross a timestamp overflow epoch, so all slices of a packet can be appended.
+	int64_t end = start + aggregator->interval;
+	int64_t epochEnd = ((start >> TS_OVERFLOW_SHIFT) + 1) << TS_OVERFLOW_SHIFT;
+	if (end > epochEnd) {
+		end = epochEnd;
+	}
+
+	if (!force && minWatermark < end && maxWatermark < (end + aggregator->maxLateness)) {
+		// Still waiting on some device.
+		return (NULL);
+	}
+
+	caerEventPacketContainer window = caerEventPacketContainerAllocate(
+		I32T(aggregator->devicesNumber) * aggregator->packetsPerDevice);
+	if (window == NULL) {
+		caerLog(CAER_LOG_CRITICAL, aggregatorString, "Failed to allocate aggregated packet container.");
+		return (NULL);
+	}
+
+	for (size_t i = 0; i < aggregator->devicesNumber; i++) {
+		for (int32_t p = 0; p < aggregator->packetsPerDevice; p++) {
+			caerEventPacketHeader slice;
+			aggregatorSlotTake(&aggregator->devices[i].slots[p], end, &slice);
+
+			caerEventPacketContainerSetEventPacket(window,
+				caerDeviceAggregatorGetPacketPosition(aggregator, i, p), slice);
+		}
+	}
+
+	aggregator->windowStart = end;
+
+	return (window);
+}
+
+static bool aggregatorTimestampResetReady(caerDeviceAggregator aggregator) {
+	for (size_t i = 0; i < aggregator->devicesNumber; i++) {
+		if (aggregator->devices[i].resetContainer == NULL) {
+			return (false);
+		}
+	}
+
+	return (true);
+}
+
+static void aggregatorTimestampReset(caerDeviceAggregator aggregator) {
+	caerEventPacketContainer container;
+
+	// Flush all data from before the reset, without waiting on watermarks.
+	while ((container = aggregatorWindowGet(aggregator, true)) != NULL) {
+		if (!aggregatorContainerPush(&aggregator->output.containers, &aggregator->output.size,
+			&aggregator->output.capacity, container)) {
+			caerLog(CAER_LOG_CRITICAL, aggregatorString, "Failed to queue flushed container, dropping it.");
+			caerEventPacketContainerFree(container);
+		}
+	}
+
+	// One container with the timestamp reset of every device, at its positions.
+	container = caerEventPacketContainerAllocate(I32T(aggregator->devicesNumber) * aggregator->packetsPerDevice);
+	if (container == NULL) {
+		caerLog(CAER_LOG_CRITICAL, aggregatorString, "Failed to allocate timestamp reset packet container.");
+	}
+
+	for (size_t i = 0; i < aggregator->devicesNumber; i++) {
+		struct aggregator_device *device = &aggregator->devices[i];
+
+		// Anything still pending could not be flushed, timestamps restart now.
+		for (size_t p = 0; p < (size_t) aggregator->packetsPerDevice; p++) {
+			aggregatorSlotClear(&device->slots[p]);
+		}
+
+		for (int32_t p = 0;
+			container != NULL && p < caerEventPacketContainerGetEventPacketsNumber(device->resetContainer)
+				&& p < aggregator->packetsPerDevice; p++) {
+			caerEventPacketContainerSetEventPacket(container, caerDeviceAggregatorGetPacketPosition(aggregator, i, p),
+				caerEventPacketContainerGetEventPacket(device->resetContainer, p));
+			caerEventPacketContainerSetEventPacket(device->resetContainer, p, NULL);
+		}
+
+		caerEventPacketContainerFree(device->resetContainer);
+		device->resetContainer = NULL;
+		device->watermark = -1;
+	}
+
+	if (container != NULL
+		&& !aggregatorContainerPush(&aggregator->output.containers, &aggregator->output.size,
+			&aggregator->output.capacity, container)) {
+		caerLog(CAER_LOG_CRITICAL, aggregatorString, "Failed to queue timestamp reset container, dropping it.");
+		caerEventPacketContainerFree(container);
+	}
+
+	aggregator->windowStart = -1;
+
+	// Now process what arrived after the reset, in order.
+	for (size_t i = 0; i < aggregator->devicesNumber; i++) {
+		struct aggregator_device *device = &aggregator->devices[i];
+
+		caerEventPacketContainer *held = device->held;
+		size_t heldSize = device->heldSize;
+
+		device->held = NULL;
+		device->heldSize = 0;
+		device->heldCapacity = 0;
+
+		for (size_t h = 0; h < heldSize; h++) {
+			aggregatorDeviceIngest(aggregator, i, held[h]);
+		}
+
+		free(held);
+	}
+}
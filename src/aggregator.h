@@ -0,0 +1,52 @@
+#ifndef LIBCAER_SRC_AGGREGATOR_H_
+#define LIBCAER_SRC_AGGREGATOR_H_
+
+#include "libcaer.h"
+#include "devices/aggregator.h"
+#include "events/special.h"
+
+// Timestamp beyond anything a device can generate, used as open interval end.
+#define AGGREGATOR_TIMESTAMP_MAX INT64_MAX
+
+// Pending packets for one position of one device, oldest first.
+struct aggregator_slot {
+	caerEventPacketHeader *packets;
+	size_t packetsSize;
+	size_t packetsCapacity;
+	// Index of the first not yet emitted event in packets[0].
+	int32_t headPosition;
+};
+
+struct aggregator_device {
+	caerDeviceHandle handle;
+	struct aggregator_slot *slots;
+	// Highest timestamp seen from this device, -1 if none yet.
+	int64_t watermark;
+	// Timestamp reset barrier: container with the reset, and later containers
+	// held back until all devices have reset.
+	caerEventPacketContainer resetContainer;
+	caerEventPacketContainer *held;
+	size_t heldSize;
+	size_t heldCapacity;
+};
+
+// Simple FIFO of ready output containers.
+struct aggregator_output {
+	caerEventPacketContainer *containers;
+	size_t size;
+	size_t capacity;
+};
+
+struct caer_device_aggregator {
+	size_t devicesNumber;
+	int32_t packetsPerDevice;
+	int64_t interval;
+	int64_t maxLateness;
+	// Start of the next interval to emit, -1 if not yet known.
+	int64_t windowStart;
+	uint64_t lateEvents;
+	struct aggregator_output output;
+	struct aggregator_device *devices;
+};
+
+#endif /* LIBCAER_SRC_AGGREGATOR_H_ */
@@ -11,6 +11,8 @@
 #if defined(__linux__)
 	#include <sys/prctl.h>
 	#include <sys/resource.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
 #endif
 
 typedef pthread_t thrd_t;
@@ -402,4 +404,34 @@ static inline int thrd_set_priority(int priority) {
 #endif
 }
 
+// NON STANDARD!
+static inline int thrd_set_affinity(uint32_t cpuMask) {
+#if defined(__linux__)
+	// Direct system call, as the glibc wrappers require _GNU_SOURCE.
+	// A TID of zero means the calling thread only.
+	unsigned long cpuSet = cpuMask;
+
+	if (syscall(SYS_sched_setaffinity, 0, sizeof(cpuSet), &cpuSet) != 0) {
+		return (thrd_error);
+	}
+
+	return (thrd_success);
+#else
+	(void)(cpuMask); // UNUSED.
+
+	return (thrd_error);
+#endif
+}
+
+// NON STANDARD!
+static inline int thrd_set_scheduling(int policy, int priority) {
+	struct sched_param schedParam = { .sched_priority = priority };
+
+	if (pthread_setschedparam(pthread_self(), policy, &schedParam) != 0) {
+		return (thrd_error);
+	}
+
+	return (thrd_success);
+}
+
 #endif	/* C11THREADS_POSIX_H_ */
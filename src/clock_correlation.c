@@ -0,0 +1,164 @@
+#include "clock_correlation.h"
+
+static inline int64_t roundToInt64(double value) {
+	int64_t result = I64T(value); // Truncates towards zero.
+	double remainder = value - (double) result;
+
+	if ((remainder * 2) >= 1) {
+		result++;
+	}
+	else if ((remainder * 2) <= -1) {
+		result--;
+	}
+
+	return (result);
+}
+
+static double clockCorrelationSlope(struct clock_correlation *clock) {
+	if (clock->varianceDevice <= 0) {
+		return (1);
+	}
+
+	double slope = clock->covariance / clock->varianceDevice;
+
+	// Clamp to a sane drift, early estimates over short spans can be way off.
+	double maxDrift = (double) CLOCK_CORRELATION_MAX_DRIFT_PPB / CLOCK_CORRELATION_PPB;
+
+	if (slope > (1 + maxDrift)) {
+		slope = 1 + maxDrift;
+	}
+
+	if (slope < (1 - maxDrift)) {
+		slope = 1 - maxDrift;
+	}
+
+	return (slope);
+}
+
+static void clockCorrelationPublish(struct clock_correlation *clock, bool valid) {
+	// Odd sequence number: update in progress.
+	uint_fast32_t sequence = atomic_load_explicit(&clock->sequence, memory_order_relaxed);
+	atomic_store_explicit(&clock->sequence, sequence + 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+
+	if (valid) {
+		double slope = clockCorrelationSlope(clock);
+
+		// Reference point at the center of the fitted samples, where the fit is most precise.
+		int64_t modelDevice = clock->deviceAnchor + roundToInt64(clock->meanDevice);
+		int64_t modelHost = clock->hostAnchor
+			+ roundToInt64(clock->meanHost + (slope * ((double) (modelDevice - clock->deviceAnchor) - clock->meanDevice)));
+
+		atomic_store_explicit(&clock->modelDevice, modelDevice, memory_order_relaxed);
+		atomic_store_explicit(&clock->modelHost, modelHost, memory_order_relaxed);
+		atomic_store_explicit(&clock->modelDriftPpb, roundToInt64((slope - 1) * CLOCK_CORRELATION_PPB), memory_order_relaxed);
+	}
+
+	atomic_store_explicit(&clock->modelValid, valid, memory_order_relaxed);
+
+	atomic_store_explicit(&clock->sequence, sequence + 2, memory_order_release);
+}
+
+void clockCorrelationReset(struct clock_correlation *clock) {
+	clock->anchored = false;
+	clock->deviceAnchor = 0;
+	clock->hostAnchor = 0;
+	clock->lastDeviceTimestamp = 0;
+	clock->samples = 0;
+	clock->meanDevice = 0;
+	clock->meanHost = 0;
+	clock->varianceDevice = 0;
+	clock->covariance = 0;
+	clock->residualDeviation = 0;
+
+	clockCorrelationPublish(clock, false);
+}
+
+void clockCorrelationUpdate(struct clock_correlation *clock, int64_t deviceTimestamp, int64_t hostTimestamp) {
+	if (!clock->anchored) {
+		// All fitting is done relative to the first pair, to keep the numbers small.
+		clock->anchored = true;
+		clock->deviceAnchor = deviceTimestamp;
+		clock->hostAnchor = hostTimestamp;
+		clock->lastDeviceTimestamp = deviceTimestamp;
+		return;
+	}
+
+	// Buffers arrive much faster than the clocks drift, so thin them out.
+	// This also skips buffers that didn't carry any new timestamp.
+	if ((deviceTimestamp - clock->lastDeviceTimestamp) < CLOCK_CORRELATION_SAMPLE_INTERVAL) {
+		return;
+	}
+
+	clock->lastDeviceTimestamp = deviceTimestamp;
+
+	double x = (double) (deviceTimestamp - clock->deviceAnchor);
+	double y = (double) (hostTimestamp - clock->hostAnchor);
+
+	if (clock->samples >= 2) {
+		double residual = y - (clock->meanHost + (clockCorrelationSlope(clock) * (x - clock->meanDevice)));
+
+		// Host times are only ever late, never early (USB latency, scheduling delays),
+		// so samples far above the fit are outliers that would drag it.
+		if (clock->samples >= CLOCK_CORRELATION_WARMUP_SAMPLES
+			&& residual
+				> ((CLOCK_CORRELATION_OUTLIER_FACTOR * clock->residualDeviation) + CLOCK_CORRELATION_OUTLIER_MINIMUM)) {
+			return;
+		}
+
+		double residualAbs = (residual >= 0) ? (residual) : (-residual);
+		clock->residualDeviation += (residualAbs - clock->residualDeviation)
+			/ (double) ((clock->samples < CLOCK_CORRELATION_WINDOW_SAMPLES) ?
+				(clock->samples) : (CLOCK_CORRELATION_WINDOW_SAMPLES));
+	}
+
+	clock->samples++;
+
+	// Exponentially weighted mean and covariance, plain average until the window is full.
+	double alpha =
+		(clock->samples < CLOCK_CORRELATION_WINDOW_SAMPLES) ?
+			(1 / (double) clock->samples) : (1 / (double) CLOCK_CORRELATION_WINDOW_SAMPLES);
+
+	double dx = x - clock->meanDevice;
+	double dy = y - clock->meanHost;
+
+	clock->meanDevice += alpha * dx;
+	clock->meanHost += alpha * dy;
+	clock->varianceDevice = (1 - alpha) * (clock->varianceDevice + (alpha * dx * dx));
+	clock->covariance = (1 - alpha) * (clock->covariance + (alpha * dx * dy));
+
+	if (clock->samples >= CLOCK_CORRELATION_WARMUP_SAMPLES) {
+		clockCorrelationPublish(clock, true);
+	}
+}
+
+int64_t clockCorrelationToHost(struct clock_correlation *clock, int64_t deviceTimestamp) {
+	uint_fast32_t sequenceStart = 0, sequenceEnd = 0;
+	bool modelValid = false;
+	int64_t modelDevice = 0, modelHost = 0, modelDriftPpb = 0;
+
+	// Retry until we get a copy that was not being updated while we read it.
+	do {
+		sequenceStart = atomic_load_explicit(&clock->sequence, memory_order_acquire);
+		if ((sequenceStart & 0x01) != 0) {
+			continue;
+		}
+
+		modelValid = atomic_load_explicit(&clock->modelValid, memory_order_relaxed);
+		modelDevice = atomic_load_explicit(&clock->modelDevice, memory_order_relaxed);
+		modelHost = atomic_load_explicit(&clock->modelHost, memory_order_relaxed);
+		modelDriftPpb = atomic_load_explicit(&clock->modelDriftPpb, memory_order_relaxed);
+
+		atomic_thread_fence(memory_order_acquire);
+		sequenceEnd = atomic_load_explicit(&clock->sequence, memory_order_relaxed);
+	}
+	while ((sequenceStart & 0x01) != 0 || sequenceStart != sequenceEnd);
+
+	if (!modelValid || deviceTimestamp < 0) {
+		return (-1);
+	}
+
+	int64_t deviceDelta = deviceTimestamp - modelDevice;
+
+	return (modelHost + deviceDelta + roundToInt64((double) deviceDelta * (double) modelDriftPpb / CLOCK_CORRELATION_PPB));
+}
@@ -0,0 +1,46 @@
+#ifndef LIBCAER_SRC_CLOCK_CORRELATION_H_
+#define LIBCAER_SRC_CLOCK_CORRELATION_H_
+
+#include "libcaer.h"
+#include <stdatomic.h>
+
+// Only pair device and host times at least this far apart (in device µs).
+#define CLOCK_CORRELATION_SAMPLE_INTERVAL 1000
+// Samples needed before the model is published and outliers are rejected.
+#define CLOCK_CORRELATION_WARMUP_SAMPLES 32
+// Exponential forgetting: the fit covers roughly this many recent samples.
+#define CLOCK_CORRELATION_WINDOW_SAMPLES 8192
+// Reject host times later than the fit by more than factor * average deviation + minimum (µs).
+#define CLOCK_CORRELATION_OUTLIER_FACTOR 4
+#define CLOCK_CORRELATION_OUTLIER_MINIMUM 50
+// Sanity limit on the clock drift between device and host, in parts per billion.
+#define CLOCK_CORRELATION_MAX_DRIFT_PPB 1000000
+#define CLOCK_CORRELATION_PPB 1000000000
+
+struct clock_correlation {
+	// Estimator state, only touched by the data acquisition thread.
+	bool anchored;
+	int64_t deviceAnchor;
+	int64_t hostAnchor;
+	int64_t lastDeviceTimestamp;
+	uint32_t samples;
+	double meanDevice;
+	double meanHost;
+	double varianceDevice;
+	double covariance;
+	double residualDeviation;
+	// Published model, protected by a sequence lock: the data acquisition
+	// thread is the only writer, and never waits on readers.
+	// host = modelHost + (device - modelDevice) * (1 + modelDriftPpb / 10^9)
+	atomic_uint_fast32_t sequence;
+	atomic_bool modelValid;
+	atomic_int_fast64_t modelDevice;
+	atomic_int_fast64_t modelHost;
+	atomic_int_fast64_t modelDriftPpb;
+};
+
+void clockCorrelationReset(struct clock_correlation *clock);
+void clockCorrelationUpdate(struct clock_correlation *clock, int64_t deviceTimestamp, int64_t hostTimestamp);
+int64_t clockCorrelationToHost(struct clock_correlation *clock, int64_t deviceTimestamp);
+
+#endif /* LIBCAER_SRC_CLOCK_CORRELATION_H_ */
@@ -3,6 +3,11 @@
 static void davisEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent);
 static int davisDataAcquisitionThread(void *inPtr);
 static void davisDataAcquisitionThreadConfig(davisHandle handle);
+static void davisDataReplay(davisHandle handle);
+static bool davisDataExchangeFlush(davisState state);
+static size_t davisDataExchangeUsage(davisState state);
+static void davisCaptureConfigPack(davisHandle handle, uint8_t *config);
+static bool davisCaptureConfigApply(davisHandle handle, const uint8_t *config);
 
 static inline void checkStrictMonotonicTimestamp(davisHandle handle) {
 	if (handle->state.currentTimestamp <= handle->state.lastTimestamp) {
@@ -118,6 +123,13 @@ static inline void freeAllDataMemory(davisState state) {
 		state->dataExchangeBuffer = NULL;
 	}
 
+	for (size_t i = 1; i < CAER_HOST_CONFIG_QUEUES_NUMBER; i++) {
+		if (state->dataQueueBuffers[i] != NULL) {
+			ringBufferFree(state->dataQueueBuffers[i]);
+			state->dataQueueBuffers[i] = NULL;
+		}
+	}
+
 	// Since the current event packets aren't necessarily
 	// already assigned to the current packet container, we
 	// free them separately from it.
@@ -183,6 +195,12 @@ static inline void freeAllDataMemory(davisState state) {
 		// Reset pointers to NULL.
 		state->currentFrameEvent[i] = NULL;
 	}
+
+	memoryUsageSet(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_PACKETS, 0);
+	memoryUsageSet(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_FRAME_BUFFERS, 0);
+
+	usbCaptureStop(&state->usbState);
+	usbReplayStop(&state->usbState);
 }
 
 bool davisCommonOpen(davisHandle handle, uint16_t VID, uint16_t PID, const char *deviceName, uint16_t deviceID,
@@ -193,10 +211,14 @@ bool davisCommonOpen(davisHandle handle, uint16_t VID, uint16_t PID, const char
 	// Initialize state variables to default values (if not zero, taken care of by calloc above).
 	atomic_store_explicit(&state->dataExchangeBufferSize, 64, memory_order_relaxed);
 	atomic_store_explicit(&state->dataExchangeBlocking, false, memory_order_relaxed);
+	watermarkInit(&state->dataExchangeWatermark);
 	atomic_store_explicit(&state->dataExchangeStartProducers, true, memory_order_relaxed);
 	atomic_store_explicit(&state->dataExchangeStopProducers, true, memory_order_relaxed);
 	atomic_store_explicit(&state->usbBufferNumber, 8, memory_order_relaxed);
 	atomic_store_explicit(&state->usbBufferSize, 8192, memory_order_relaxed);
+	atomic_store_explicit(&state->usbCaptureFd, -1, memory_order_relaxed);
+	atomic_store_explicit(&state->usbCaptureTranslate, true, memory_order_relaxed);
+	atomic_store_explicit(&state->usbReplayFd, -1, memory_order_relaxed);
 
 	// Packet settings (size (in events) and time interval (in µs)).
 	atomic_store_explicit(&state->maxPacketContainerPacketSize, 8192, memory_order_relaxed);
@@ -488,6 +510,7 @@ bool (*configSet)(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, uint3
 
 	(*configSet)(cdh, DAVIS_CONFIG_MICROPHONE, DAVIS_CONFIG_MICROPHONE_RUN, false); // Microphones disabled by default.
 	(*configSet)(cdh, DAVIS_CONFIG_MICROPHONE, DAVIS_CONFIG_MICROPHONE_SAMPLE_FREQUENCY, 32); // 48 KHz sampling frequency.
+	(*configSet)(cdh, DAVIS_CONFIG_MICROPHONE, DAVIS_CONFIG_MICROPHONE_PCM_OUTPUT, false); // One sample event per sample.
 
 	if (handle->info.extInputHasGenerator) {
 		// Disable generator by default. Has to be enabled manually after sendDefaultConfig() by user!
@@ -796,15 +819,31 @@ bool davisCommonConfigSet(davisHandle handle, int8_t modAddr, uint8_t paramAddr,
 				case CAER_HOST_CONFIG_USB_BUFFER_NUMBER:
 					atomic_store(&state->usbBufferNumber, param);
 
-					// Notify data acquisition thread to change buffers.
+					// Notify data acquisition thread to change buffers, and wake
+					// it up, so this happens right away, even if no data is flowing.
 					atomic_fetch_or(&state->dataAcquisitionThreadConfigUpdate, 1 << 0);
+					usbThreadWakeup(&state->usbState);
 					break;
 
 				case CAER_HOST_CONFIG_USB_BUFFER_SIZE:
 					atomic_store(&state->usbBufferSize, param);
 
-					// Notify data acquisition thread to change buffers.
+					// Notify data acquisition thread to change buffers, and wake
+					// it up, so this happens right away, even if no data is flowing.
 					atomic_fetch_or(&state->dataAcquisitionThreadConfigUpdate, 1 << 0);
+					usbThreadWakeup(&state->usbState);
+					break;
+
+				case CAER_HOST_CONFIG_USB_CAPTURE_FD:
+					atomic_store(&state->usbCaptureFd, I32T(param));
+					break;
+
+				case CAER_HOST_CONFIG_USB_CAPTURE_TRANSLATE:
+					atomic_store(&state->usbCaptureTranslate, param);
+					break;
+
+				case CAER_HOST_CONFIG_USB_REPLAY_FD:
+					atomic_store(&state->usbReplayFd, I32T(param));
 					break;
 
 				default:
@@ -831,12 +870,32 @@ bool davisCommonConfigSet(davisHandle handle, int8_t modAddr, uint8_t paramAddr,
 					atomic_store(&state->dataExchangeStopProducers, param);
 					break;
 
+				case CAER_HOST_CONFIG_DATAEXCHANGE_HIGH_WATERMARK:
+					return (watermarkSetHigh(&state->dataExchangeWatermark, param));
+					break;
+
+				case CAER_HOST_CONFIG_DATAEXCHANGE_LOW_WATERMARK:
+					return (watermarkSetLow(&state->dataExchangeWatermark, param));
+					break;
+
 				default:
 					return (false);
 					break;
 			}
 			break;
 
+		case CAER_HOST_CONFIG_SHEDDING: {
+			size_t packetPosition = (size_t) (paramAddr - CAER_HOST_CONFIG_SHEDDING_PACKET_LEVEL);
+
+			// Special events hold the timestamp resets, never shed them.
+			if (packetPosition >= DAVIS_EVENT_TYPES || param > 100 || (packetPosition == SPECIAL_EVENT && param != 0)) {
+				return (false);
+			}
+
+			atomic_store(&state->dataExchangeSheddingLevel[packetPosition], U8T(param));
+			break;
+		}
+
 		case CAER_HOST_CONFIG_PACKETS:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_PACKET_SIZE:
@@ -847,12 +906,67 @@ bool davisCommonConfigSet(davisHandle handle, int8_t modAddr, uint8_t paramAddr,
 					atomic_store(&state->maxPacketContainerInterval, param);
 					break;
 
+				case CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_LATENCY:
+					atomic_store(&state->maxPacketContainerLatency, param);
+					break;
+
+				default:
+					return (false);
+					break;
+			}
+			break;
+
+		case CAER_HOST_CONFIG_THREAD:
+			switch (paramAddr) {
+				case CAER_HOST_CONFIG_THREAD_CPU_AFFINITY:
+					atomic_store(&state->dataAcquisitionThreadCpuAffinity, param);
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_SCHED_POLICY:
+					if (param > CAER_HOST_CONFIG_THREAD_SCHED_RR) {
+						return (false);
+					}
+
+					atomic_store(&state->dataAcquisitionThreadSchedPolicy, param);
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_SCHED_PRIORITY:
+					atomic_store(&state->dataAcquisitionThreadSchedPriority, param);
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_MEMORY_LOCK:
+					atomic_store(&state->dataAcquisitionThreadMemoryLock, param);
+					break;
+
 				default:
 					return (false);
 					break;
 			}
 			break;
 
+		case CAER_HOST_CONFIG_QUEUES:
+			if (paramAddr < CAER_HOST_CONFIG_QUEUES_INTERVAL) {
+				// Packet position to queue assignment.
+				size_t packetPosition = (size_t) (paramAddr - CAER_HOST_CONFIG_QUEUES_PACKET_QUEUE);
+
+				if (packetPosition >= DAVIS_EVENT_TYPES || param >= CAER_HOST_CONFIG_QUEUES_NUMBER) {
+					return (false);
+				}
+
+				atomic_store(&state->dataQueuePacketQueue[packetPosition], U8T(param));
+			}
+			else {
+				// Secondary queue commit interval. Queue 0 uses CAER_HOST_CONFIG_PACKETS.
+				size_t queue = (size_t) (paramAddr - CAER_HOST_CONFIG_QUEUES_INTERVAL);
+
+				if (queue == 0 || queue >= CAER_HOST_CONFIG_QUEUES_NUMBER) {
+					return (false);
+				}
+
+				atomic_store(&state->dataQueueInterval[queue], param);
+			}
+			break;
+
 		case DAVIS_CONFIG_MUX:
 			switch (paramAddr) {
 				case DAVIS_CONFIG_MUX_RUN:
@@ -1251,10 +1365,22 @@ bool davisCommonConfigSet(davisHandle handle, int8_t modAddr, uint8_t paramAddr,
 		case DAVIS_CONFIG_MICROPHONE:
 			switch (paramAddr) {
 				case DAVIS_CONFIG_MICROPHONE_RUN:
-				case DAVIS_CONFIG_MICROPHONE_SAMPLE_FREQUENCY:
 					return (spiConfigSend(state->usbState.deviceHandle, DAVIS_CONFIG_MICROPHONE, paramAddr, param));
 					break;
 
+				case DAVIS_CONFIG_MICROPHONE_SAMPLE_FREQUENCY:
+					if (!spiConfigSend(state->usbState.deviceHandle, DAVIS_CONFIG_MICROPHONE, paramAddr, param)) {
+						return (false);
+					}
+
+					// Remember for the sample rate of PCM output.
+					atomic_store(&state->micSampleFrequency, param);
+					break;
+
+				case DAVIS_CONFIG_MICROPHONE_PCM_OUTPUT:
+					atomic_store(&state->micPCMOutput, param);
+					break;
+
 				default:
 					return (false);
 					break;
@@ -1496,6 +1622,18 @@ bool davisCommonConfigGet(davisHandle handle, int8_t modAddr, uint8_t paramAddr,
 					*param = U32T(atomic_load(&state->usbBufferSize));
 					break;
 
+				case CAER_HOST_CONFIG_USB_CAPTURE_FD:
+					*param = U32T(atomic_load(&state->usbCaptureFd));
+					break;
+
+				case CAER_HOST_CONFIG_USB_CAPTURE_TRANSLATE:
+					*param = atomic_load(&state->usbCaptureTranslate);
+					break;
+
+				case CAER_HOST_CONFIG_USB_REPLAY_FD:
+					*param = U32T(atomic_load(&state->usbReplayFd));
+					break;
+
 				default:
 					return (false);
 					break;
@@ -1520,12 +1658,31 @@ bool davisCommonConfigGet(davisHandle handle, int8_t modAddr, uint8_t paramAddr,
 					*param = atomic_load(&state->dataExchangeStopProducers);
 					break;
 
+				case CAER_HOST_CONFIG_DATAEXCHANGE_HIGH_WATERMARK:
+					*param = U32T(atomic_load(&state->dataExchangeWatermark.high));
+					break;
+
+				case CAER_HOST_CONFIG_DATAEXCHANGE_LOW_WATERMARK:
+					*param = U32T(atomic_load(&state->dataExchangeWatermark.low));
+					break;
+
 				default:
 					return (false);
 					break;
 			}
 			break;
 
+		case CAER_HOST_CONFIG_SHEDDING: {
+			size_t packetPosition = (size_t) (paramAddr - CAER_HOST_CONFIG_SHEDDING_PACKET_LEVEL);
+
+			if (packetPosition >= DAVIS_EVENT_TYPES) {
+				return (false);
+			}
+
+			*param = U32T(atomic_load(&state->dataExchangeSheddingLevel[packetPosition]));
+			break;
+		}
+
 		case CAER_HOST_CONFIG_PACKETS:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_PACKET_SIZE:
@@ -1536,12 +1693,63 @@ bool davisCommonConfigGet(davisHandle handle, int8_t modAddr, uint8_t paramAddr,
 					*param = U32T(atomic_load(&state->maxPacketContainerInterval));
 					break;
 
+				case CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_LATENCY:
+					*param = U32T(atomic_load(&state->maxPacketContainerLatency));
+					break;
+
+				default:
+					return (false);
+					break;
+			}
+			break;
+
+		case CAER_HOST_CONFIG_THREAD:
+			switch (paramAddr) {
+				case CAER_HOST_CONFIG_THREAD_CPU_AFFINITY:
+					*param = U32T(atomic_load(&state->dataAcquisitionThreadCpuAffinity));
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_SCHED_POLICY:
+					*param = U32T(atomic_load(&state->dataAcquisitionThreadSchedPolicy));
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_SCHED_PRIORITY:
+					*param = U32T(atomic_load(&state->dataAcquisitionThreadSchedPriority));
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_MEMORY_LOCK:
+					*param = atomic_load(&state->dataAcquisitionThreadMemoryLock);
+					break;
+
 				default:
 					return (false);
 					break;
 			}
 			break;
 
+		case CAER_HOST_CONFIG_QUEUES:
+			if (paramAddr < CAER_HOST_CONFIG_QUEUES_INTERVAL) {
+				// Packet position to queue assignment.
+				size_t packetPosition = (size_t) (paramAddr - CAER_HOST_CONFIG_QUEUES_PACKET_QUEUE);
+
+				if (packetPosition >= DAVIS_EVENT_TYPES) {
+					return (false);
+				}
+
+				*param = U32T(atomic_load(&state->dataQueuePacketQueue[packetPosition]));
+			}
+			else {
+				// Secondary queue commit interval. Queue 0 uses CAER_HOST_CONFIG_PACKETS.
+				size_t queue = (size_t) (paramAddr - CAER_HOST_CONFIG_QUEUES_INTERVAL);
+
+				if (queue == 0 || queue >= CAER_HOST_CONFIG_QUEUES_NUMBER) {
+					return (false);
+				}
+
+				*param = U32T(atomic_load(&state->dataQueueInterval[queue]));
+			}
+			break;
+
 		case DAVIS_CONFIG_MUX:
 			switch (paramAddr) {
 				case DAVIS_CONFIG_MUX_RUN:
@@ -1879,6 +2087,10 @@ bool davisCommonConfigGet(davisHandle handle, int8_t modAddr, uint8_t paramAddr,
 					return (spiConfigReceive(state->usbState.deviceHandle, DAVIS_CONFIG_MICROPHONE, paramAddr, param));
 					break;
 
+				case DAVIS_CONFIG_MICROPHONE_PCM_OUTPUT:
+					*param = atomic_load(&state->micPCMOutput);
+					break;
+
 				default:
 					return (false);
 					break;
@@ -2113,6 +2325,125 @@ bool davisCommonConfigGet(davisHandle handle, int8_t modAddr, uint8_t paramAddr,
 	return (true);
 }
 
+static inline uint8_t *captureConfigPut16(uint8_t *position, uint16_t value) {
+	value = htole16(value);
+	memcpy(position, &value, sizeof(value));
+
+	return (position + sizeof(value));
+}
+
+static inline const uint8_t *captureConfigGet16(const uint8_t *position, uint16_t *value) {
+	memcpy(value, position, sizeof(*value));
+	*value = le16toh(*value);
+
+	return (position + sizeof(*value));
+}
+
+static inline uint8_t *captureConfigPutFloat(uint8_t *position, float value) {
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	bits = htole32(bits);
+	memcpy(position, &bits, sizeof(bits));
+
+	return (position + sizeof(bits));
+}
+
+static inline const uint8_t *captureConfigGetFloat(const uint8_t *position, float *value) {
+	uint32_t bits;
+	memcpy(&bits, position, sizeof(bits));
+	bits = le32toh(bits);
+	memcpy(value, &bits, sizeof(bits));
+
+	return (position + sizeof(bits));
+}
+
+static inline uint16_t captureConfigFlags(davisState state) {
+	return (U16T(state->dvsInvertXY | (state->apsInvertXY << 1) | (state->apsFlipX << 2) | (state->apsFlipY << 3)
+		| (state->imuFlipX << 4) | (state->imuFlipY << 5) | (state->imuFlipZ << 6) | (state->apsGlobalShutter << 7)
+		| (state->apsResetRead << 8)));
+}
+
+// Store the configuration the translator depends on, as of data acquisition
+// start, into DAVIS_CAPTURE_CONFIG_SIZE bytes, little-endian.
+static void davisCaptureConfigPack(davisHandle handle, uint8_t *config) {
+	davisState state = &handle->state;
+
+	uint16_t flags = captureConfigFlags(state);
+
+	uint8_t *position = config;
+
+	position = captureConfigPut16(position, U16T(handle->info.chipID));
+	position = captureConfigPut16(position, U16T(handle->info.logicVersion));
+	position = captureConfigPut16(position, U16T(state->dvsSizeX));
+	position = captureConfigPut16(position, U16T(state->dvsSizeY));
+	position = captureConfigPut16(position, U16T(state->apsSizeX));
+	position = captureConfigPut16(position, U16T(state->apsSizeY));
+	position = captureConfigPut16(position, flags);
+	*position++ = handle->info.apsColorFilter;
+	*position++ = 0; // Padding.
+	position = captureConfigPutFloat(position, state->imuAccelScale);
+	position = captureConfigPutFloat(position, state->imuGyroScale);
+
+	for (size_t i = 0; i < APS_ROI_REGIONS_MAX; i++) {
+		position = captureConfigPut16(position, state->apsROIPositionX[i]);
+		position = captureConfigPut16(position, state->apsROIPositionY[i]);
+		position = captureConfigPut16(position, state->apsROISizeX[i]);
+		position = captureConfigPut16(position, state->apsROISizeY[i]);
+	}
+}
+
+// Check that a USB capture comes from the same kind of chip, with the same
+// sizes and orientation, and translate it with the APS modes, IMU scales and
+// ROI regions it was made with.
+static bool davisCaptureConfigApply(davisHandle handle, const uint8_t *config) {
+	davisState state = &handle->state;
+
+	uint16_t chipID, logicVersion, dvsSizeX, dvsSizeY, apsSizeX, apsSizeY, flags;
+	const uint8_t *position = config;
+
+	position = captureConfigGet16(position, &chipID);
+	position = captureConfigGet16(position, &logicVersion);
+	position = captureConfigGet16(position, &dvsSizeX);
+	position = captureConfigGet16(position, &dvsSizeY);
+	position = captureConfigGet16(position, &apsSizeX);
+	position = captureConfigGet16(position, &apsSizeY);
+	position = captureConfigGet16(position, &flags);
+	uint8_t apsColorFilter = *position++;
+	position++; // Padding.
+
+	if (I16T(chipID) != handle->info.chipID || I16T(dvsSizeX) != state->dvsSizeX
+		|| I16T(dvsSizeY) != state->dvsSizeY || I16T(apsSizeX) != state->apsSizeX
+		|| I16T(apsSizeY) != state->apsSizeY || apsColorFilter != handle->info.apsColorFilter
+		|| (flags & DAVIS_CAPTURE_CONFIG_ORIENTATION_FLAGS)
+			!= (captureConfigFlags(state) & DAVIS_CAPTURE_CONFIG_ORIENTATION_FLAGS)) {
+		caerLog(CAER_LOG_CRITICAL, handle->info.deviceString,
+			"USB capture comes from a different chip (ID %" PRIu16 ", DVS %" PRIu16 "x%" PRIu16 ", APS %" PRIu16 "x%" PRIu16 ", orientation 0x%02" PRIX16 "), cannot translate it with this device.",
+			chipID, dvsSizeX, dvsSizeY, apsSizeX, apsSizeY, U16T(flags & DAVIS_CAPTURE_CONFIG_ORIENTATION_FLAGS));
+		return (false);
+	}
+
+	if (I16T(logicVersion) != handle->info.logicVersion) {
+		caerLog(CAER_LOG_WARNING, handle->info.deviceString,
+			"USB capture comes from logic version %" PRIu16 ", this device has %" PRIi16 ".", logicVersion,
+			handle->info.logicVersion);
+	}
+
+	state->apsGlobalShutter = (flags >> 7) & 0x01;
+	state->apsResetRead = (flags >> 8) & 0x01;
+
+	position = captureConfigGetFloat(position, &state->imuAccelScale);
+	position = captureConfigGetFloat(position, &state->imuGyroScale);
+
+	for (size_t i = 0; i < APS_ROI_REGIONS_MAX; i++) {
+		position = captureConfigGet16(position, &state->apsROIPositionX[i]);
+		position = captureConfigGet16(position, &state->apsROIPositionY[i]);
+		position = captureConfigGet16(position, &state->apsROISizeX[i]);
+		position = captureConfigGet16(position, &state->apsROISizeY[i]);
+	}
+
+	return (true);
+}
+
 bool davisCommonDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr),
 	void (*dataNotifyDecrease)(void *ptr), void *dataNotifyUserPtr, void (*dataShutdownNotify)(void *ptr),
 	void *dataShutdownUserPtr) {
@@ -2130,6 +2461,12 @@ bool davisCommonDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void
 	// will then set this correctly.
 	state->currentPacketContainerCommitTimestamp = -1;
 
+	// No events are waiting for commit yet.
+	state->currentPacketContainerDeadline = -1;
+
+	// Device and host clocks have to be correlated anew.
+	clockCorrelationReset(&state->clockCorrelation);
+
 	// Initialize RingBuffer.
 	state->dataExchangeBuffer = ringBufferInit(atomic_load(&state->dataExchangeBufferSize));
 	if (state->dataExchangeBuffer == NULL) {
@@ -2137,6 +2474,51 @@ bool davisCommonDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void
 		return (false);
 	}
 
+	// Watermarks follow the new buffer size.
+	watermarkReset(&state->dataExchangeWatermark, ringBufferSize(state->dataExchangeBuffer),
+		ringBufferPutCapacity(state->dataExchangeBuffer));
+
+	// Sample packet to queue assignments, and initialize the secondary queues in use.
+	state->currentDataQueuesEnabled = false;
+
+	for (size_t i = 0; i < DAVIS_EVENT_TYPES; i++) {
+		state->currentDataQueuePacketQueue[i] = U8T(atomic_load(&state->dataQueuePacketQueue[i]));
+	}
+
+	for (size_t i = 1; i < CAER_HOST_CONFIG_QUEUES_NUMBER; i++) {
+		state->dataQueueCommitTimestamp[i] = -1;
+
+		state->dataQueueCommitInterval[i] = I64T(atomic_load(&state->dataQueueInterval[i]));
+		if (state->dataQueueCommitInterval[i] == 0) {
+			state->dataQueueCommitInterval[i] = I64T(atomic_load(&state->maxPacketContainerInterval));
+		}
+		if (state->dataQueueCommitInterval[i] == 0) {
+			state->dataQueueCommitInterval[i] = 1;
+		}
+
+		bool queueUsed = false;
+
+		for (size_t j = 0; j < DAVIS_EVENT_TYPES; j++) {
+			if (state->currentDataQueuePacketQueue[j] == i) {
+				queueUsed = true;
+			}
+		}
+
+		if (!queueUsed) {
+			continue;
+		}
+
+		state->currentDataQueuesEnabled = true;
+
+		state->dataQueueBuffers[i] = ringBufferInit(atomic_load(&state->dataExchangeBufferSize));
+		if (state->dataQueueBuffers[i] == NULL) {
+			freeAllDataMemory(state);
+
+			caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to initialize data queue %zu buffer.", i);
+			return (false);
+		}
+	}
+
 	// Allocate packets.
 	state->currentPacketContainer = caerEventPacketContainerAllocate(DAVIS_EVENT_TYPES);
 	if (state->currentPacketContainer == NULL) {
@@ -2217,6 +2599,10 @@ bool davisCommonDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void
 		return (false);
 	}
 
+	memoryUsageSet(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_FRAME_BUFFERS,
+		(APS_ROI_REGIONS_MAX * eventSize)
+			+ ((size_t) state->apsSizeX * (size_t) state->apsSizeY * APS_ADC_CHANNELS * sizeof(uint16_t)));
+
 	// Default IMU settings (for event parsing).
 	uint32_t param32 = 0;
 
@@ -2242,6 +2628,29 @@ bool davisCommonDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void
 	spiConfigReceive(state->usbState.deviceHandle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_RESET_READ, &param32);
 	state->apsResetRead = param32;
 
+	spiConfigReceive(state->usbState.deviceHandle, DAVIS_CONFIG_MICROPHONE, DAVIS_CONFIG_MICROPHONE_SAMPLE_FREQUENCY,
+		&param32);
+	atomic_store(&state->micSampleFrequency, param32);
+
+	// Raw USB data replay, translated with the configuration stored in the capture.
+	uint8_t captureConfig[DAVIS_CAPTURE_CONFIG_SIZE];
+
+	if (!usbReplayStart(&state->usbState, handle->info.deviceString, I32T(atomic_load(&state->usbReplayFd)),
+		handle->deviceType, captureConfig, DAVIS_CAPTURE_CONFIG_SIZE)
+		|| (state->usbState.replay && !davisCaptureConfigApply(handle, captureConfig))) {
+		freeAllDataMemory(state);
+		return (false);
+	}
+
+	// Raw USB data capture, storing the configuration the data is translated with.
+	davisCaptureConfigPack(handle, captureConfig);
+
+	if (!usbCaptureStart(&state->usbState, handle->info.deviceString, I32T(atomic_load(&state->usbCaptureFd)),
+		atomic_load(&state->usbCaptureTranslate), handle->deviceType, captureConfig, DAVIS_CAPTURE_CONFIG_SIZE)) {
+		freeAllDataMemory(state);
+		return (false);
+	}
+
 	if ((errno = thrd_create(&state->dataAcquisitionThread, &davisDataAcquisitionThread, handle)) != thrd_success) {
 		freeAllDataMemory(state);
 
@@ -2288,19 +2697,45 @@ bool davisCommonDataStop(caerDeviceHandle cdh) {
 		return (false);
 	}
 
-	// Empty ringbuffer.
+	// Empty ringbuffer, including the timestamp resets still waiting to enter it.
+	// A successful flush can still move some of those in, so drain until all is empty.
 	caerEventPacketContainer container;
-	while ((container = ringBufferGet(state->dataExchangeBuffer)) != NULL) {
-		// Notify data-not-available call-back.
-		if (state->dataNotifyDecrease != NULL) {
-			state->dataNotifyDecrease(state->dataNotifyUserPtr);
+	do {
+		while ((container = ringBufferGet(state->dataExchangeBuffer)) != NULL) {
+			memoryUsageRemove(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE,
+				memoryUsageContainerSize(container));
+
+			// Notify data-not-available call-back.
+			if (state->dataNotifyDecrease != NULL) {
+				state->dataNotifyDecrease(state->dataNotifyUserPtr);
+			}
+
+			// Free container, which will free its subordinate packets too.
+			caerEventPacketContainerFree(container);
 		}
 
-		// Free container, which will free its subordinate packets too.
-		caerEventPacketContainerFree(container);
-	}
+		// Empty secondary queues.
+		for (size_t i = 1; i < CAER_HOST_CONFIG_QUEUES_NUMBER; i++) {
+			if (state->dataQueueBuffers[i] == NULL) {
+				continue;
+			}
+
+			while ((container = ringBufferGet(state->dataQueueBuffers[i])) != NULL) {
+				memoryUsageRemove(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE,
+					memoryUsageContainerSize(container));
+
+				// Notify data-not-available call-back.
+				if (state->dataNotifyDecrease != NULL) {
+					state->dataNotifyDecrease(state->dataNotifyUserPtr);
+				}
+
+				// Free container, which will free its subordinate packets too.
+				caerEventPacketContainerFree(container);
+			}
+		}
+	} while (!davisDataExchangeFlush(state) || davisDataExchangeUsage(state) != 0);
 
-	// Free current, uncommitted packets and ringbuffer.
+	// Free current, uncommitted packets and ringbuffers.
 	freeAllDataMemory(state);
 
 	// Reset packet positions.
@@ -2324,6 +2759,13 @@ caerEventPacketContainer davisCommonDataGet(caerDeviceHandle cdh) {
 	retry: container = ringBufferGet(state->dataExchangeBuffer);
 
 	if (container != NULL) {
+		// The container now belongs to the caller.
+		size_t containerSize = memoryUsageContainerSize(container);
+		memoryUsageRemove(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, containerSize);
+		memoryUsageAdd(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DELIVERED, containerSize);
+
+		watermarkUpdate(&state->dataExchangeWatermark, ringBufferUsage(state->dataExchangeBuffer));
+
 		// Found an event container, return it and signal this piece of data
 		// is no longer available for later acquisition.
 		if (state->dataNotifyDecrease != NULL) {
@@ -2348,60 +2790,782 @@ caerEventPacketContainer davisCommonDataGet(caerDeviceHandle cdh) {
 	return (NULL);
 }
 
-#define TS_WRAP_ADD 0x8000
+size_t davisCommonDataGetBatch(caerDeviceHandle cdh, caerEventPacketContainer *containers, size_t maxContainers) {
+	davisHandle handle = (davisHandle) cdh;
+	davisState state = &handle->state;
 
-static inline int64_t generateFullTimestamp(int32_t tsOverflow, int32_t timestamp) {
-	return (I64T((U64T(tsOverflow) << TS_OVERFLOW_SHIFT) | U64T(timestamp)));
-}
+	size_t containersNumber = 0;
 
-static inline void initContainerCommitTimestamp(davisState state) {
-	if (state->currentPacketContainerCommitTimestamp == -1) {
-		state->currentPacketContainerCommitTimestamp = state->currentTimestamp
-			+ I32T(atomic_load_explicit(&state->maxPacketContainerInterval, memory_order_relaxed)) - 1;
+	if (containers == NULL || maxContainers == 0) {
+		return (0);
+	}
+
+	retry: containersNumber = ringBufferGetBatch(state->dataExchangeBuffer, (void **) containers, maxContainers);
+
+	if (containersNumber != 0) {
+		// The containers now belong to the caller.
+		for (size_t i = 0; i < containersNumber; i++) {
+			size_t containerSize = memoryUsageContainerSize(containers[i]);
+			memoryUsageRemove(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, containerSize);
+			memoryUsageAdd(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DELIVERED, containerSize);
+
+			// Signal each piece of data is no longer available for later acquisition.
+			if (state->dataNotifyDecrease != NULL) {
+				state->dataNotifyDecrease(state->dataNotifyUserPtr);
+			}
+		}
+
+		watermarkUpdate(&state->dataExchangeWatermark, ringBufferUsage(state->dataExchangeBuffer));
+
+		return (containersNumber);
+	}
+
+	// Didn't find any event container, either report this or retry, depending
+	// on blocking setting.
+	if (atomic_load_explicit(&state->dataExchangeBlocking, memory_order_relaxed)) {
+		// Don't retry right away in a tight loop, back off and wait a little.
+		// If no data is available, sleep for a millisecond to avoid wasting resources.
+		struct timespec noDataSleep = { .tv_sec = 0, .tv_nsec = 1000000 };
+		if (thrd_sleep(&noDataSleep, NULL) == 0) {
+			goto retry;
+		}
 	}
+
+	// Nothing.
+	return (0);
 }
 
-static void davisEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent) {
-	davisHandle handle = vhd;
+caerEventPacketContainer davisCommonDataGetQueue(caerDeviceHandle cdh, uint8_t queue) {
+	davisHandle handle = (davisHandle) cdh;
 	davisState state = &handle->state;
+	caerEventPacketContainer container = NULL;
 
-	// Return right away if not running anymore. This prevents useless work if many
-	// buffers are still waiting when shut down, as well as incorrect event sequences
-	// if a TS_RESET is stuck on ring-buffer commit further down, and detects shut-down;
-	// then any subsequent buffers should also detect shut-down and not be handled.
-	if (!atomic_load_explicit(&state->dataAcquisitionThreadRun, memory_order_relaxed)) {
-		return;
+	if (queue == 0) {
+		return (davisCommonDataGet(cdh));
 	}
 
-	// Truncate off any extra partial event.
-	if ((bytesSent & 0x01) != 0) {
-		caerLog(CAER_LOG_ALERT, handle->info.deviceString,
-			"%zu bytes received via USB, which is not a multiple of two.", bytesSent);
-		bytesSent &= (size_t) ~0x01;
+	// Only queues that have packets assigned to them exist.
+	if (queue >= CAER_HOST_CONFIG_QUEUES_NUMBER || state->dataQueueBuffers[queue] == NULL) {
+		return (NULL);
 	}
 
-	for (size_t i = 0; i < bytesSent; i += 2) {
-		// Allocate new packets for next iteration as needed.
-		if (state->currentPacketContainer == NULL) {
-			state->currentPacketContainer = caerEventPacketContainerAllocate(DAVIS_EVENT_TYPES);
-			if (state->currentPacketContainer == NULL) {
-				caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate event packet container.");
-				return;
-			}
-		}
+	retry: container = ringBufferGet(state->dataQueueBuffers[queue]);
 
-		if (state->currentPolarityPacket == NULL) {
-			state->currentPolarityPacket = caerPolarityEventPacketAllocate(
-			DAVIS_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->wrapOverflow);
+	if (container != NULL) {
+		// The container now belongs to the caller.
+		size_t containerSize = memoryUsageContainerSize(container);
+		memoryUsageRemove(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, containerSize);
+		memoryUsageAdd(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DELIVERED, containerSize);
+
+		// Found an event container, return it and signal this piece of data
+		// is no longer available for later acquisition.
+		if (state->dataNotifyDecrease != NULL) {
+			state->dataNotifyDecrease(state->dataNotifyUserPtr);
+		}
+
+		return (container);
+	}
+
+	// Didn't find any event container, either report this or retry, depending
+	// on blocking setting.
+	if (atomic_load_explicit(&state->dataExchangeBlocking, memory_order_relaxed)) {
+		// Don't retry right away in a tight loop, back off and wait a little.
+		// If no data is available, sleep for a millisecond to avoid wasting resources.
+		struct timespec noDataSleep = { .tv_sec = 0, .tv_nsec = 1000000 };
+		if (thrd_sleep(&noDataSleep, NULL) == 0) {
+			goto retry;
+		}
+	}
+
+	// Nothing.
+	return (NULL);
+}
+
+int64_t davisCommonTimestampToHost(caerDeviceHandle cdh, int64_t deviceTimestamp) {
+	davisHandle handle = (davisHandle) cdh;
+
+	return (clockCorrelationToHost(&handle->state.clockCorrelation, deviceTimestamp));
+}
+
+bool davisCommonProfilingGet(caerDeviceHandle cdh, struct caer_device_profiling_stage *stages) {
+	davisHandle handle = (davisHandle) cdh;
+
+	return (profilingGet(&handle->state.usbState.profiling, stages));
+}
+
+bool davisCommonMemoryUsageGet(caerDeviceHandle cdh, struct caer_device_memory_usage *usages) {
+	davisHandle handle = (davisHandle) cdh;
+
+	return (memoryUsageGet(&handle->state.usbState.memoryUsage, usages));
+}
+
+bool davisCommonDataWatermarkNotifySet(caerDeviceHandle cdh, void (*dataWatermarkNotify)(void *ptr, bool high),
+	void *dataWatermarkUserPtr) {
+	davisHandle handle = (davisHandle) cdh;
+	davisState state = &handle->state;
+
+	// Both producer and consumers may call the notification, so it can't change under them.
+	if (state->dataExchangeBuffer != NULL) {
+		caerLog(CAER_LOG_ERROR, handle->info.deviceString,
+			"Cannot change watermark notification while data exchange is running.");
+		return (false);
+	}
+
+	state->dataExchangeWatermark.notify = dataWatermarkNotify;
+	state->dataExchangeWatermark.notifyUserPtr = dataWatermarkUserPtr;
+
+	return (true);
+}
+
+#define TS_WRAP_ADD 0x8000
+
+static inline int64_t generateFullTimestamp(int32_t tsOverflow, int32_t timestamp) {
+	return (I64T((U64T(tsOverflow) << TS_OVERFLOW_SHIFT) | U64T(timestamp)));
+}
+
+static inline void initContainerCommitTimestamp(davisState state) {
+	if (state->currentPacketContainerCommitTimestamp == -1) {
+		state->currentPacketContainerCommitTimestamp = state->currentTimestamp
+			+ I32T(atomic_load_explicit(&state->maxPacketContainerInterval, memory_order_relaxed)) - 1;
+	}
+}
+
+// Repack microphone sample events into one contiguous block of samples per
+// channel, if PCM output is enabled. On failure the sample events are kept.
+static caerEventPacketHeader davisMicrophonePacketConvert(davisHandle handle, caerSampleEventPacket samplePacket) {
+	davisState state = &handle->state;
+
+	if (!atomic_load_explicit(&state->micPCMOutput, memory_order_relaxed)) {
+		return ((caerEventPacketHeader) samplePacket);
+	}
+
+	// Sample type is the channel: 0 is left, 1 is right.
+	int32_t channelSamples[DAVIS_MICROPHONE_CHANNELS] = { 0 };
+	int32_t maxChannelSamples = 0;
+
+	CAER_SAMPLE_CONST_ITERATOR_VALID_START(samplePacket)
+		uint8_t channel = caerSampleEventGetType(caerSampleIteratorElement);
+
+		if (channel < DAVIS_MICROPHONE_CHANNELS) {
+			channelSamples[channel]++;
+
+			if (channelSamples[channel] > maxChannelSamples) {
+				maxChannelSamples = channelSamples[channel];
+			}
+		}
+	CAER_SAMPLE_ITERATOR_VALID_END
+
+	if (maxChannelSamples == 0) {
+		return ((caerEventPacketHeader) samplePacket);
+	}
+
+	caerPCMEventPacket pcmPacket = caerPCMEventPacketAllocate(DAVIS_MICROPHONE_CHANNELS,
+		caerEventPacketHeaderGetEventSource(&samplePacket->packetHeader),
+		caerEventPacketHeaderGetEventTSOverflow(&samplePacket->packetHeader), maxChannelSamples);
+	if (pcmPacket == NULL) {
+		caerLog(CAER_LOG_ERROR, handle->info.deviceString,
+			"Failed to allocate PCM event packet, delivering microphone samples as Sample events.");
+		return ((caerEventPacketHeader) samplePacket);
+	}
+
+	// Sample frequency is the SCK clock cycle length, with 64 SCK cycles per sample.
+	uint32_t sampleFrequency = U32T(atomic_load_explicit(&state->micSampleFrequency, memory_order_relaxed));
+	int32_t sampleRate = 0;
+	if (sampleFrequency != 0) {
+		sampleRate = I32T((U32T(handle->info.logicClock) * 1000000) / (64 * sampleFrequency));
+	}
+
+	// Only channels with samples get an event, in channel order.
+	caerPCMEvent channelEvents[DAVIS_MICROPHONE_CHANNELS] = { NULL };
+	int32_t pcmPacketPosition = 0;
+
+	for (uint8_t channel = 0; channel < DAVIS_MICROPHONE_CHANNELS; channel++) {
+		if (channelSamples[channel] == 0) {
+			continue;
+		}
+
+		channelEvents[channel] = caerPCMEventPacketGetEvent(pcmPacket, pcmPacketPosition++);
+
+		caerPCMEventSetChannel(channelEvents[channel], channel);
+		if (sampleRate > 0) {
+			caerPCMEventSetSampleRate(channelEvents[channel], sampleRate);
+		}
+
+		channelSamples[channel] = 0;
+	}
+
+	CAER_SAMPLE_CONST_ITERATOR_VALID_START(samplePacket)
+		uint8_t channel = caerSampleEventGetType(caerSampleIteratorElement);
+
+		if (channel < DAVIS_MICROPHONE_CHANNELS) {
+			caerPCMEvent channelEvent = channelEvents[channel];
+
+			if (channelSamples[channel] == 0) {
+				caerPCMEventSetTimestamp(channelEvent, caerSampleEventGetTimestamp(caerSampleIteratorElement));
+			}
+
+			// Microphones send 24 bit two's complement samples, sign-extend them.
+			int32_t sample = I32T(caerSampleEventGetSample(caerSampleIteratorElement) ^ 0x00800000) - 0x00800000;
+
+			caerPCMEventGetSampleArrayUnsafe(channelEvent)[channelSamples[channel]] = I32T(htole32(U32T(sample)));
+			channelSamples[channel]++;
+		}
+	CAER_SAMPLE_ITERATOR_VALID_END
+
+	for (uint8_t channel = 0; channel < DAVIS_MICROPHONE_CHANNELS; channel++) {
+		if (channelEvents[channel] != NULL) {
+			caerPCMEventSetSampleNumber(channelEvents[channel], channelSamples[channel], pcmPacket);
+			caerPCMEventValidate(channelEvents[channel], pcmPacket);
+		}
+	}
+
+	free(samplePacket);
+
+	return ((caerEventPacketHeader) pcmPacket);
+}
+
+static inline int32_t davisPacketPosition(davisState state, size_t packetPosition) {
+	switch (packetPosition) {
+		case POLARITY_EVENT:
+			return (state->currentPolarityPacketPosition);
+
+		case SPECIAL_EVENT:
+			return (state->currentSpecialPacketPosition);
+
+		case FRAME_EVENT:
+			return (state->currentFramePacketPosition);
+
+		case IMU6_EVENT:
+			return (state->currentIMU6PacketPosition);
+
+		case DAVIS_SAMPLE_POSITION:
+			return (state->currentSamplePacketPosition);
+
+		default:
+			return (0);
+	}
+}
+
+// Take ownership of a non-empty current packet, new events will go into a new one.
+static caerEventPacketHeader davisPacketTake(davisHandle handle, size_t packetPosition) {
+	davisState state = &handle->state;
+	caerEventPacketHeader packet = NULL;
+
+	if (davisPacketPosition(state, packetPosition) == 0) {
+		return (NULL);
+	}
+
+	switch (packetPosition) {
+		case POLARITY_EVENT:
+			packet = (caerEventPacketHeader) state->currentPolarityPacket;
+			state->currentPolarityPacket = NULL;
+			state->currentPolarityPacketPosition = 0;
+			break;
+
+		case SPECIAL_EVENT:
+			packet = (caerEventPacketHeader) state->currentSpecialPacket;
+			state->currentSpecialPacket = NULL;
+			state->currentSpecialPacketPosition = 0;
+			break;
+
+		case FRAME_EVENT:
+			packet = (caerEventPacketHeader) state->currentFramePacket;
+			state->currentFramePacket = NULL;
+			state->currentFramePacketPosition = 0;
+			break;
+
+		case IMU6_EVENT:
+			packet = (caerEventPacketHeader) state->currentIMU6Packet;
+			state->currentIMU6Packet = NULL;
+			state->currentIMU6PacketPosition = 0;
+			break;
+
+		case DAVIS_SAMPLE_POSITION:
+			packet = davisMicrophonePacketConvert(handle, state->currentSamplePacket);
+			state->currentSamplePacket = NULL;
+			state->currentSamplePacketPosition = 0;
+			break;
+
+		default:
+			break;
+	}
+
+	return (packet);
+}
+
+// Commit the packets assigned to secondary queues, each queue following its own
+// time interval. Runs before the main commit, which then skips those packets.
+static void davisDataQueuesCommit(davisHandle handle, bool tsReset, bool tsBigWrap, bool forceCommit) {
+	davisState state = &handle->state;
+
+	int64_t currentTimestamp = generateFullTimestamp(state->wrapOverflow, state->currentTimestamp);
+	int32_t commitSize = I32T(atomic_load_explicit(&state->maxPacketContainerPacketSize, memory_order_relaxed));
+
+	for (size_t queue = 1; queue < CAER_HOST_CONFIG_QUEUES_NUMBER; queue++) {
+		if (state->dataQueueBuffers[queue] == NULL) {
+			continue;
+		}
+
+		if (state->dataQueueCommitTimestamp[queue] == -1) {
+			state->dataQueueCommitTimestamp[queue] = currentTimestamp + state->dataQueueCommitInterval[queue] - 1;
+		}
+
+		bool sizeCommit = false;
+
+		for (size_t i = 0; i < DAVIS_EVENT_TYPES; i++) {
+			if (state->currentDataQueuePacketQueue[i] == queue && commitSize > 0
+				&& davisPacketPosition(state, i) >= commitSize) {
+				sizeCommit = true;
+			}
+		}
+
+		bool timeCommit = currentTimestamp > state->dataQueueCommitTimestamp[queue];
+
+		if (!(forceCommit || tsReset || tsBigWrap || sizeCommit || timeCommit)) {
+			continue;
+		}
+
+		PROFILING_START(commitStart);
+
+		if (timeCommit) {
+			while (currentTimestamp > state->dataQueueCommitTimestamp[queue]) {
+				state->dataQueueCommitTimestamp[queue] += state->dataQueueCommitInterval[queue];
+			}
+		}
+
+		// Only non-empty packets are forwarded, and only non-empty containers.
+		caerEventPacketContainer container = NULL;
+
+		for (size_t i = 0; i < DAVIS_EVENT_TYPES; i++) {
+			if (state->currentDataQueuePacketQueue[i] != queue) {
+				continue;
+			}
+
+			caerEventPacketHeader packet = davisPacketTake(handle, i);
+			if (packet == NULL) {
+				continue;
+			}
+
+			if (container == NULL) {
+				container = caerEventPacketContainerAllocate(DAVIS_EVENT_TYPES);
+				if (container == NULL) {
+					caerLog(CAER_LOG_CRITICAL, handle->info.deviceString,
+						"Failed to allocate data queue event packet container.");
+					free(packet);
+					continue;
+				}
+			}
+
+			caerEventPacketContainerSetEventPacket(container, I32T(i), packet);
+		}
+
+		// Shed packets based on this queue's own fill level.
+		if (container != NULL
+			&& !sheddingApply(container, state->dataExchangeSheddingLevel, DAVIS_EVENT_TYPES,
+				state->dataQueueBuffers[queue])) {
+			caerEventPacketContainerFree(container);
+			container = NULL;
+		}
+
+		if (container != NULL) {
+			caerEventPacketContainerSetHostTimestamp(container,
+				clockCorrelationToHost(&state->clockCorrelation,
+					caerEventPacketContainerGetHighestEventTimestamp(container)));
+
+			size_t containerSize = memoryUsageContainerSize(container);
+			memoryUsageAdd(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, containerSize);
+
+			if (!ringBufferPut(state->dataQueueBuffers[queue], container)) {
+				memoryUsageRemove(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, containerSize);
+
+				caerLog(CAER_LOG_INFO, handle->info.deviceString,
+					"Dropped EventPacket Container because data queue %zu ring-buffer full!", queue);
+
+				caerEventPacketContainerFree(container);
+			}
+			else if (state->dataNotifyIncrease != NULL) {
+				state->dataNotifyIncrease(state->dataNotifyUserPtr);
+			}
+		}
+
+		// Every queue gets its own timestamp reset notification, as consumers
+		// of a secondary queue may never look at the main one.
+		if (tsReset) {
+			state->dataQueueCommitTimestamp[queue] = -1;
+
+			caerEventPacketContainer tsResetContainer = caerEventPacketContainerAllocate(DAVIS_EVENT_TYPES);
+			if (tsResetContainer == NULL) {
+				caerLog(CAER_LOG_CRITICAL, handle->info.deviceString,
+					"Failed to allocate tsReset event packet container.");
+				return;
+			}
+
+			caerSpecialEventPacket tsResetPacket = caerSpecialEventPacketAllocate(1, I16T(handle->info.deviceID),
+				state->wrapOverflow);
+			if (tsResetPacket == NULL) {
+				caerEventPacketContainerFree(tsResetContainer);
+
+				caerLog(CAER_LOG_CRITICAL, handle->info.deviceString,
+					"Failed to allocate tsReset special event packet.");
+				return;
+			}
+
+			caerSpecialEvent tsResetEvent = caerSpecialEventPacketGetEvent(tsResetPacket, 0);
+			caerSpecialEventSetTimestamp(tsResetEvent, INT32_MAX);
+			caerSpecialEventSetType(tsResetEvent, TIMESTAMP_RESET);
+			caerSpecialEventValidate(tsResetEvent, tsResetPacket);
+
+			caerEventPacketContainerSetEventPacket(tsResetContainer, SPECIAL_EVENT,
+				(caerEventPacketHeader) tsResetPacket);
+			caerEventPacketContainerSetHostTimestamp(tsResetContainer, state->usbState.dataTransferTime);
+
+			size_t tsResetContainerSize = memoryUsageContainerSize(tsResetContainer);
+			memoryUsageAdd(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, tsResetContainerSize);
+
+			// Reset MUST be committed, always, see main commit below.
+			if (!ringBufferPutPriority(state->dataQueueBuffers[queue], tsResetContainer)) {
+				memoryUsageRemove(&state->usbState.memoryUsage,
+					CAER_DEVICE_MEMORY_DATA_EXCHANGE, tsResetContainerSize);
+
+				caerLog(CAER_LOG_ERROR, handle->info.deviceString,
+					"Dropped tsReset EventPacket Container because data queue %zu has too many waiting!", queue);
+
+				caerEventPacketContainerFree(tsResetContainer);
+			}
+			else if (state->dataNotifyIncrease != NULL) {
+				state->dataNotifyIncrease(state->dataNotifyUserPtr);
+			}
+		}
+
+		PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_COMMIT], commitStart);
+	}
+}
+
+// Commit the current packets to the data exchange ring-buffer, if any of the
+// commit conditions are met. Returns false on fatal memory allocation errors.
+static bool davisPacketContainerCommit(davisHandle handle, bool tsReset, bool tsBigWrap, bool forceCommit) {
+	davisState state = &handle->state;
+
+	// Thresholds on which to trigger packet container commit.
+	// forceCommit is set by the host-side latency deadline.
+	// Trigger if any of the global container-wide thresholds are met.
+	int32_t currentPacketContainerCommitSize = I32T(
+		atomic_load_explicit(&state->maxPacketContainerPacketSize, memory_order_relaxed));
+	bool containerSizeCommit = (currentPacketContainerCommitSize > 0)
+		&& ((state->currentPolarityPacketPosition >= currentPacketContainerCommitSize)
+			|| (state->currentSpecialPacketPosition >= currentPacketContainerCommitSize)
+			|| (state->currentFramePacketPosition >= currentPacketContainerCommitSize)
+			|| (state->currentIMU6PacketPosition >= currentPacketContainerCommitSize)
+			|| (state->currentSamplePacketPosition >= currentPacketContainerCommitSize));
+
+	bool containerTimeCommit = generateFullTimestamp(state->wrapOverflow, state->currentTimestamp)
+		> state->currentPacketContainerCommitTimestamp;
+
+	// Commit packet containers to the ring-buffer, so they can be processed by the
+	// main-loop, when any of the required conditions are met.
+	if (forceCommit || tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
+		PROFILING_START(commitStart);
+
+		// One or more of the commit triggers are hit. Set the packet container up to contain
+		// any non-empty packets. Empty packets are not forwarded to save memory.
+		bool emptyContainerCommit = true;
+
+		if (state->currentPolarityPacketPosition > 0 && state->currentDataQueuePacketQueue[POLARITY_EVENT] == 0) {
+			caerEventPacketContainerSetEventPacket(state->currentPacketContainer, POLARITY_EVENT,
+				(caerEventPacketHeader) state->currentPolarityPacket);
+
+			state->currentPolarityPacket = NULL;
+			state->currentPolarityPacketPosition = 0;
+			emptyContainerCommit = false;
+		}
+
+		if (state->currentSpecialPacketPosition > 0 && state->currentDataQueuePacketQueue[SPECIAL_EVENT] == 0) {
+			caerEventPacketContainerSetEventPacket(state->currentPacketContainer, SPECIAL_EVENT,
+				(caerEventPacketHeader) state->currentSpecialPacket);
+
+			state->currentSpecialPacket = NULL;
+			state->currentSpecialPacketPosition = 0;
+			emptyContainerCommit = false;
+		}
+
+		if (state->currentFramePacketPosition > 0 && state->currentDataQueuePacketQueue[FRAME_EVENT] == 0) {
+			caerEventPacketContainerSetEventPacket(state->currentPacketContainer, FRAME_EVENT,
+				(caerEventPacketHeader) state->currentFramePacket);
+
+			state->currentFramePacket = NULL;
+			state->currentFramePacketPosition = 0;
+			emptyContainerCommit = false;
+		}
+
+		if (state->currentIMU6PacketPosition > 0 && state->currentDataQueuePacketQueue[IMU6_EVENT] == 0) {
+			caerEventPacketContainerSetEventPacket(state->currentPacketContainer, IMU6_EVENT,
+				(caerEventPacketHeader) state->currentIMU6Packet);
+
+			state->currentIMU6Packet = NULL;
+			state->currentIMU6PacketPosition = 0;
+			emptyContainerCommit = false;
+		}
+
+		if (state->currentSamplePacketPosition > 0 && state->currentDataQueuePacketQueue[DAVIS_SAMPLE_POSITION] == 0) {
+			caerEventPacketContainerSetEventPacket(state->currentPacketContainer, DAVIS_SAMPLE_POSITION,
+				davisMicrophonePacketConvert(handle, state->currentSamplePacket));
+
+			state->currentSamplePacket = NULL;
+			state->currentSamplePacketPosition = 0;
+			emptyContainerCommit = false;
+		}
+
+		if (tsReset || tsBigWrap) {
+			// Ignore all APS and IMU6 (composite) events, until a new APS or IMU6
+			// Start event comes in, for the next packet.
+			// This is to correctly support the forced packet commits that a TS reset,
+			// or a TS big wrap, impose. Continuing to parse events would result
+			// in a corrupted state of the first event in the new packet, as it would
+			// be incomplete, incorrect and miss vital initialization data.
+			// See APS and IMU6 END states for more details on a related issue.
+			state->apsIgnoreEvents = true;
+			state->imuIgnoreEvents = true;
+		}
+
+		// If the commit was triggered by a packet container limit being reached, we always
+		// update the time related limit. The size related one is updated implicitly by size
+		// being reset to zero after commit (new packets are empty).
+		if (containerTimeCommit) {
+			while (generateFullTimestamp(state->wrapOverflow, state->currentTimestamp)
+				> state->currentPacketContainerCommitTimestamp) {
+				state->currentPacketContainerCommitTimestamp += I32T(
+					atomic_load_explicit( &state->maxPacketContainerInterval, memory_order_relaxed));
+			}
+		}
+
+		// Under overload, drop the less important packets first, see CAER_HOST_CONFIG_SHEDDING.
+		if (!emptyContainerCommit
+			&& !sheddingApply(state->currentPacketContainer, state->dataExchangeSheddingLevel, DAVIS_EVENT_TYPES,
+				state->dataExchangeBuffer)) {
+			emptyContainerCommit = true;
+		}
+
+		// Filter out completely empty commits. This can happen when data is turned off,
+		// but the timestamps are still going forward.
+		if (emptyContainerCommit) {
+			caerEventPacketContainerFree(state->currentPacketContainer);
+			state->currentPacketContainer = NULL;
+		}
+		else {
+			caerEventPacketContainerSetHostTimestamp(state->currentPacketContainer,
+				clockCorrelationToHost(&state->clockCorrelation,
+					caerEventPacketContainerGetHighestEventTimestamp(state->currentPacketContainer)));
+
+			size_t containerSize = memoryUsageContainerSize(state->currentPacketContainer);
+			memoryUsageAdd(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, containerSize);
+
+			if (!ringBufferPut(state->dataExchangeBuffer, state->currentPacketContainer)) {
+				memoryUsageRemove(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, containerSize);
+
+				// Failed to forward packet container, just drop it, it doesn't contain
+				// any critical information anyway.
+				caerLog(CAER_LOG_INFO, handle->info.deviceString,
+					"Dropped EventPacket Container because ring-buffer full!");
+
+				caerEventPacketContainerFree(state->currentPacketContainer);
+				state->currentPacketContainer = NULL;
+			}
+			else {
+				watermarkUpdate(&state->dataExchangeWatermark, ringBufferUsage(state->dataExchangeBuffer));
+
+				if (state->dataNotifyIncrease != NULL) {
+					state->dataNotifyIncrease(state->dataNotifyUserPtr);
+				}
+
+				state->currentPacketContainer = NULL;
+			}
+		}
+
+		// The only critical timestamp information to forward is the timestamp reset event.
+		// The timestamp big-wrap can also (and should!) be detected by observing a packet's
+		// tsOverflow value, not the special packet TIMESTAMP_WRAP event, which is only informative.
+		// For the timestamp reset event (TIMESTAMP_RESET), we thus ensure that it is always
+		// committed, and we send it alone, in its own packet container, to ensure it will always
+		// be ordered after any other event packets in any processing or output stream.
+		if (tsReset) {
+			// Allocate packet container just for this event.
+			caerEventPacketContainer tsResetContainer = caerEventPacketContainerAllocate(DAVIS_EVENT_TYPES);
+			if (tsResetContainer == NULL) {
+				caerLog(CAER_LOG_CRITICAL, handle->info.deviceString,
+					"Failed to allocate tsReset event packet container.");
+				return (false);
+			}
+
+			// Allocate special packet just for this event.
+			caerSpecialEventPacket tsResetPacket = caerSpecialEventPacketAllocate(1, I16T(handle->info.deviceID),
+				state->wrapOverflow);
+			if (tsResetPacket == NULL) {
+				caerLog(CAER_LOG_CRITICAL, handle->info.deviceString,
+					"Failed to allocate tsReset special event packet.");
+				return (false);
+			}
+
+			// Create timestamp reset event.
+			caerSpecialEvent tsResetEvent = caerSpecialEventPacketGetEvent(tsResetPacket, 0);
+			caerSpecialEventSetTimestamp(tsResetEvent, INT32_MAX);
+			caerSpecialEventSetType(tsResetEvent, TIMESTAMP_RESET);
+			caerSpecialEventValidate(tsResetEvent, tsResetPacket);
+
+			// Assign special packet to packet container.
+			caerEventPacketContainerSetEventPacket(tsResetContainer, SPECIAL_EVENT,
+				(caerEventPacketHeader) tsResetPacket);
+
+			// Timestamps restart from zero, and so does the clock correlation.
+			caerEventPacketContainerSetHostTimestamp(tsResetContainer, state->usbState.dataTransferTime);
+			clockCorrelationReset(&state->clockCorrelation);
+
+			size_t tsResetContainerSize = memoryUsageContainerSize(tsResetContainer);
+			memoryUsageAdd(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, tsResetContainerSize);
+
+			// Reset MUST be committed, always, else downstream data processing and
+			// outputs get confused if they have no notification of timestamps
+			// jumping back go zero. The ring-buffer's priority path never blocks
+			// the USB handling thread: if the ring-buffer is full, the reset waits
+			// there and enters as soon as there is space, still ahead of later data.
+			if (!ringBufferPutPriority(state->dataExchangeBuffer, tsResetContainer)) {
+				memoryUsageRemove(&state->usbState.memoryUsage,
+					CAER_DEVICE_MEMORY_DATA_EXCHANGE, tsResetContainerSize);
+
+				caerLog(CAER_LOG_ERROR, handle->info.deviceString,
+					"Dropped tsReset EventPacket Container because too many are waiting for ring-buffer space!");
+
+				caerEventPacketContainerFree(tsResetContainer);
+			}
+			else {
+				watermarkUpdate(&state->dataExchangeWatermark, ringBufferUsage(state->dataExchangeBuffer));
+
+				// Signal new container as usual.
+				if (state->dataNotifyIncrease != NULL) {
+					state->dataNotifyIncrease(state->dataNotifyUserPtr);
+				}
+			}
+		}
+
+		PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_COMMIT], commitStart);
+	}
+
+	return (true);
+}
+
+// Move timestamp reset containers, that found their ring-buffer full, into it,
+// now that there may be space. Returns true if none are left waiting.
+static bool davisDataExchangeFlush(davisState state) {
+	bool flushed = ringBufferFlush(state->dataExchangeBuffer);
+
+	for (size_t i = 1; i < CAER_HOST_CONFIG_QUEUES_NUMBER; i++) {
+		if (state->dataQueueBuffers[i] != NULL && !ringBufferFlush(state->dataQueueBuffers[i])) {
+			flushed = false;
+		}
+	}
+
+	return (flushed);
+}
+
+// Number of containers held by the main and the secondary ring-buffers.
+static size_t davisDataExchangeUsage(davisState state) {
+	size_t usage = ringBufferUsage(state->dataExchangeBuffer);
+
+	for (size_t i = 1; i < CAER_HOST_CONFIG_QUEUES_NUMBER; i++) {
+		if (state->dataQueueBuffers[i] != NULL) {
+			usage += ringBufferUsage(state->dataQueueBuffers[i]);
+		}
+	}
+
+	return (usage);
+}
+
+static inline bool davisPacketsPending(davisState state) {
+	for (size_t i = 0; i < DAVIS_EVENT_TYPES; i++) {
+		if (davisPacketPosition(state, i) > 0) {
+			return (true);
+		}
+	}
+
+	return (false);
+}
+
+// Called from the data acquisition thread when the host-side latency deadline
+// expires: forward whatever complete events are waiting in the current packets.
+static void davisPacketContainerDeadlineCommit(davisHandle handle) {
+	davisState state = &handle->state;
+
+	state->currentPacketContainerDeadline = -1;
+
+	if (state->currentDataQueuesEnabled) {
+		davisDataQueuesCommit(handle, false, false, true);
+	}
+
+	if (state->currentPacketContainer == NULL) {
+		PROFILING_START(allocationStart);
+
+		state->currentPacketContainer = caerEventPacketContainerAllocate(DAVIS_EVENT_TYPES);
+		if (state->currentPacketContainer == NULL) {
+			caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate event packet container.");
+			return;
+		}
+
+		PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION], allocationStart);
+	}
+
+	davisPacketContainerCommit(handle, false, false, true);
+}
+
+static void davisEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent) {
+	davisHandle handle = vhd;
+	davisState state = &handle->state;
+
+	// Return right away if not running anymore. This prevents useless work if many
+	// buffers are still waiting when shut down, as well as incorrect event sequences
+	// if a TS_RESET is stuck on ring-buffer commit further down, and detects shut-down;
+	// then any subsequent buffers should also detect shut-down and not be handled.
+	if (!atomic_load_explicit(&state->dataAcquisitionThreadRun, memory_order_relaxed)) {
+		return;
+	}
+
+	// Truncate off any extra partial event.
+	if ((bytesSent & 0x01) != 0) {
+		caerLog(CAER_LOG_ALERT, handle->info.deviceString,
+			"%zu bytes received via USB, which is not a multiple of two.", bytesSent);
+		bytesSent &= (size_t) ~0x01;
+	}
+
+	for (size_t i = 0; i < bytesSent; i += 2) {
+		// Allocate new packets for next iteration as needed.
+		if (state->currentPacketContainer == NULL) {
+			PROFILING_START(allocationStart);
+
+			state->currentPacketContainer = caerEventPacketContainerAllocate(DAVIS_EVENT_TYPES);
+			if (state->currentPacketContainer == NULL) {
+				caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate event packet container.");
+				return;
+			}
+
+			PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION], allocationStart);
+		}
+
+		if (state->currentPolarityPacket == NULL) {
+			PROFILING_START(allocationStart);
+
+			state->currentPolarityPacket = caerPolarityEventPacketAllocate(
+			DAVIS_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->wrapOverflow);
 			if (state->currentPolarityPacket == NULL) {
 				caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate polarity event packet.");
 				return;
 			}
+
+			PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION], allocationStart);
 		}
 		else if (state->currentPolarityPacketPosition
 			>= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentPolarityPacket)) {
 			// If not committed, let's check if any of the packets has reached its maximum
 			// capacity limit. If yes, we grow them to accomodate new events.
+			PROFILING_START(allocationStart);
+
 			caerPolarityEventPacket grownPacket = (caerPolarityEventPacket) caerEventPacketGrow(
 				(caerEventPacketHeader) state->currentPolarityPacket, state->currentPolarityPacketPosition * 2);
 			if (grownPacket == NULL) {
@@ -2410,20 +3574,28 @@ static void davisEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent) {
 			}
 
 			state->currentPolarityPacket = grownPacket;
+
+			PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION], allocationStart);
 		}
 
 		if (state->currentSpecialPacket == NULL) {
+			PROFILING_START(allocationStart);
+
 			state->currentSpecialPacket = caerSpecialEventPacketAllocate(
 			DAVIS_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->wrapOverflow);
 			if (state->currentSpecialPacket == NULL) {
 				caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate special event packet.");
 				return;
 			}
+
+			PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION], allocationStart);
 		}
 		else if (state->currentSpecialPacketPosition
 			>= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentSpecialPacket)) {
 			// If not committed, let's check if any of the packets has reached its maximum
 			// capacity limit. If yes, we grow them to accomodate new events.
+			PROFILING_START(allocationStart);
+
 			caerSpecialEventPacket grownPacket = (caerSpecialEventPacket) caerEventPacketGrow(
 				(caerEventPacketHeader) state->currentSpecialPacket, state->currentSpecialPacketPosition * 2);
 			if (grownPacket == NULL) {
@@ -2432,9 +3604,13 @@ static void davisEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent) {
 			}
 
 			state->currentSpecialPacket = grownPacket;
+
+			PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION], allocationStart);
 		}
 
 		if (state->currentFramePacket == NULL) {
+			PROFILING_START(allocationStart);
+
 			state->currentFramePacket = caerFrameEventPacketAllocate(
 			DAVIS_FRAME_DEFAULT_SIZE, I16T(handle->info.deviceID), state->wrapOverflow, state->apsSizeX,
 				state->apsSizeY, 1);
@@ -2442,11 +3618,15 @@ static void davisEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent) {
 				caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate frame event packet.");
 				return;
 			}
+
+			PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION], allocationStart);
 		}
 		else if (state->currentFramePacketPosition
 			>= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentFramePacket)) {
 			// If not committed, let's check if any of the packets has reached its maximum
 			// capacity limit. If yes, we grow them to accomodate new events.
+			PROFILING_START(allocationStart);
+
 			caerFrameEventPacket grownPacket = (caerFrameEventPacket) caerEventPacketGrow(
 				(caerEventPacketHeader) state->currentFramePacket, state->currentFramePacketPosition * 2);
 			if (grownPacket == NULL) {
@@ -2455,20 +3635,28 @@ static void davisEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent) {
 			}
 
 			state->currentFramePacket = grownPacket;
+
+			PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION], allocationStart);
 		}
 
 		if (state->currentIMU6Packet == NULL) {
+			PROFILING_START(allocationStart);
+
 			state->currentIMU6Packet = caerIMU6EventPacketAllocate(
 			DAVIS_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), state->wrapOverflow);
 			if (state->currentIMU6Packet == NULL) {
 				caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate IMU6 event packet.");
 				return;
 			}
+
+			PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION], allocationStart);
 		}
 		else if (state->currentIMU6PacketPosition
 			>= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentIMU6Packet)) {
 			// If not committed, let's check if any of the packets has reached its maximum
 			// capacity limit. If yes, we grow them to accomodate new events.
+			PROFILING_START(allocationStart);
+
 			caerIMU6EventPacket grownPacket = (caerIMU6EventPacket) caerEventPacketGrow(
 				(caerEventPacketHeader) state->currentIMU6Packet, state->currentIMU6PacketPosition * 2);
 			if (grownPacket == NULL) {
@@ -2477,20 +3665,28 @@ static void davisEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent) {
 			}
 
 			state->currentIMU6Packet = grownPacket;
+
+			PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION], allocationStart);
 		}
 
 		if (state->currentSamplePacket == NULL) {
+			PROFILING_START(allocationStart);
+
 			state->currentSamplePacket = caerSampleEventPacketAllocate(
 			DAVIS_SAMPLE_DEFAULT_SIZE, I16T(handle->info.deviceID), state->wrapOverflow);
 			if (state->currentSamplePacket == NULL) {
 				caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate Sample event packet.");
 				return;
 			}
+
+			PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION], allocationStart);
 		}
 		else if (state->currentSamplePacketPosition
 			>= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentSamplePacket)) {
 			// If not committed, let's check if any of the packets has reached its maximum
 			// capacity limit. If yes, we grow them to accomodate new events.
+			PROFILING_START(allocationStart);
+
 			caerSampleEventPacket grownPacket = (caerSampleEventPacket) caerEventPacketGrow(
 				(caerEventPacketHeader) state->currentSamplePacket, state->currentSamplePacketPosition * 2);
 			if (grownPacket == NULL) {
@@ -2499,6 +3695,8 @@ static void davisEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent) {
 			}
 
 			state->currentSamplePacket = grownPacket;
+
+			PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION], allocationStart);
 		}
 
 		bool tsReset = false;
@@ -2726,9 +3924,15 @@ static void davisEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent) {
 
 								// Automatic exposure control support.
 								if (atomic_load_explicit(&state->apsAutoExposureEnabled, memory_order_relaxed)) {
+									PROFILING_START(autoExposureStart);
+
 									int32_t newExposureValue = autoExposureCalculate(&state->apsAutoExposureState,
 										currentFrameEvent, U32T(atomic_load(&state->apsAutoExposureLastSetValue)));
 
+									PROFILING_STOP(
+										state->usbState.profiling.stages[CAER_DEVICE_PROFILING_AUTO_EXPOSURE],
+										autoExposureStart);
+
 									if (newExposureValue >= 0) {
 										// Update exposure value. Done in main thread to avoid deadlock inside callback.
 										atomic_store(&state->apsAutoExposureNewValue, U32T(newExposureValue));
@@ -3111,7 +4315,8 @@ static void davisEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent) {
 					// negative gain from pre-amplifier.
 					uint8_t polarity = ((IS_DAVIS208(handle->info.chipID)) && (data < 192)) ? U8T(~code) : (code);
 
-					caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
+					// Space for this event was ensured at the start of the iteration.
+					caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEventUnchecked(
 						state->currentPolarityPacket, state->currentPolarityPacketPosition);
 
 					// Timestamp at event-stream insertion point.
@@ -3558,174 +4763,40 @@ static void davisEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent) {
 			}
 		}
 
-		// Thresholds on which to trigger packet container commit.
-		// forceCommit is already defined above.
-		// Trigger if any of the global container-wide thresholds are met.
-		int32_t currentPacketContainerCommitSize = I32T(
-			atomic_load_explicit(&state->maxPacketContainerPacketSize, memory_order_relaxed));
-		bool containerSizeCommit = (currentPacketContainerCommitSize > 0)
-			&& ((state->currentPolarityPacketPosition >= currentPacketContainerCommitSize)
-				|| (state->currentSpecialPacketPosition >= currentPacketContainerCommitSize)
-				|| (state->currentFramePacketPosition >= currentPacketContainerCommitSize)
-				|| (state->currentIMU6PacketPosition >= currentPacketContainerCommitSize)
-				|| (state->currentSamplePacketPosition >= currentPacketContainerCommitSize));
-
-		bool containerTimeCommit = generateFullTimestamp(state->wrapOverflow, state->currentTimestamp)
-			> state->currentPacketContainerCommitTimestamp;
-
-		// Commit packet containers to the ring-buffer, so they can be processed by the
-		// main-loop, when any of the required conditions are met.
-		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
-			// One or more of the commit triggers are hit. Set the packet container up to contain
-			// any non-empty packets. Empty packets are not forwarded to save memory.
-			bool emptyContainerCommit = true;
-
-			if (state->currentPolarityPacketPosition > 0) {
-				caerEventPacketContainerSetEventPacket(state->currentPacketContainer, POLARITY_EVENT,
-					(caerEventPacketHeader) state->currentPolarityPacket);
-
-				state->currentPolarityPacket = NULL;
-				state->currentPolarityPacketPosition = 0;
-				emptyContainerCommit = false;
-			}
-
-			if (state->currentSpecialPacketPosition > 0) {
-				caerEventPacketContainerSetEventPacket(state->currentPacketContainer, SPECIAL_EVENT,
-					(caerEventPacketHeader) state->currentSpecialPacket);
-
-				state->currentSpecialPacket = NULL;
-				state->currentSpecialPacketPosition = 0;
-				emptyContainerCommit = false;
-			}
-
-			if (state->currentFramePacketPosition > 0) {
-				caerEventPacketContainerSetEventPacket(state->currentPacketContainer, FRAME_EVENT,
-					(caerEventPacketHeader) state->currentFramePacket);
-
-				state->currentFramePacket = NULL;
-				state->currentFramePacketPosition = 0;
-				emptyContainerCommit = false;
-			}
-
-			if (state->currentIMU6PacketPosition > 0) {
-				caerEventPacketContainerSetEventPacket(state->currentPacketContainer, IMU6_EVENT,
-					(caerEventPacketHeader) state->currentIMU6Packet);
-
-				state->currentIMU6Packet = NULL;
-				state->currentIMU6PacketPosition = 0;
-				emptyContainerCommit = false;
-			}
-
-			if (state->currentSamplePacketPosition > 0) {
-				caerEventPacketContainerSetEventPacket(state->currentPacketContainer, DAVIS_SAMPLE_POSITION,
-					(caerEventPacketHeader) state->currentSamplePacket);
-
-				state->currentSamplePacket = NULL;
-				state->currentSamplePacketPosition = 0;
-				emptyContainerCommit = false;
-			}
-
-			if (tsReset || tsBigWrap) {
-				// Ignore all APS and IMU6 (composite) events, until a new APS or IMU6
-				// Start event comes in, for the next packet.
-				// This is to correctly support the forced packet commits that a TS reset,
-				// or a TS big wrap, impose. Continuing to parse events would result
-				// in a corrupted state of the first event in the new packet, as it would
-				// be incomplete, incorrect and miss vital initialization data.
-				// See APS and IMU6 END states for more details on a related issue.
-				state->apsIgnoreEvents = true;
-				state->imuIgnoreEvents = true;
-			}
-
-			// If the commit was triggered by a packet container limit being reached, we always
-			// update the time related limit. The size related one is updated implicitly by size
-			// being reset to zero after commit (new packets are empty).
-			if (containerTimeCommit) {
-				while (generateFullTimestamp(state->wrapOverflow, state->currentTimestamp)
-					> state->currentPacketContainerCommitTimestamp) {
-					state->currentPacketContainerCommitTimestamp += I32T(
-						atomic_load_explicit( &state->maxPacketContainerInterval, memory_order_relaxed));
-				}
-			}
-
-			// Filter out completely empty commits. This can happen when data is turned off,
-			// but the timestamps are still going forward.
-			if (emptyContainerCommit) {
-				caerEventPacketContainerFree(state->currentPacketContainer);
-				state->currentPacketContainer = NULL;
-			}
-			else {
-				if (!ringBufferPut(state->dataExchangeBuffer, state->currentPacketContainer)) {
-					// Failed to forward packet container, just drop it, it doesn't contain
-					// any critical information anyway.
-					caerLog(CAER_LOG_INFO, handle->info.deviceString,
-						"Dropped EventPacket Container because ring-buffer full!");
-
-					caerEventPacketContainerFree(state->currentPacketContainer);
-					state->currentPacketContainer = NULL;
-				}
-				else {
-					if (state->dataNotifyIncrease != NULL) {
-						state->dataNotifyIncrease(state->dataNotifyUserPtr);
-					}
-
-					state->currentPacketContainer = NULL;
-				}
-			}
-
-			// The only critical timestamp information to forward is the timestamp reset event.
-			// The timestamp big-wrap can also (and should!) be detected by observing a packet's
-			// tsOverflow value, not the special packet TIMESTAMP_WRAP event, which is only informative.
-			// For the timestamp reset event (TIMESTAMP_RESET), we thus ensure that it is always
-			// committed, and we send it alone, in its own packet container, to ensure it will always
-			// be ordered after any other event packets in any processing or output stream.
-			if (tsReset) {
-				// Allocate packet container just for this event.
-				caerEventPacketContainer tsResetContainer = caerEventPacketContainerAllocate(DAVIS_EVENT_TYPES);
-				if (tsResetContainer == NULL) {
-					caerLog(CAER_LOG_CRITICAL, handle->info.deviceString,
-						"Failed to allocate tsReset event packet container.");
-					return;
-				}
+		// Packets assigned to secondary queues are committed there, on their own schedule.
+		if (state->currentDataQueuesEnabled) {
+			davisDataQueuesCommit(handle, tsReset, tsBigWrap, false);
+		}
 
-				// Allocate special packet just for this event.
-				caerSpecialEventPacket tsResetPacket = caerSpecialEventPacketAllocate(1, I16T(handle->info.deviceID),
-					state->wrapOverflow);
-				if (tsResetPacket == NULL) {
-					caerLog(CAER_LOG_CRITICAL, handle->info.deviceString,
-						"Failed to allocate tsReset special event packet.");
-					return;
-				}
+		if (!davisPacketContainerCommit(handle, tsReset, tsBigWrap, false)) {
+			return;
+		}
+	}
 
-				// Create timestamp reset event.
-				caerSpecialEvent tsResetEvent = caerSpecialEventPacketGetEvent(tsResetPacket, 0);
-				caerSpecialEventSetTimestamp(tsResetEvent, INT32_MAX);
-				caerSpecialEventSetType(tsResetEvent, TIMESTAMP_RESET);
-				caerSpecialEventValidate(tsResetEvent, tsResetPacket);
-
-				// Assign special packet to packet container.
-				caerEventPacketContainerSetEventPacket(tsResetContainer, SPECIAL_EVENT,
-					(caerEventPacketHeader) tsResetPacket);
-
-				// Reset MUST be committed, always, else downstream data processing and
-				// outputs get confused if they have no notification of timestamps
-				// jumping back go zero.
-				while (!ringBufferPut(state->dataExchangeBuffer, tsResetContainer)) {
-					// Prevent dead-lock if shutdown is requested and nothing is consuming
-					// data anymore, but the ring-buffer is full (and would thus never empty),
-					// thus blocking the USB handling thread in this loop.
-					if (!atomic_load_explicit(&state->dataAcquisitionThreadRun, memory_order_relaxed)) {
-						return;
-					}
-				}
+	// Account for the memory held by the current, uncommitted packets.
+	memoryUsageSet(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_PACKETS,
+		memoryUsagePacketSize((caerEventPacketHeader) state->currentPolarityPacket)
+			+ memoryUsagePacketSize((caerEventPacketHeader) state->currentSpecialPacket)
+			+ memoryUsagePacketSize((caerEventPacketHeader) state->currentFramePacket)
+			+ memoryUsagePacketSize((caerEventPacketHeader) state->currentIMU6Packet)
+			+ memoryUsagePacketSize((caerEventPacketHeader) state->currentSamplePacket));
+
+	// Events left waiting in the current packets must be committed by this host
+	// time at the latest, counting from when the first of them arrived.
+	if (!davisPacketsPending(state)) {
+		state->currentPacketContainerDeadline = -1;
+	}
+	else if (state->currentPacketContainerDeadline == -1) {
+		uint32_t maxLatency = U32T(atomic_load_explicit(&state->maxPacketContainerLatency, memory_order_relaxed));
 
-				// Signal new container as usual.
-				if (state->dataNotifyIncrease != NULL) {
-					state->dataNotifyIncrease(state->dataNotifyUserPtr);
-				}
-			}
+		if (maxLatency > 0) {
+			state->currentPacketContainerDeadline = state->usbState.dataTransferTime + I64T(maxLatency);
 		}
 	}
+
+	// Pair the latest device timestamp with the USB transfer completion time.
+	clockCorrelationUpdate(&state->clockCorrelation, generateFullTimestamp(state->wrapOverflow, state->currentTimestamp),
+		state->usbState.dataTransferTime);
 }
 
 static int davisDataAcquisitionThread(void *inPtr) {
@@ -3738,9 +4809,21 @@ static int davisDataAcquisitionThread(void *inPtr) {
 	// Set thread name.
 	thrd_set_name(state->deviceThreadName);
 
+	// Apply CPU affinity, real-time scheduling and memory locking, if requested.
+	usbThreadConfigure(handle->info.deviceString, U32T(atomic_load(&state->dataAcquisitionThreadCpuAffinity)),
+		U32T(atomic_load(&state->dataAcquisitionThreadSchedPolicy)),
+		U32T(atomic_load(&state->dataAcquisitionThreadSchedPriority)),
+		atomic_load(&state->dataAcquisitionThreadMemoryLock));
+
 	// Reset configuration update, so as to not re-do work afterwards.
 	atomic_store(&state->dataAcquisitionThreadConfigUpdate, 0);
 
+	// When replaying a raw capture, the device itself doesn't send any data.
+	if (state->usbState.replay) {
+		davisDataReplay(handle);
+		return (EXIT_SUCCESS);
+	}
+
 	if (atomic_load(&state->dataExchangeStartProducers)) {
 		// Enable data transfer on USB end-point 2.
 		davisCommonConfigSet(handle, DAVIS_CONFIG_DVS, DAVIS_CONFIG_DVS_RUN, true);
@@ -3769,9 +4852,6 @@ static int davisDataAcquisitionThread(void *inPtr) {
 
 	caerLog(CAER_LOG_DEBUG, handle->info.deviceString, "data acquisition thread ready to process events.");
 
-	// Handle USB events (1 second timeout).
-	struct timeval te = { .tv_sec = 1, .tv_usec = 0 };
-
 	while (atomic_load_explicit(&state->dataAcquisitionThreadRun, memory_order_relaxed)
 		&& state->usbState.activeDataTransfers > 0) {
 		// Check config refresh, in this case to adjust buffer sizes.
@@ -3779,6 +4859,28 @@ static int davisDataAcquisitionThread(void *inPtr) {
 			davisDataAcquisitionThreadConfig(handle);
 		}
 
+		// Handle USB events (1 second timeout), or until the latency deadline
+		// of events waiting in the current packets, if earlier.
+		struct timeval te = { .tv_sec = 1, .tv_usec = 0 };
+
+		if (state->currentPacketContainerDeadline != -1) {
+			int64_t timeLeft = state->currentPacketContainerDeadline - usbHostTime();
+
+			if (timeLeft <= 0) {
+				davisPacketContainerDeadlineCommit(handle);
+			}
+			else if (timeLeft < 1000000) {
+				te.tv_sec = 0;
+				te.tv_usec = I32T(timeLeft);
+			}
+		}
+
+		// Retry waiting timestamp resets soon, as consumers make space.
+		if (!davisDataExchangeFlush(state) && (te.tv_sec != 0 || te.tv_usec > 1000)) {
+			te.tv_sec = 0;
+			te.tv_usec = 1000;
+		}
+
 		libusb_handle_events_timeout(state->usbState.deviceContext, &te);
 	}
 
@@ -3799,6 +4901,42 @@ static int davisDataAcquisitionThread(void *inPtr) {
 	return (EXIT_SUCCESS);
 }
 
+static void davisDataReplay(davisHandle handle) {
+	davisState state = &handle->state;
+
+	// Signal data thread ready back to start function.
+	atomic_store(&state->dataAcquisitionThreadRun, true);
+
+	caerLog(CAER_LOG_DEBUG, handle->info.deviceString, "data acquisition thread ready to replay USB capture.");
+
+	while (atomic_load_explicit(&state->dataAcquisitionThreadRun, memory_order_relaxed)
+		&& usbReplayTransfer(&state->usbState, handle->info.deviceString)) {
+		// Lossless: wait for the user to take all containers before translating more.
+		while (atomic_load_explicit(&state->dataAcquisitionThreadRun, memory_order_relaxed)
+			&& memoryUsageCurrent(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE) != 0) {
+			struct timespec fullSleep = { .tv_sec = 0, .tv_nsec = 100000 };
+			thrd_sleep(&fullSleep, NULL);
+
+			davisDataExchangeFlush(state);
+		}
+	}
+
+	// End of capture: forward the events still waiting in the current packets.
+	if (atomic_load_explicit(&state->dataAcquisitionThreadRun, memory_order_relaxed) && davisPacketsPending(state)) {
+		davisPacketContainerDeadlineCommit(handle);
+	}
+
+	caerLog(CAER_LOG_DEBUG, handle->info.deviceString, "USB capture replayed, shutting down data acquisition thread ...");
+
+	atomic_store(&state->dataAcquisitionThreadRun, false);
+
+	if (state->dataShutdownNotify != NULL) {
+		state->dataShutdownNotify(state->dataShutdownUserPtr);
+	}
+
+	caerLog(CAER_LOG_DEBUG, handle->info.deviceString, "data acquisition thread shut down.");
+}
+
 static void davisDataAcquisitionThreadConfig(davisHandle handle) {
 	davisState state = &handle->state;
 
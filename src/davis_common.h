@@ -4,6 +4,9 @@
 #include "devices/davis.h"
 #include "ringbuffer/ringbuffer.h"
 #include "usb_utils.h"
+#include "watermark.h"
+#include "shedding.h"
+#include "clock_correlation.h"
 #include "autoexposure.h"
 #include <stdatomic.h>
 
@@ -43,11 +46,24 @@
 #define DAVIS_IMU_DEFAULT_SIZE 64
 #define DAVIS_SAMPLE_DEFAULT_SIZE 512
 
+// Stereo microphones, sample type 0 is left, 1 is right.
+#define DAVIS_MICROPHONE_CHANNELS 2
+
+// Translator configuration stored in raw USB captures: chip ID, logic version,
+// DVS and APS sizes, orientation and APS/IMU mode flags, APS color filter,
+// IMU scales and the APS ROI regions. See davisCaptureConfigPack().
+#define DAVIS_CAPTURE_CONFIG_SIZE (24 + (APS_ROI_REGIONS_MAX * 8))
+// Orientation flags are fixed when the device is opened, while the APS modes
+// are read again from the device on every data acquisition start.
+#define DAVIS_CAPTURE_CONFIG_ORIENTATION_FLAGS 0x7F
+
 struct davis_state {
 	// Data Acquisition Thread -> Mainloop Exchange
 	RingBuffer dataExchangeBuffer;
 	atomic_uint_fast32_t dataExchangeBufferSize; // Only takes effect on DataStart() calls!
 	atomic_bool dataExchangeBlocking;
+	struct watermark_state dataExchangeWatermark;
+	atomic_uint_fast8_t dataExchangeSheddingLevel[DAVIS_EVENT_TYPES];
 	atomic_bool dataExchangeStartProducers;
 	atomic_bool dataExchangeStopProducers;
 	void (*dataNotifyIncrease)(void *ptr);
@@ -61,8 +77,15 @@ struct davis_state {
 	// USB Transfer Settings
 	atomic_uint_fast32_t usbBufferNumber;
 	atomic_uint_fast32_t usbBufferSize;
+	atomic_int_fast32_t usbCaptureFd; // Only takes effect on DataStart() calls!
+	atomic_bool usbCaptureTranslate; // Only takes effect on DataStart() calls!
+	atomic_int_fast32_t usbReplayFd; // Only takes effect on DataStart() calls!
 	// Data Acquisition Thread
 	thrd_t dataAcquisitionThread;
+	atomic_uint_fast32_t dataAcquisitionThreadCpuAffinity; // Only takes effect on DataStart() calls!
+	atomic_uint_fast32_t dataAcquisitionThreadSchedPolicy; // Only takes effect on DataStart() calls!
+	atomic_uint_fast32_t dataAcquisitionThreadSchedPriority; // Only takes effect on DataStart() calls!
+	atomic_bool dataAcquisitionThreadMemoryLock; // Only takes effect on DataStart() calls!
 	atomic_bool dataAcquisitionThreadRun;
 	atomic_uint_fast32_t dataAcquisitionThreadConfigUpdate;
 	// Timestamp fields
@@ -70,6 +93,8 @@ struct davis_state {
 	int32_t wrapAdd;
 	int32_t lastTimestamp;
 	int32_t currentTimestamp;
+	// Device to host clock correlation
+	struct clock_correlation clockCorrelation;
 	// DVS specific fields
 	uint16_t dvsLastY;
 	bool dvsGotY;
@@ -114,11 +139,23 @@ struct davis_state {
 	bool micRight;
 	uint8_t micCount;
 	uint16_t micTmpData;
+	atomic_bool micPCMOutput;
+	atomic_uint_fast32_t micSampleFrequency;
 	// Packet Container state
 	caerEventPacketContainer currentPacketContainer;
 	atomic_uint_fast32_t maxPacketContainerPacketSize;
 	atomic_uint_fast32_t maxPacketContainerInterval;
+	atomic_uint_fast32_t maxPacketContainerLatency;
 	int64_t currentPacketContainerCommitTimestamp;
+	int64_t currentPacketContainerDeadline; // Host time (µs), -1 if no events are waiting.
+	// Secondary data delivery queues (index 0 is unused, that is dataExchangeBuffer)
+	atomic_uint_fast8_t dataQueuePacketQueue[DAVIS_EVENT_TYPES]; // Only takes effect on DataStart() calls!
+	atomic_uint_fast32_t dataQueueInterval[CAER_HOST_CONFIG_QUEUES_NUMBER]; // Only takes effect on DataStart() calls!
+	uint8_t currentDataQueuePacketQueue[DAVIS_EVENT_TYPES];
+	bool currentDataQueuesEnabled;
+	RingBuffer dataQueueBuffers[CAER_HOST_CONFIG_QUEUES_NUMBER];
+	int64_t dataQueueCommitInterval[CAER_HOST_CONFIG_QUEUES_NUMBER];
+	int64_t dataQueueCommitTimestamp[CAER_HOST_CONFIG_QUEUES_NUMBER];
 	// Polarity Packet state
 	caerPolarityEventPacket currentPolarityPacket;
 	int32_t currentPolarityPacketPosition;
@@ -169,5 +206,12 @@ bool davisCommonDataStart(caerDeviceHandle handle, void (*dataNotifyIncrease)(vo
 	void *dataShutdownUserPtr);
 bool davisCommonDataStop(caerDeviceHandle handle);
 caerEventPacketContainer davisCommonDataGet(caerDeviceHandle handle);
+size_t davisCommonDataGetBatch(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t maxContainers);
+caerEventPacketContainer davisCommonDataGetQueue(caerDeviceHandle handle, uint8_t queue);
+int64_t davisCommonTimestampToHost(caerDeviceHandle handle, int64_t deviceTimestamp);
+bool davisCommonProfilingGet(caerDeviceHandle handle, struct caer_device_profiling_stage *stages);
+bool davisCommonMemoryUsageGet(caerDeviceHandle handle, struct caer_device_memory_usage *usages);
+bool davisCommonDataWatermarkNotifySet(caerDeviceHandle handle, void (*dataWatermarkNotify)(void *ptr, bool high),
+	void *dataWatermarkUserPtr);
 
 #endif /* LIBCAER_SRC_DAVIS_COMMON_H_ */
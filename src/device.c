@@ -5,11 +5,12 @@
 #include "davis_fx2.h"
 #include "davis_fx3.h"
 #include "dynapse.h"
+#include "playback.h"
 
 /**
  * Number of devices supported by this library.
  */
-#define SUPPORTED_DEVICES_NUMBER 4
+#define SUPPORTED_DEVICES_NUMBER 5
 
 // Supported devices and their functions.
 static caerDeviceHandle (*constructors[SUPPORTED_DEVICES_NUMBER])(uint16_t deviceID, uint8_t busNumberRestrict,
@@ -17,21 +18,24 @@ static caerDeviceHandle (*constructors[SUPPORTED_DEVICES_NUMBER])(uint16_t devic
 		[CAER_DEVICE_DVS128] = &dvs128Open,
 		[CAER_DEVICE_DAVIS_FX2] = &davisFX2Open,
 		[CAER_DEVICE_DAVIS_FX3] = &davisFX3Open,
-		[CAER_DEVICE_DYNAPSE] = &dynapseOpen
+		[CAER_DEVICE_DYNAPSE] = &dynapseOpen,
+		[CAER_DEVICE_PLAYBACK] = NULL // Opened with caerPlaybackOpen().
 };
 
 static bool (*destructors[SUPPORTED_DEVICES_NUMBER])(caerDeviceHandle handle) = {
 	[CAER_DEVICE_DVS128] = &dvs128Close,
 	[CAER_DEVICE_DAVIS_FX2] = &davisFX2Close,
 	[CAER_DEVICE_DAVIS_FX3] = &davisFX3Close,
-	[CAER_DEVICE_DYNAPSE] = &dynapseClose
+	[CAER_DEVICE_DYNAPSE] = &dynapseClose,
+	[CAER_DEVICE_PLAYBACK] = &playbackClose
 };
 
 static bool (*defaultConfigSenders[SUPPORTED_DEVICES_NUMBER])(caerDeviceHandle handle) = {
 	[CAER_DEVICE_DVS128] = &dvs128SendDefaultConfig,
 	[CAER_DEVICE_DAVIS_FX2] = &davisFX2SendDefaultConfig,
 	[CAER_DEVICE_DAVIS_FX3] = &davisFX3SendDefaultConfig,
-	[CAER_DEVICE_DYNAPSE] = &dynapseSendDefaultConfig
+	[CAER_DEVICE_DYNAPSE] = &dynapseSendDefaultConfig,
+	[CAER_DEVICE_PLAYBACK] = &playbackSendDefaultConfig
 };
 
 static bool (*configSetters[SUPPORTED_DEVICES_NUMBER])(caerDeviceHandle handle, int8_t modAddr, uint8_t paramAddr,
@@ -39,7 +43,8 @@ static bool (*configSetters[SUPPORTED_DEVICES_NUMBER])(caerDeviceHandle handle,
 		[CAER_DEVICE_DVS128] = &dvs128ConfigSet,
 		[CAER_DEVICE_DAVIS_FX2] = &davisFX2ConfigSet,
 		[CAER_DEVICE_DAVIS_FX3] = &davisFX3ConfigSet,
-		[CAER_DEVICE_DYNAPSE] = &dynapseConfigSet
+		[CAER_DEVICE_DYNAPSE] = &dynapseConfigSet,
+		[CAER_DEVICE_PLAYBACK] = &playbackConfigSet
 };
 
 static bool (*configGetters[SUPPORTED_DEVICES_NUMBER])(caerDeviceHandle handle, int8_t modAddr, uint8_t paramAddr,
@@ -47,7 +52,8 @@ static bool (*configGetters[SUPPORTED_DEVICES_NUMBER])(caerDeviceHandle handle,
 		[CAER_DEVICE_DVS128] = &dvs128ConfigGet,
 		[CAER_DEVICE_DAVIS_FX2] = &davisFX2ConfigGet,
 		[CAER_DEVICE_DAVIS_FX3] = &davisFX3ConfigGet,
-		[CAER_DEVICE_DYNAPSE] = &dynapseConfigGet
+		[CAER_DEVICE_DYNAPSE] = &dynapseConfigGet,
+		[CAER_DEVICE_PLAYBACK] = &playbackConfigGet
 };
 
 static bool (*dataStarters[SUPPORTED_DEVICES_NUMBER])(caerDeviceHandle handle, void (*dataNotifyIncrease)(void *ptr),
@@ -56,21 +62,78 @@ static bool (*dataStarters[SUPPORTED_DEVICES_NUMBER])(caerDeviceHandle handle, v
 		[CAER_DEVICE_DVS128] = &dvs128DataStart,
 		[CAER_DEVICE_DAVIS_FX2] = &davisCommonDataStart,
 		[CAER_DEVICE_DAVIS_FX3] = &davisCommonDataStart,
-		[CAER_DEVICE_DYNAPSE] = &dynapseDataStart
+		[CAER_DEVICE_DYNAPSE] = &dynapseDataStart,
+		[CAER_DEVICE_PLAYBACK] = &playbackDataStart
 };
 
 static bool (*dataStoppers[SUPPORTED_DEVICES_NUMBER])(caerDeviceHandle handle) = {
 	[CAER_DEVICE_DVS128] = &dvs128DataStop,
 	[CAER_DEVICE_DAVIS_FX2] = &davisCommonDataStop,
 	[CAER_DEVICE_DAVIS_FX3] = &davisCommonDataStop,
-	[CAER_DEVICE_DYNAPSE] = &dynapseDataStop
+	[CAER_DEVICE_DYNAPSE] = &dynapseDataStop,
+	[CAER_DEVICE_PLAYBACK] = &playbackDataStop
 };
 
 static caerEventPacketContainer (*dataGetters[SUPPORTED_DEVICES_NUMBER])(caerDeviceHandle handle) = {
 	[CAER_DEVICE_DVS128] = &dvs128DataGet,
 	[CAER_DEVICE_DAVIS_FX2] = &davisCommonDataGet,
 	[CAER_DEVICE_DAVIS_FX3] = &davisCommonDataGet,
-	[CAER_DEVICE_DYNAPSE] = &dynapseDataGet
+	[CAER_DEVICE_DYNAPSE] = &dynapseDataGet,
+	[CAER_DEVICE_PLAYBACK] = &playbackDataGet
+};
+
+static size_t (*dataBatchGetters[SUPPORTED_DEVICES_NUMBER])(caerDeviceHandle handle,
+	caerEventPacketContainer *containers, size_t maxContainers) = {
+		[CAER_DEVICE_DVS128] = &dvs128DataGetBatch,
+		[CAER_DEVICE_DAVIS_FX2] = &davisCommonDataGetBatch,
+		[CAER_DEVICE_DAVIS_FX3] = &davisCommonDataGetBatch,
+		[CAER_DEVICE_DYNAPSE] = &dynapseDataGetBatch,
+		[CAER_DEVICE_PLAYBACK] = &playbackDataGetBatch
+};
+
+static caerEventPacketContainer (*dataQueueGetters[SUPPORTED_DEVICES_NUMBER])(caerDeviceHandle handle,
+	uint8_t queue) = {
+		[CAER_DEVICE_DVS128] = NULL,
+		[CAER_DEVICE_DAVIS_FX2] = &davisCommonDataGetQueue,
+		[CAER_DEVICE_DAVIS_FX3] = &davisCommonDataGetQueue,
+		[CAER_DEVICE_DYNAPSE] = NULL,
+		[CAER_DEVICE_PLAYBACK] = NULL
+};
+
+static int64_t (*timestampToHostConverters[SUPPORTED_DEVICES_NUMBER])(caerDeviceHandle handle,
+	int64_t deviceTimestamp) = {
+		[CAER_DEVICE_DVS128] = &dvs128TimestampToHost,
+		[CAER_DEVICE_DAVIS_FX2] = &davisCommonTimestampToHost,
+		[CAER_DEVICE_DAVIS_FX3] = &davisCommonTimestampToHost,
+		[CAER_DEVICE_DYNAPSE] = &dynapseTimestampToHost,
+		[CAER_DEVICE_PLAYBACK] = &playbackTimestampToHost
+};
+
+static bool (*profilingGetters[SUPPORTED_DEVICES_NUMBER])(caerDeviceHandle handle,
+	struct caer_device_profiling_stage *stages) = {
+		[CAER_DEVICE_DVS128] = &dvs128ProfilingGet,
+		[CAER_DEVICE_DAVIS_FX2] = &davisCommonProfilingGet,
+		[CAER_DEVICE_DAVIS_FX3] = &davisCommonProfilingGet,
+		[CAER_DEVICE_DYNAPSE] = &dynapseProfilingGet,
+		[CAER_DEVICE_PLAYBACK] = &playbackProfilingGet
+};
+
+static bool (*memoryUsageGetters[SUPPORTED_DEVICES_NUMBER])(caerDeviceHandle handle,
+	struct caer_device_memory_usage *usages) = {
+		[CAER_DEVICE_DVS128] = &dvs128MemoryUsageGet,
+		[CAER_DEVICE_DAVIS_FX2] = &davisCommonMemoryUsageGet,
+		[CAER_DEVICE_DAVIS_FX3] = &davisCommonMemoryUsageGet,
+		[CAER_DEVICE_DYNAPSE] = &dynapseMemoryUsageGet,
+		[CAER_DEVICE_PLAYBACK] = &playbackMemoryUsageGet
+};
+
+static bool (*dataWatermarkNotifySetters[SUPPORTED_DEVICES_NUMBER])(caerDeviceHandle handle,
+	void (*dataWatermarkNotify)(void *ptr, bool high), void *dataWatermarkUserPtr) = {
+		[CAER_DEVICE_DVS128] = &dvs128DataWatermarkNotifySet,
+		[CAER_DEVICE_DAVIS_FX2] = &davisCommonDataWatermarkNotifySet,
+		[CAER_DEVICE_DAVIS_FX3] = &davisCommonDataWatermarkNotifySet,
+		[CAER_DEVICE_DYNAPSE] = &dynapseDataWatermarkNotifySet,
+		[CAER_DEVICE_PLAYBACK] = &playbackDataWatermarkNotifySet
 };
 
 struct caer_device_handle {
@@ -86,6 +149,11 @@ caerDeviceHandle caerDeviceOpen(uint16_t deviceID, uint16_t deviceType, uint8_t
 		return (NULL);
 	}
 
+	// Some device types have their own open function, with different parameters.
+	if (constructors[deviceType] == NULL) {
+		return (NULL);
+	}
+
 	// Execute main constructor function.
 	return (constructors[deviceType](deviceID, busNumberRestrict, devAddressRestrict, serialNumberRestrict));
 }
@@ -213,3 +281,104 @@ caerEventPacketContainer caerDeviceDataGet(caerDeviceHandle handle) {
 	// Call appropriate function.
 	return (dataGetters[handle->deviceType](handle));
 }
+
+size_t caerDeviceDataGetBatch(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t maxContainers) {
+	// Check if the pointer is valid.
+	if (handle == NULL) {
+		return (0);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType >= SUPPORTED_DEVICES_NUMBER) {
+		return (0);
+	}
+
+	// Call appropriate function.
+	return (dataBatchGetters[handle->deviceType](handle, containers, maxContainers));
+}
+
+bool caerDeviceDataWatermarkNotifySet(caerDeviceHandle handle, void (*dataWatermarkNotify)(void *ptr, bool high),
+	void *dataWatermarkUserPtr) {
+	// Check if the pointer is valid.
+	if (handle == NULL) {
+		return (false);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType >= SUPPORTED_DEVICES_NUMBER) {
+		return (false);
+	}
+
+	// Call appropriate function.
+	return (dataWatermarkNotifySetters[handle->deviceType](handle, dataWatermarkNotify, dataWatermarkUserPtr));
+}
+
+caerEventPacketContainer caerDeviceDataGetQueue(caerDeviceHandle handle, uint8_t queue) {
+	// Check if the pointer is valid.
+	if (handle == NULL) {
+		return (NULL);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType >= SUPPORTED_DEVICES_NUMBER) {
+		return (NULL);
+	}
+
+	// The main queue is always available.
+	if (queue == 0) {
+		return (dataGetters[handle->deviceType](handle));
+	}
+
+	// Secondary queues are not supported by all devices.
+	if (dataQueueGetters[handle->deviceType] == NULL) {
+		return (NULL);
+	}
+
+	// Call appropriate function.
+	return (dataQueueGetters[handle->deviceType](handle, queue));
+}
+
+int64_t caerDeviceTimestampToHost(caerDeviceHandle handle, int64_t deviceTimestamp) {
+	// Check if the pointer is valid.
+	if (handle == NULL) {
+		return (-1);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType >= SUPPORTED_DEVICES_NUMBER) {
+		return (-1);
+	}
+
+	// Call appropriate function.
+	return (timestampToHostConverters[handle->deviceType](handle, deviceTimestamp));
+}
+
+bool caerDeviceProfilingGet(caerDeviceHandle handle, struct caer_device_profiling_stage *stages) {
+	// Check if the pointers are valid.
+	if (handle == NULL || stages == NULL) {
+		return (false);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType >= SUPPORTED_DEVICES_NUMBER) {
+		return (false);
+	}
+
+	// Call appropriate function.
+	return (profilingGetters[handle->deviceType](handle, stages));
+}
+
+bool caerDeviceMemoryUsageGet(caerDeviceHandle handle, struct caer_device_memory_usage *usages) {
+	// Check if the pointers are valid.
+	if (handle == NULL || usages == NULL) {
+		return (false);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType >= SUPPORTED_DEVICES_NUMBER) {
+		return (false);
+	}
+
+	// Call appropriate function.
+	return (memoryUsageGetters[handle->deviceType](handle, usages));
+}
@@ -45,6 +45,8 @@ static inline void freeAllDataMemory(dvs128State state) {
 		caerEventPacketContainerFree(state->currentPacketContainer);
 		state->currentPacketContainer = NULL;
 	}
+
+	memoryUsageSet(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_PACKETS, 0);
 }
 
 caerDeviceHandle dvs128Open(uint16_t deviceID, uint8_t busNumberRestrict, uint8_t devAddressRestrict,
@@ -66,6 +68,7 @@ caerDeviceHandle dvs128Open(uint16_t deviceID, uint8_t busNumberRestrict, uint8_
 	// Initialize state variables to default values (if not zero, taken care of by calloc above).
 	atomic_store_explicit(&state->dataExchangeBufferSize, 64, memory_order_relaxed);
 	atomic_store_explicit(&state->dataExchangeBlocking, false, memory_order_relaxed);
+	watermarkInit(&state->dataExchangeWatermark);
 	atomic_store_explicit(&state->dataExchangeStartProducers, true, memory_order_relaxed);
 	atomic_store_explicit(&state->dataExchangeStopProducers, true, memory_order_relaxed);
 	atomic_store_explicit(&state->usbBufferNumber, 8, memory_order_relaxed);
@@ -216,15 +219,19 @@ bool dvs128ConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, ui
 				case CAER_HOST_CONFIG_USB_BUFFER_NUMBER:
 					atomic_store(&state->usbBufferNumber, param);
 
-					// Notify data acquisition thread to change buffers.
+					// Notify data acquisition thread to change buffers, and wake
+					// it up, so this happens right away, even if no data is flowing.
 					atomic_fetch_or(&state->dataAcquisitionThreadConfigUpdate, 1 << 0);
+					usbThreadWakeup(&state->usbState);
 					break;
 
 				case CAER_HOST_CONFIG_USB_BUFFER_SIZE:
 					atomic_store(&state->usbBufferSize, param);
 
-					// Notify data acquisition thread to change buffers.
+					// Notify data acquisition thread to change buffers, and wake
+					// it up, so this happens right away, even if no data is flowing.
 					atomic_fetch_or(&state->dataAcquisitionThreadConfigUpdate, 1 << 0);
+					usbThreadWakeup(&state->usbState);
 					break;
 
 				default:
@@ -251,12 +258,32 @@ bool dvs128ConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, ui
 					atomic_store(&state->dataExchangeStopProducers, param);
 					break;
 
+				case CAER_HOST_CONFIG_DATAEXCHANGE_HIGH_WATERMARK:
+					return (watermarkSetHigh(&state->dataExchangeWatermark, param));
+					break;
+
+				case CAER_HOST_CONFIG_DATAEXCHANGE_LOW_WATERMARK:
+					return (watermarkSetLow(&state->dataExchangeWatermark, param));
+					break;
+
 				default:
 					return (false);
 					break;
 			}
 			break;
 
+		case CAER_HOST_CONFIG_SHEDDING: {
+			size_t packetPosition = (size_t) (paramAddr - CAER_HOST_CONFIG_SHEDDING_PACKET_LEVEL);
+
+			// Special events hold the timestamp resets, never shed them.
+			if (packetPosition >= DVS_EVENT_TYPES || param > 100 || (packetPosition == SPECIAL_EVENT && param != 0)) {
+				return (false);
+			}
+
+			atomic_store(&state->dataExchangeSheddingLevel[packetPosition], U8T(param));
+			break;
+		}
+
 		case CAER_HOST_CONFIG_PACKETS:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_PACKET_SIZE:
@@ -273,6 +300,34 @@ bool dvs128ConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, ui
 			}
 			break;
 
+		case CAER_HOST_CONFIG_THREAD:
+			switch (paramAddr) {
+				case CAER_HOST_CONFIG_THREAD_CPU_AFFINITY:
+					atomic_store(&state->dataAcquisitionThreadCpuAffinity, param);
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_SCHED_POLICY:
+					if (param > CAER_HOST_CONFIG_THREAD_SCHED_RR) {
+						return (false);
+					}
+
+					atomic_store(&state->dataAcquisitionThreadSchedPolicy, param);
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_SCHED_PRIORITY:
+					atomic_store(&state->dataAcquisitionThreadSchedPriority, param);
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_MEMORY_LOCK:
+					atomic_store(&state->dataAcquisitionThreadMemoryLock, param);
+					break;
+
+				default:
+					return (false);
+					break;
+			}
+			break;
+
 		case DVS128_CONFIG_DVS:
 			switch (paramAddr) {
 				case DVS128_CONFIG_DVS_RUN:
@@ -407,12 +462,31 @@ bool dvs128ConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, ui
 					*param = atomic_load(&state->dataExchangeStopProducers);
 					break;
 
+				case CAER_HOST_CONFIG_DATAEXCHANGE_HIGH_WATERMARK:
+					*param = U32T(atomic_load(&state->dataExchangeWatermark.high));
+					break;
+
+				case CAER_HOST_CONFIG_DATAEXCHANGE_LOW_WATERMARK:
+					*param = U32T(atomic_load(&state->dataExchangeWatermark.low));
+					break;
+
 				default:
 					return (false);
 					break;
 			}
 			break;
 
+		case CAER_HOST_CONFIG_SHEDDING: {
+			size_t packetPosition = (size_t) (paramAddr - CAER_HOST_CONFIG_SHEDDING_PACKET_LEVEL);
+
+			if (packetPosition >= DVS_EVENT_TYPES) {
+				return (false);
+			}
+
+			*param = U32T(atomic_load(&state->dataExchangeSheddingLevel[packetPosition]));
+			break;
+		}
+
 		case CAER_HOST_CONFIG_PACKETS:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_PACKET_SIZE:
@@ -429,6 +503,30 @@ bool dvs128ConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, ui
 			}
 			break;
 
+		case CAER_HOST_CONFIG_THREAD:
+			switch (paramAddr) {
+				case CAER_HOST_CONFIG_THREAD_CPU_AFFINITY:
+					*param = U32T(atomic_load(&state->dataAcquisitionThreadCpuAffinity));
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_SCHED_POLICY:
+					*param = U32T(atomic_load(&state->dataAcquisitionThreadSchedPolicy));
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_SCHED_PRIORITY:
+					*param = U32T(atomic_load(&state->dataAcquisitionThreadSchedPriority));
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_MEMORY_LOCK:
+					*param = atomic_load(&state->dataAcquisitionThreadMemoryLock);
+					break;
+
+				default:
+					return (false);
+					break;
+			}
+			break;
+
 		case DVS128_CONFIG_DVS:
 			switch (paramAddr) {
 				case DVS128_CONFIG_DVS_RUN:
@@ -498,6 +596,9 @@ bool dvs128DataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr)
 	// will then set this correctly.
 	state->currentPacketContainerCommitTimestamp = -1;
 
+	// Device and host clocks have to be correlated anew.
+	clockCorrelationReset(&state->clockCorrelation);
+
 	// Initialize RingBuffer.
 	state->dataExchangeBuffer = ringBufferInit(atomic_load(&state->dataExchangeBufferSize));
 	if (state->dataExchangeBuffer == NULL) {
@@ -505,6 +606,10 @@ bool dvs128DataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr)
 		return (false);
 	}
 
+	// Watermarks follow the new buffer size.
+	watermarkReset(&state->dataExchangeWatermark, ringBufferSize(state->dataExchangeBuffer),
+		ringBufferPutCapacity(state->dataExchangeBuffer));
+
 	// Allocate packets.
 	state->currentPacketContainer = caerEventPacketContainerAllocate(DVS_EVENT_TYPES);
 	if (state->currentPacketContainer == NULL) {
@@ -568,17 +673,23 @@ bool dvs128DataStop(caerDeviceHandle cdh) {
 		return (false);
 	}
 
-	// Empty ringbuffer.
+	// Empty ringbuffer, including the timestamp resets still waiting to enter it.
+	// A successful flush can still move some of those in, so drain until all is empty.
 	caerEventPacketContainer container;
-	while ((container = ringBufferGet(state->dataExchangeBuffer)) != NULL) {
-		// Notify data-not-available call-back.
-		if (state->dataNotifyDecrease != NULL) {
-			state->dataNotifyDecrease(state->dataNotifyUserPtr);
-		}
+	do {
+		while ((container = ringBufferGet(state->dataExchangeBuffer)) != NULL) {
+			memoryUsageRemove(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE,
+				memoryUsageContainerSize(container));
+
+			// Notify data-not-available call-back.
+			if (state->dataNotifyDecrease != NULL) {
+				state->dataNotifyDecrease(state->dataNotifyUserPtr);
+			}
 
-		// Free container, which will free its subordinate packets too.
-		caerEventPacketContainerFree(container);
-	}
+			// Free container, which will free its subordinate packets too.
+			caerEventPacketContainerFree(container);
+		}
+	} while (!ringBufferFlush(state->dataExchangeBuffer) || ringBufferUsage(state->dataExchangeBuffer) != 0);
 
 	// Free current, uncommitted packets and ringbuffer.
 	freeAllDataMemory(state);
@@ -599,6 +710,13 @@ caerEventPacketContainer dvs128DataGet(caerDeviceHandle cdh) {
 	retry: container = ringBufferGet(state->dataExchangeBuffer);
 
 	if (container != NULL) {
+		// The container now belongs to the caller.
+		size_t containerSize = memoryUsageContainerSize(container);
+		memoryUsageRemove(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, containerSize);
+		memoryUsageAdd(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DELIVERED, containerSize);
+
+		watermarkUpdate(&state->dataExchangeWatermark, ringBufferUsage(state->dataExchangeBuffer));
+
 		// Found an event container, return it and signal this piece of data
 		// is no longer available for later acquisition.
 		if (state->dataNotifyDecrease != NULL) {
@@ -623,6 +741,87 @@ caerEventPacketContainer dvs128DataGet(caerDeviceHandle cdh) {
 	return (NULL);
 }
 
+size_t dvs128DataGetBatch(caerDeviceHandle cdh, caerEventPacketContainer *containers, size_t maxContainers) {
+	dvs128Handle handle = (dvs128Handle) cdh;
+	dvs128State state = &handle->state;
+
+	size_t containersNumber = 0;
+
+	if (containers == NULL || maxContainers == 0) {
+		return (0);
+	}
+
+	retry: containersNumber = ringBufferGetBatch(state->dataExchangeBuffer, (void **) containers, maxContainers);
+
+	if (containersNumber != 0) {
+		// The containers now belong to the caller.
+		for (size_t i = 0; i < containersNumber; i++) {
+			size_t containerSize = memoryUsageContainerSize(containers[i]);
+			memoryUsageRemove(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, containerSize);
+			memoryUsageAdd(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DELIVERED, containerSize);
+
+			// Signal each piece of data is no longer available for later acquisition.
+			if (state->dataNotifyDecrease != NULL) {
+				state->dataNotifyDecrease(state->dataNotifyUserPtr);
+			}
+		}
+
+		watermarkUpdate(&state->dataExchangeWatermark, ringBufferUsage(state->dataExchangeBuffer));
+
+		return (containersNumber);
+	}
+
+	// Didn't find any event container, either report this or retry, depending
+	// on blocking setting.
+	if (atomic_load_explicit(&state->dataExchangeBlocking, memory_order_relaxed)) {
+		// Don't retry right away in a tight loop, back off and wait a little.
+		// If no data is available, sleep for a millisecond to avoid wasting resources.
+		struct timespec noDataSleep = { .tv_sec = 0, .tv_nsec = 1000000 };
+		if (thrd_sleep(&noDataSleep, NULL) == 0) {
+			goto retry;
+		}
+	}
+
+	// Nothing.
+	return (0);
+}
+
+int64_t dvs128TimestampToHost(caerDeviceHandle cdh, int64_t deviceTimestamp) {
+	dvs128Handle handle = (dvs128Handle) cdh;
+
+	return (clockCorrelationToHost(&handle->state.clockCorrelation, deviceTimestamp));
+}
+
+bool dvs128ProfilingGet(caerDeviceHandle cdh, struct caer_device_profiling_stage *stages) {
+	dvs128Handle handle = (dvs128Handle) cdh;
+
+	return (profilingGet(&handle->state.usbState.profiling, stages));
+}
+
+bool dvs128MemoryUsageGet(caerDeviceHandle cdh, struct caer_device_memory_usage *usages) {
+	dvs128Handle handle = (dvs128Handle) cdh;
+
+	return (memoryUsageGet(&handle->state.usbState.memoryUsage, usages));
+}
+
+bool dvs128DataWatermarkNotifySet(caerDeviceHandle cdh, void (*dataWatermarkNotify)(void *ptr, bool high),
+	void *dataWatermarkUserPtr) {
+	dvs128Handle handle = (dvs128Handle) cdh;
+	dvs128State state = &handle->state;
+
+	// Both producer and consumers may call the notification, so it can't change under them.
+	if (state->dataExchangeBuffer != NULL) {
+		caerLog(CAER_LOG_ERROR, handle->info.deviceString,
+			"Cannot change watermark notification while data exchange is running.");
+		return (false);
+	}
+
+	state->dataExchangeWatermark.notify = dataWatermarkNotify;
+	state->dataExchangeWatermark.notifyUserPtr = dataWatermarkUserPtr;
+
+	return (true);
+}
+
 #define DVS128_TIMESTAMP_WRAP_MASK 0x80
 #define DVS128_TIMESTAMP_RESET_MASK 0x40
 #define DVS128_POLARITY_SHIFT 0
@@ -667,25 +866,35 @@ static void dvs128EventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent)
 	for (size_t i = 0; i < bytesSent; i += 4) {
 		// Allocate new packets for next iteration as needed.
 		if (state->currentPacketContainer == NULL) {
+			PROFILING_START(allocationStart);
+
 			state->currentPacketContainer = caerEventPacketContainerAllocate(DVS_EVENT_TYPES);
 			if (state->currentPacketContainer == NULL) {
 				caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate event packet container.");
 				return;
 			}
+
+			PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION], allocationStart);
 		}
 
 		if (state->currentPolarityPacket == NULL) {
+			PROFILING_START(allocationStart);
+
 			state->currentPolarityPacket = caerPolarityEventPacketAllocate(DVS_POLARITY_DEFAULT_SIZE,
 				I16T(handle->info.deviceID), state->wrapOverflow);
 			if (state->currentPolarityPacket == NULL) {
 				caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate polarity event packet.");
 				return;
 			}
+
+			PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION], allocationStart);
 		}
 		else if (state->currentPolarityPacketPosition
 			>= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentPolarityPacket)) {
 			// If not committed, let's check if any of the packets has reached its maximum
 			// capacity limit. If yes, we grow them to accomodate new events.
+			PROFILING_START(allocationStart);
+
 			caerPolarityEventPacket grownPacket = (caerPolarityEventPacket) caerEventPacketGrow(
 				(caerEventPacketHeader) state->currentPolarityPacket, state->currentPolarityPacketPosition * 2);
 			if (grownPacket == NULL) {
@@ -694,20 +903,28 @@ static void dvs128EventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent)
 			}
 
 			state->currentPolarityPacket = grownPacket;
+
+			PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION], allocationStart);
 		}
 
 		if (state->currentSpecialPacket == NULL) {
+			PROFILING_START(allocationStart);
+
 			state->currentSpecialPacket = caerSpecialEventPacketAllocate(DVS_SPECIAL_DEFAULT_SIZE,
 				I16T(handle->info.deviceID), state->wrapOverflow);
 			if (state->currentSpecialPacket == NULL) {
 				caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate special event packet.");
 				return;
 			}
+
+			PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION], allocationStart);
 		}
 		else if (state->currentSpecialPacketPosition
 			>= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentSpecialPacket)) {
 			// If not committed, let's check if any of the packets has reached its maximum
 			// capacity limit. If yes, we grow them to accomodate new events.
+			PROFILING_START(allocationStart);
+
 			caerSpecialEventPacket grownPacket = (caerSpecialEventPacket) caerEventPacketGrow(
 				(caerEventPacketHeader) state->currentSpecialPacket, state->currentSpecialPacketPosition * 2);
 			if (grownPacket == NULL) {
@@ -716,6 +933,8 @@ static void dvs128EventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent)
 			}
 
 			state->currentSpecialPacket = grownPacket;
+
+			PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION], allocationStart);
 		}
 
 		bool tsReset = false;
@@ -817,7 +1036,8 @@ static void dvs128EventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent)
 					continue; // Skip invalid event.
 				}
 
-				caerPolarityEvent currentEvent = caerPolarityEventPacketGetEvent(state->currentPolarityPacket,
+				// Space for this event was ensured at the start of the iteration.
+				caerPolarityEvent currentEvent = caerPolarityEventPacketGetEventUnchecked(state->currentPolarityPacket,
 					state->currentPolarityPacketPosition++);
 				caerPolarityEventSetTimestamp(currentEvent, state->currentTimestamp);
 				caerPolarityEventSetPolarity(currentEvent, polarity);
@@ -846,6 +1066,8 @@ static void dvs128EventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent)
 		// Commit packet containers to the ring-buffer, so they can be processed by the
 		// main-loop, when any of the required conditions are met.
 		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
+			PROFILING_START(commitStart);
+
 			// One or more of the commit triggers are hit. Set the packet container up to contain
 			// any non-empty packets. Empty packets are not forwarded to save memory.
 			bool emptyContainerCommit = true;
@@ -879,6 +1101,13 @@ static void dvs128EventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent)
 				}
 			}
 
+			// Under overload, drop the less important packets first, see CAER_HOST_CONFIG_SHEDDING.
+			if (!emptyContainerCommit
+				&& !sheddingApply(state->currentPacketContainer, state->dataExchangeSheddingLevel, DVS_EVENT_TYPES,
+					state->dataExchangeBuffer)) {
+				emptyContainerCommit = true;
+			}
+
 			// Filter out completely empty commits. This can happen when data is turned off,
 			// but the timestamps are still going forward.
 			if (emptyContainerCommit) {
@@ -886,7 +1115,16 @@ static void dvs128EventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent)
 				state->currentPacketContainer = NULL;
 			}
 			else {
+				caerEventPacketContainerSetHostTimestamp(state->currentPacketContainer,
+					clockCorrelationToHost(&state->clockCorrelation,
+						caerEventPacketContainerGetHighestEventTimestamp(state->currentPacketContainer)));
+
+				size_t containerSize = memoryUsageContainerSize(state->currentPacketContainer);
+				memoryUsageAdd(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, containerSize);
+
 				if (!ringBufferPut(state->dataExchangeBuffer, state->currentPacketContainer)) {
+					memoryUsageRemove(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, containerSize);
+
 					// Failed to forward packet container, just drop it, it doesn't contain
 					// any critical information anyway.
 					caerLog(CAER_LOG_INFO, handle->info.deviceString,
@@ -896,6 +1134,8 @@ static void dvs128EventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent)
 					state->currentPacketContainer = NULL;
 				}
 				else {
+					watermarkUpdate(&state->dataExchangeWatermark, ringBufferUsage(state->dataExchangeBuffer));
+
 					if (state->dataNotifyIncrease != NULL) {
 						state->dataNotifyIncrease(state->dataNotifyUserPtr);
 					}
@@ -938,25 +1178,49 @@ static void dvs128EventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent)
 				caerEventPacketContainerSetEventPacket(tsResetContainer, SPECIAL_EVENT,
 					(caerEventPacketHeader) tsResetPacket);
 
+				// Timestamps restart from zero, and so does the clock correlation.
+				caerEventPacketContainerSetHostTimestamp(tsResetContainer, state->usbState.dataTransferTime);
+				clockCorrelationReset(&state->clockCorrelation);
+
+				size_t tsResetContainerSize = memoryUsageContainerSize(tsResetContainer);
+				memoryUsageAdd(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, tsResetContainerSize);
+
 				// Reset MUST be committed, always, else downstream data processing and
 				// outputs get confused if they have no notification of timestamps
-				// jumping back go zero.
-				while (!ringBufferPut(state->dataExchangeBuffer, tsResetContainer)) {
-					// Prevent dead-lock if shutdown is requested and nothing is consuming
-					// data anymore, but the ring-buffer is full (and would thus never empty),
-					// thus blocking the USB handling thread in this loop.
-					if (!atomic_load_explicit(&state->dataAcquisitionThreadRun, memory_order_relaxed)) {
-						return;
-					}
+				// jumping back go zero. The ring-buffer's priority path never blocks
+				// the USB handling thread: if the ring-buffer is full, the reset waits
+				// there and enters as soon as there is space, still ahead of later data.
+				if (!ringBufferPutPriority(state->dataExchangeBuffer, tsResetContainer)) {
+					memoryUsageRemove(&state->usbState.memoryUsage,
+						CAER_DEVICE_MEMORY_DATA_EXCHANGE, tsResetContainerSize);
+
+					caerLog(CAER_LOG_ERROR, handle->info.deviceString,
+						"Dropped tsReset EventPacket Container because too many are waiting for ring-buffer space!");
+
+					caerEventPacketContainerFree(tsResetContainer);
 				}
+				else {
+					watermarkUpdate(&state->dataExchangeWatermark, ringBufferUsage(state->dataExchangeBuffer));
 
-				// Signal new container as usual.
-				if (state->dataNotifyIncrease != NULL) {
-					state->dataNotifyIncrease(state->dataNotifyUserPtr);
+					// Signal new container as usual.
+					if (state->dataNotifyIncrease != NULL) {
+						state->dataNotifyIncrease(state->dataNotifyUserPtr);
+					}
 				}
 			}
+
+			PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_COMMIT], commitStart);
 		}
 	}
+
+	// Account for the memory held by the current, uncommitted packets.
+	memoryUsageSet(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_PACKETS,
+		memoryUsagePacketSize((caerEventPacketHeader) state->currentPolarityPacket)
+			+ memoryUsagePacketSize((caerEventPacketHeader) state->currentSpecialPacket));
+
+	// Pair the latest device timestamp with the USB transfer completion time.
+	clockCorrelationUpdate(&state->clockCorrelation, generateFullTimestamp(state->wrapOverflow, state->currentTimestamp),
+		state->usbState.dataTransferTime);
 }
 
 static bool dvs128SendBiases(dvs128State state) {
@@ -978,6 +1242,12 @@ static int dvs128DataAcquisitionThread(void *inPtr) {
 	// Set thread name.
 	thrd_set_name(state->deviceThreadName);
 
+	// Apply CPU affinity, real-time scheduling and memory locking, if requested.
+	usbThreadConfigure(handle->info.deviceString, U32T(atomic_load(&state->dataAcquisitionThreadCpuAffinity)),
+		U32T(atomic_load(&state->dataAcquisitionThreadSchedPolicy)),
+		U32T(atomic_load(&state->dataAcquisitionThreadSchedPriority)),
+		atomic_load(&state->dataAcquisitionThreadMemoryLock));
+
 	// Reset configuration update, so as to not re-do work afterwards.
 	atomic_store(&state->dataAcquisitionThreadConfigUpdate, 0);
 
@@ -995,9 +1265,6 @@ static int dvs128DataAcquisitionThread(void *inPtr) {
 
 	caerLog(CAER_LOG_DEBUG, handle->info.deviceString, "data acquisition thread ready to process events.");
 
-	// Handle USB events (1 second timeout).
-	struct timeval te = { .tv_sec = 1, .tv_usec = 0 };
-
 	while (atomic_load_explicit(&state->dataAcquisitionThreadRun, memory_order_relaxed)
 		&& state->usbState.activeDataTransfers > 0) {
 		// Check config refresh, in this case to adjust buffer sizes.
@@ -1005,6 +1272,15 @@ static int dvs128DataAcquisitionThread(void *inPtr) {
 			dvs128DataAcquisitionThreadConfig(handle);
 		}
 
+		// Handle USB events (1 second timeout), or retry waiting timestamp
+		// resets soon (1 ms timeout), as consumers make space.
+		struct timeval te = { .tv_sec = 1, .tv_usec = 0 };
+
+		if (!ringBufferFlush(state->dataExchangeBuffer)) {
+			te.tv_sec = 0;
+			te.tv_usec = 1000;
+		}
+
 		libusb_handle_events_timeout(state->usbState.deviceContext, &te);
 	}
 
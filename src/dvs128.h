@@ -4,6 +4,9 @@
 #include "devices/dvs128.h"
 #include "ringbuffer/ringbuffer.h"
 #include "usb_utils.h"
+#include "watermark.h"
+#include "shedding.h"
+#include "clock_correlation.h"
 #include <stdatomic.h>
 
 #if defined(HAVE_PTHREADS)
@@ -42,6 +45,8 @@ struct dvs128_state {
 	RingBuffer dataExchangeBuffer;
 	atomic_uint_fast32_t dataExchangeBufferSize; // Only takes effect on DataStart() calls!
 	atomic_bool dataExchangeBlocking;
+	struct watermark_state dataExchangeWatermark;
+	atomic_uint_fast8_t dataExchangeSheddingLevel[DVS_EVENT_TYPES];
 	atomic_bool dataExchangeStartProducers;
 	atomic_bool dataExchangeStopProducers;
 	void (*dataNotifyIncrease)(void *ptr);
@@ -57,6 +62,10 @@ struct dvs128_state {
 	atomic_uint_fast32_t usbBufferSize;
 	// Data Acquisition Thread
 	thrd_t dataAcquisitionThread;
+	atomic_uint_fast32_t dataAcquisitionThreadCpuAffinity; // Only takes effect on DataStart() calls!
+	atomic_uint_fast32_t dataAcquisitionThreadSchedPolicy; // Only takes effect on DataStart() calls!
+	atomic_uint_fast32_t dataAcquisitionThreadSchedPriority; // Only takes effect on DataStart() calls!
+	atomic_bool dataAcquisitionThreadMemoryLock; // Only takes effect on DataStart() calls!
 	atomic_bool dataAcquisitionThreadRun;
 	atomic_uint_fast32_t dataAcquisitionThreadConfigUpdate;
 	// Timestamp fields
@@ -64,6 +73,8 @@ struct dvs128_state {
 	int32_t wrapAdd;
 	int32_t lastTimestamp;
 	int32_t currentTimestamp;
+	// Device to host clock correlation
+	struct clock_correlation clockCorrelation;
 	// Packet Container state
 	caerEventPacketContainer currentPacketContainer;
 	atomic_uint_fast32_t maxPacketContainerPacketSize;
@@ -109,5 +120,11 @@ bool dvs128DataStart(caerDeviceHandle handle, void (*dataNotifyIncrease)(void *p
 	void *dataShutdownUserPtr);
 bool dvs128DataStop(caerDeviceHandle handle);
 caerEventPacketContainer dvs128DataGet(caerDeviceHandle handle);
+size_t dvs128DataGetBatch(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t maxContainers);
+int64_t dvs128TimestampToHost(caerDeviceHandle handle, int64_t deviceTimestamp);
+bool dvs128ProfilingGet(caerDeviceHandle handle, struct caer_device_profiling_stage *stages);
+bool dvs128MemoryUsageGet(caerDeviceHandle handle, struct caer_device_memory_usage *usages);
+bool dvs128DataWatermarkNotifySet(caerDeviceHandle handle, void (*dataWatermarkNotify)(void *ptr, bool high),
+	void *dataWatermarkUserPtr);
 
 #endif /* LIBCAER_SRC_DVS128_H_ */
@@ -3,6 +3,7 @@
 static void dynapseEventTranslator(void *vdh, uint8_t *buffer, size_t bytesSent);
 static int dynapseDataAcquisitionThread(void *inPtr);
 static void dynapseDataAcquisitionThreadConfig(dynapseHandle handle);
+static void dynapseSpikeCountersPublish(dynapseState state);
 
 // i = index, x = amount of columns, y = amount of rows
 static inline uint32_t dynapseCalculateCoordinatesNeuX(uint32_t index, uint32_t columns, uint32_t rows) {
@@ -54,13 +55,17 @@ static inline void freeAllDataMemory(dynapseState state) {
 	// Since the current event packets aren't necessarily
 	// already assigned to the current packet container, we
 	// free them separately from it.
-	if (state->currentSpikePacket != NULL) {
-		free(&state->currentSpikePacket->packetHeader);
-		state->currentSpikePacket = NULL;
-
-		if (state->currentPacketContainer != NULL) {
-			caerEventPacketContainerSetEventPacket(state->currentPacketContainer, DYNAPSE_SPIKE_EVENT_POS,
-			NULL);
+	for (size_t i = 0; i < DYNAPSE_SPIKE_PACKETS_MAX; i++) {
+		if (state->currentSpikePacket[i] != NULL) {
+			free(&state->currentSpikePacket[i]->packetHeader);
+			state->currentSpikePacket[i] = NULL;
+
+			// Only the first currentSpikePacketsNumber are ever allocated, so this
+			// is always inside the container.
+			if (state->currentPacketContainer != NULL) {
+				caerEventPacketContainerSetEventPacket(state->currentPacketContainer,
+					I32T(DYNAPSE_SPIKE_EVENT_POS + i), NULL);
+			}
 		}
 	}
 
@@ -77,6 +82,8 @@ static inline void freeAllDataMemory(dynapseState state) {
 		caerEventPacketContainerFree(state->currentPacketContainer);
 		state->currentPacketContainer = NULL;
 	}
+
+	memoryUsageSet(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_PACKETS, 0);
 }
 
 caerDeviceHandle dynapseOpen(uint16_t deviceID, uint8_t busNumberRestrict, uint8_t devAddressRestrict,
@@ -97,6 +104,7 @@ caerDeviceHandle dynapseOpen(uint16_t deviceID, uint8_t busNumberRestrict, uint8
 	// Initialize state variables to default values (if not zero, taken care of by calloc above).
 	atomic_store_explicit(&state->dataExchangeBufferSize, 64, memory_order_relaxed);
 	atomic_store_explicit(&state->dataExchangeBlocking, false, memory_order_relaxed);
+	watermarkInit(&state->dataExchangeWatermark);
 	atomic_store_explicit(&state->dataExchangeStartProducers, true, memory_order_relaxed);
 	atomic_store_explicit(&state->dataExchangeStopProducers, true, memory_order_relaxed);
 	atomic_store_explicit(&state->usbBufferNumber, 8, memory_order_relaxed);
@@ -199,6 +207,9 @@ bool dynapseClose(caerDeviceHandle cdh) {
 	// Destroy libusb context.
 	libusb_exit(state->usbState.deviceContext);
 
+	// Free host-side network image.
+	dynapseNetworkImageFree(&state->networkImage);
+
 	caerLog(CAER_LOG_DEBUG, handle->info.deviceString, "Shutdown successful.");
 
 	// Free memory.
@@ -247,15 +258,19 @@ bool dynapseConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, u
 				case CAER_HOST_CONFIG_USB_BUFFER_NUMBER:
 					atomic_store(&state->usbBufferNumber, param);
 
-					// Notify data acquisition thread to change buffers.
+					// Notify data acquisition thread to change buffers, and wake
+					// it up, so this happens right away, even if no data is flowing.
 					atomic_fetch_or(&state->dataAcquisitionThreadConfigUpdate, 1 << 0);
+					usbThreadWakeup(&state->usbState);
 					break;
 
 				case CAER_HOST_CONFIG_USB_BUFFER_SIZE:
 					atomic_store(&state->usbBufferSize, param);
 
-					// Notify data acquisition thread to change buffers.
+					// Notify data acquisition thread to change buffers, and wake
+					// it up, so this happens right away, even if no data is flowing.
 					atomic_fetch_or(&state->dataAcquisitionThreadConfigUpdate, 1 << 0);
+					usbThreadWakeup(&state->usbState);
 					break;
 
 				default:
@@ -282,12 +297,33 @@ bool dynapseConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, u
 					atomic_store(&state->dataExchangeStopProducers, param);
 					break;
 
+				case CAER_HOST_CONFIG_DATAEXCHANGE_HIGH_WATERMARK:
+					return (watermarkSetHigh(&state->dataExchangeWatermark, param));
+					break;
+
+				case CAER_HOST_CONFIG_DATAEXCHANGE_LOW_WATERMARK:
+					return (watermarkSetLow(&state->dataExchangeWatermark, param));
+					break;
+
 				default:
 					return (false);
 					break;
 			}
 			break;
 
+		case CAER_HOST_CONFIG_SHEDDING: {
+			size_t packetPosition = (size_t) (paramAddr - CAER_HOST_CONFIG_SHEDDING_PACKET_LEVEL);
+
+			// Special events hold the timestamp resets, never shed them.
+			if (packetPosition >= DYNAPSE_CONTAINER_PACKETS_MAX || param > 100
+				|| (packetPosition == SPECIAL_EVENT && param != 0)) {
+				return (false);
+			}
+
+			atomic_store(&state->dataExchangeSheddingLevel[packetPosition], U8T(param));
+			break;
+		}
+
 		case CAER_HOST_CONFIG_PACKETS:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_PACKET_SIZE:
@@ -304,6 +340,60 @@ bool dynapseConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, u
 			}
 			break;
 
+		case CAER_HOST_CONFIG_THREAD:
+			switch (paramAddr) {
+				case CAER_HOST_CONFIG_THREAD_CPU_AFFINITY:
+					atomic_store(&state->dataAcquisitionThreadCpuAffinity, param);
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_SCHED_POLICY:
+					if (param > CAER_HOST_CONFIG_THREAD_SCHED_RR) {
+						return (false);
+					}
+
+					atomic_store(&state->dataAcquisitionThreadSchedPolicy, param);
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_SCHED_PRIORITY:
+					atomic_store(&state->dataAcquisitionThreadSchedPriority, param);
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_MEMORY_LOCK:
+					atomic_store(&state->dataAcquisitionThreadMemoryLock, param);
+					break;
+
+				default:
+					return (false);
+					break;
+			}
+			break;
+
+		case DYNAPSE_CONFIG_HOST_SPIKES:
+			switch (paramAddr) {
+				case DYNAPSE_CONFIG_HOST_SPIKES_SPLIT:
+					if (param > DYNAPSE_SPIKES_SPLIT_CORE) {
+						return (false);
+					}
+
+					atomic_store(&state->spikePacketSplit, param);
+					break;
+
+				case DYNAPSE_CONFIG_HOST_SPIKES_COUNTERS:
+					atomic_store(&state->spikeCountersEnabled, param);
+					break;
+
+				case DYNAPSE_CONFIG_HOST_SPIKES_COUNTERS_RESET:
+					if (param) {
+						atomic_store(&state->spikeCountersReset, true);
+					}
+					break;
+
+				default:
+					return (false);
+					break;
+			}
+			break;
+
 		case DYNAPSE_CONFIG_SRAM:
 			return (spiConfigSend(state->usbState.deviceHandle, DYNAPSE_CONFIG_SRAM, paramAddr, param));
 			break;
@@ -440,6 +530,10 @@ bool dynapseConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, u
 			break;
 
 		case DYNAPSE_CONFIG_CLEAR_CAM: {
+			// Applies to the currently selected chip, which we don't track, so
+			// the whole host-side CAM image can't be trusted anymore.
+			dynapseNetworkImageInvalidate(&state->networkImage, -1, true, false);
+
 			uint8_t spiMultiConfig[DYNAPSE_CONFIG_NUMCORES * DYNAPSE_CONFIG_NUMNEURONS * 6] = { 0 };
 
 			size_t numConfig = 0;
@@ -559,6 +653,8 @@ bool dynapseConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, u
 		}
 
 		case DYNAPSE_CONFIG_DEFAULT_SRAM_EMPTY: {
+			dynapseNetworkImageInvalidate(&state->networkImage, -1, false, true);
+
 			uint8_t spiMultiConfig[DYNAPSE_CONFIG_NUMCORES * DYNAPSE_CONFIG_SRAMROW * DYNAPSE_CONFIG_NUMSRAM_NEU * 6] =
 				{ 0 }; // 6 pieces made of 8 bytes each
 
@@ -630,6 +726,8 @@ bool dynapseConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, u
 		}
 
 		case DYNAPSE_CONFIG_DEFAULT_SRAM: {
+			dynapseNetworkImageInvalidate(&state->networkImage, -1, false, true);
+
 			uint8_t spiMultiConfig[DYNAPSE_CONFIG_NUMCORES * DYNAPSE_CONFIG_NUMNEURONS_CORE * DYNAPSE_CONFIG_NUMSRAM_NEU
 				* 6] = { 0 }; // 6 pieces made of 8 bytes each
 
@@ -977,12 +1075,31 @@ bool dynapseConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, u
 					*param = atomic_load(&state->dataExchangeStopProducers);
 					break;
 
+				case CAER_HOST_CONFIG_DATAEXCHANGE_HIGH_WATERMARK:
+					*param = U32T(atomic_load(&state->dataExchangeWatermark.high));
+					break;
+
+				case CAER_HOST_CONFIG_DATAEXCHANGE_LOW_WATERMARK:
+					*param = U32T(atomic_load(&state->dataExchangeWatermark.low));
+					break;
+
 				default:
 					return (false);
 					break;
 			}
 			break;
 
+		case CAER_HOST_CONFIG_SHEDDING: {
+			size_t packetPosition = (size_t) (paramAddr - CAER_HOST_CONFIG_SHEDDING_PACKET_LEVEL);
+
+			if (packetPosition >= DYNAPSE_CONTAINER_PACKETS_MAX) {
+				return (false);
+			}
+
+			*param = U32T(atomic_load(&state->dataExchangeSheddingLevel[packetPosition]));
+			break;
+		}
+
 		case CAER_HOST_CONFIG_PACKETS:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_PACKET_SIZE:
@@ -999,6 +1116,51 @@ bool dynapseConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, u
 			}
 			break;
 
+		case CAER_HOST_CONFIG_THREAD:
+			switch (paramAddr) {
+				case CAER_HOST_CONFIG_THREAD_CPU_AFFINITY:
+					*param = U32T(atomic_load(&state->dataAcquisitionThreadCpuAffinity));
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_SCHED_POLICY:
+					*param = U32T(atomic_load(&state->dataAcquisitionThreadSchedPolicy));
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_SCHED_PRIORITY:
+					*param = U32T(atomic_load(&state->dataAcquisitionThreadSchedPriority));
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_MEMORY_LOCK:
+					*param = atomic_load(&state->dataAcquisitionThreadMemoryLock);
+					break;
+
+				default:
+					return (false);
+					break;
+			}
+			break;
+
+		case DYNAPSE_CONFIG_HOST_SPIKES:
+			switch (paramAddr) {
+				case DYNAPSE_CONFIG_HOST_SPIKES_SPLIT:
+					*param = U32T(atomic_load(&state->spikePacketSplit));
+					break;
+
+				case DYNAPSE_CONFIG_HOST_SPIKES_COUNTERS:
+					*param = atomic_load(&state->spikeCountersEnabled);
+					break;
+
+				case DYNAPSE_CONFIG_HOST_SPIKES_COUNTERS_RESET:
+					// Always false because it's an impulse, it resets itself automatically.
+					*param = false;
+					break;
+
+				default:
+					return (false);
+					break;
+			}
+			break;
+
 		case DYNAPSE_CONFIG_MUX:
 			switch (paramAddr) {
 				case DYNAPSE_CONFIG_MUX_RUN:
@@ -1115,6 +1277,9 @@ bool dynapseDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr
 	// will then set this correctly.
 	state->currentPacketContainerCommitTimestamp = -1;
 
+	// Device and host clocks have to be correlated anew.
+	clockCorrelationReset(&state->clockCorrelation);
+
 	// Initialize RingBuffer.
 	state->dataExchangeBuffer = ringBufferInit(atomic_load(&state->dataExchangeBufferSize));
 	if (state->dataExchangeBuffer == NULL) {
@@ -1122,8 +1287,29 @@ bool dynapseDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr
 		return (false);
 	}
 
+	// Watermarks follow the new buffer size.
+	watermarkReset(&state->dataExchangeWatermark, ringBufferSize(state->dataExchangeBuffer),
+		ringBufferPutCapacity(state->dataExchangeBuffer));
+
+	// Spike packet splitting and counters.
+	state->currentSpikePacketSplit = U32T(atomic_load(&state->spikePacketSplit));
+	if (state->currentSpikePacketSplit == DYNAPSE_SPIKES_SPLIT_CHIP) {
+		state->currentSpikePacketsNumber = DYNAPSE_CONFIG_NUMCHIPS;
+	}
+	else if (state->currentSpikePacketSplit == DYNAPSE_SPIKES_SPLIT_CORE) {
+		state->currentSpikePacketsNumber = DYNAPSE_CONFIG_NUMCHIPS * DYNAPSE_CONFIG_NUMCORES;
+	}
+	else {
+		state->currentSpikePacketsNumber = 1;
+	}
+
+	memset(state->spikeCounters, 0, sizeof(state->spikeCounters));
+	atomic_store(&state->spikeCountersReset, false);
+	dynapseSpikeCountersPublish(state);
+
 	// Allocate packets.
-	state->currentPacketContainer = caerEventPacketContainerAllocate(DYNAPSE_EVENT_TYPES);
+	state->currentPacketContainer = caerEventPacketContainerAllocate(
+		I32T(DYNAPSE_SPIKE_EVENT_POS + state->currentSpikePacketsNumber));
 	if (state->currentPacketContainer == NULL) {
 		freeAllDataMemory(state);
 
@@ -1131,13 +1317,15 @@ bool dynapseDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr
 		return (false);
 	}
 
-	state->currentSpikePacket = caerSpikeEventPacketAllocate(DYNAPSE_SPIKE_DEFAULT_SIZE, I16T(handle->info.deviceID),
-		0);
-	if (state->currentSpikePacket == NULL) {
-		freeAllDataMemory(state);
+	for (size_t i = 0; i < state->currentSpikePacketsNumber; i++) {
+		state->currentSpikePacket[i] = caerSpikeEventPacketAllocate(DYNAPSE_SPIKE_DEFAULT_SIZE,
+			I16T(handle->info.deviceID), 0);
+		if (state->currentSpikePacket[i] == NULL) {
+			freeAllDataMemory(state);
 
-		caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate spike event packet.");
-		return (false);
+			caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate spike event packet.");
+			return (false);
+		}
 	}
 
 	state->currentSpecialPacket = caerSpecialEventPacketAllocate(DYNAPSE_SPECIAL_DEFAULT_SIZE,
@@ -1189,23 +1377,31 @@ bool dynapseDataStop(caerDeviceHandle cdh) {
 		return (false);
 	}
 
-	// Empty ringbuffer.
+	// Empty ringbuffer, including the timestamp resets still waiting to enter it.
+	// A successful flush can still move some of those in, so drain until all is empty.
 	caerEventPacketContainer container;
-	while ((container = ringBufferGet(state->dataExchangeBuffer)) != NULL) {
-		// Notify data-not-available call-back.
-		if (state->dataNotifyDecrease != NULL) {
-			state->dataNotifyDecrease(state->dataNotifyUserPtr);
-		}
+	do {
+		while ((container = ringBufferGet(state->dataExchangeBuffer)) != NULL) {
+			memoryUsageRemove(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE,
+				memoryUsageContainerSize(container));
+
+			// Notify data-not-available call-back.
+			if (state->dataNotifyDecrease != NULL) {
+				state->dataNotifyDecrease(state->dataNotifyUserPtr);
+			}
 
-		// Free container, which will free its subordinate packets too.
-		caerEventPacketContainerFree(container);
-	}
+			// Free container, which will free its subordinate packets too.
+			caerEventPacketContainerFree(container);
+		}
+	} while (!ringBufferFlush(state->dataExchangeBuffer) || ringBufferUsage(state->dataExchangeBuffer) != 0);
 
 	// Free current, uncommitted packets and ringbuffer.
 	freeAllDataMemory(state);
 
 	// Reset packet positions.
-	state->currentSpikePacketPosition = 0;
+	for (size_t i = 0; i < DYNAPSE_SPIKE_PACKETS_MAX; i++) {
+		state->currentSpikePacketPosition[i] = 0;
+	}
 	state->currentSpecialPacketPosition = 0;
 
 	return (true);
@@ -1219,6 +1415,13 @@ caerEventPacketContainer dynapseDataGet(caerDeviceHandle cdh) {
 	retry: container = ringBufferGet(state->dataExchangeBuffer);
 
 	if (container != NULL) {
+		// The container now belongs to the caller.
+		size_t containerSize = memoryUsageContainerSize(container);
+		memoryUsageRemove(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, containerSize);
+		memoryUsageAdd(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DELIVERED, containerSize);
+
+		watermarkUpdate(&state->dataExchangeWatermark, ringBufferUsage(state->dataExchangeBuffer));
+
 		// Found an event container, return it and signal this piece of data
 		// is no longer available for later acquisition.
 		if (state->dataNotifyDecrease != NULL) {
@@ -1243,12 +1446,111 @@ caerEventPacketContainer dynapseDataGet(caerDeviceHandle cdh) {
 	return (NULL);
 }
 
+size_t dynapseDataGetBatch(caerDeviceHandle cdh, caerEventPacketContainer *containers, size_t maxContainers) {
+	dynapseHandle handle = (dynapseHandle) cdh;
+	dynapseState state = &handle->state;
+
+	size_t containersNumber = 0;
+
+	if (containers == NULL || maxContainers == 0) {
+		return (0);
+	}
+
+	retry: containersNumber = ringBufferGetBatch(state->dataExchangeBuffer, (void **) containers, maxContainers);
+
+	if (containersNumber != 0) {
+		// The containers now belong to the caller.
+		for (size_t i = 0; i < containersNumber; i++) {
+			size_t containerSize = memoryUsageContainerSize(containers[i]);
+			memoryUsageRemove(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, containerSize);
+			memoryUsageAdd(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DELIVERED, containerSize);
+
+			// Signal each piece of data is no longer available for later acquisition.
+			if (state->dataNotifyDecrease != NULL) {
+				state->dataNotifyDecrease(state->dataNotifyUserPtr);
+			}
+		}
+
+		watermarkUpdate(&state->dataExchangeWatermark, ringBufferUsage(state->dataExchangeBuffer));
+
+		return (containersNumber);
+	}
+
+	// Didn't find any event container, either report this or retry, depending
+	// on blocking setting.
+	if (atomic_load_explicit(&state->dataExchangeBlocking, memory_order_relaxed)) {
+		// Don't retry right away in a tight loop, back off and wait a little.
+		// If no data is available, sleep for a millisecond to avoid wasting resources.
+		struct timespec noDataSleep = { .tv_sec = 0, .tv_nsec = 1000000 };
+		if (thrd_sleep(&noDataSleep, NULL) == 0) {
+			goto retry;
+		}
+	}
+
+	// Nothing.
+	return (0);
+}
+
+int64_t dynapseTimestampToHost(caerDeviceHandle cdh, int64_t deviceTimestamp) {
+	dynapseHandle handle = (dynapseHandle) cdh;
+
+	return (clockCorrelationToHost(&handle->state.clockCorrelation, deviceTimestamp));
+}
+
+bool dynapseProfilingGet(caerDeviceHandle cdh, struct caer_device_profiling_stage *stages) {
+	dynapseHandle handle = (dynapseHandle) cdh;
+
+	return (profilingGet(&handle->state.usbState.profiling, stages));
+}
+
+bool dynapseMemoryUsageGet(caerDeviceHandle cdh, struct caer_device_memory_usage *usages) {
+	dynapseHandle handle = (dynapseHandle) cdh;
+
+	return (memoryUsageGet(&handle->state.usbState.memoryUsage, usages));
+}
+
+bool dynapseDataWatermarkNotifySet(caerDeviceHandle cdh, void (*dataWatermarkNotify)(void *ptr, bool high),
+	void *dataWatermarkUserPtr) {
+	dynapseHandle handle = (dynapseHandle) cdh;
+	dynapseState state = &handle->state;
+
+	// Both producer and consumers may call the notification, so it can't change under them.
+	if (state->dataExchangeBuffer != NULL) {
+		caerLog(CAER_LOG_ERROR, handle->info.deviceString,
+			"Cannot change watermark notification while data exchange is running.");
+		return (false);
+	}
+
+	state->dataExchangeWatermark.notify = dataWatermarkNotify;
+	state->dataExchangeWatermark.notifyUserPtr = dataWatermarkUserPtr;
+
+	return (true);
+}
+
 #define TS_WRAP_ADD 0x8000
 
 static inline int64_t generateFullTimestamp(int32_t tsOverflow, int32_t timestamp) {
 	return (I64T((U64T(tsOverflow) << TS_OVERFLOW_SHIFT) | U64T(timestamp)));
 }
 
+static void dynapseSpikeCountersPublish(dynapseState state) {
+	struct dynapse_spike_counters_snapshot *snapshot = &state->spikeCountersSnapshot;
+
+	// Odd sequence number: update in progress.
+	uint_fast32_t sequence = atomic_load_explicit(&snapshot->sequence, memory_order_relaxed);
+	atomic_store_explicit(&snapshot->sequence, sequence + 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+
+	for (size_t i = 0; i < DYNAPSE_SPIKE_COUNTERS_NUMBER; i++) {
+		atomic_store_explicit(&snapshot->counters[i], state->spikeCounters[i], memory_order_relaxed);
+	}
+
+	atomic_store_explicit(&snapshot->timestamp, generateFullTimestamp(state->wrapOverflow, state->currentTimestamp),
+		memory_order_relaxed);
+
+	atomic_store_explicit(&snapshot->sequence, sequence + 2, memory_order_release);
+}
+
 static inline void initContainerCommitTimestamp(dynapseState state) {
 	if (state->currentPacketContainerCommitTimestamp == -1) {
 		state->currentPacketContainerCommitTimestamp = state->currentTimestamp
@@ -1275,51 +1577,47 @@ static void dynapseEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent)
 		bytesSent &= (size_t) ~0x01;
 	}
 
+	// Spike counters settings are sampled once per buffer.
+	bool spikeCountersEnabled = atomic_load_explicit(&state->spikeCountersEnabled, memory_order_relaxed);
+
+	if (atomic_exchange(&state->spikeCountersReset, false)) {
+		memset(state->spikeCounters, 0, sizeof(state->spikeCounters));
+		dynapseSpikeCountersPublish(state);
+	}
+
 	for (size_t i = 0; i < bytesSent; i += 2) {
 		// Allocate new packets for next iteration as needed.
 		if (state->currentPacketContainer == NULL) {
+			PROFILING_START(allocationStart);
+
 			state->currentPacketContainer = caerEventPacketContainerAllocate(
-			DYNAPSE_EVENT_TYPES);
+				I32T(DYNAPSE_SPIKE_EVENT_POS + state->currentSpikePacketsNumber));
 			if (state->currentPacketContainer == NULL) {
 				caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate event packet container.");
 				return;
 			}
-		}
 
-		if (state->currentSpikePacket == NULL) {
-			state->currentSpikePacket = caerSpikeEventPacketAllocate(
-			DYNAPSE_SPIKE_DEFAULT_SIZE, I16T(handle->info.deviceID), state->wrapOverflow);
-			if (state->currentSpikePacket == NULL) {
-				caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate spike event packet.");
-				return;
-			}
-		}
-		else if (state->currentSpikePacketPosition
-			>= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentSpikePacket)) {
-			// If not committed, let's check if any of the packets has reached its maximum
-			// capacity limit. If yes, we grow them to accomodate new events.
-			caerSpikeEventPacket grownPacket = (caerSpikeEventPacket) caerEventPacketGrow(
-				(caerEventPacketHeader) state->currentSpikePacket, state->currentSpikePacketPosition * 2);
-			if (grownPacket == NULL) {
-				caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to grow spike event packet.");
-				return;
-			}
-
-			state->currentSpikePacket = grownPacket;
+			PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION], allocationStart);
 		}
 
 		if (state->currentSpecialPacket == NULL) {
+			PROFILING_START(allocationStart);
+
 			state->currentSpecialPacket = caerSpecialEventPacketAllocate(
 			DYNAPSE_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->wrapOverflow);
 			if (state->currentSpecialPacket == NULL) {
 				caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate special event packet.");
 				return;
 			}
+
+			PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION], allocationStart);
 		}
 		else if (state->currentSpecialPacketPosition
 			>= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentSpecialPacket)) {
 			// If not committed, let's check if any of the packets has reached its maximum
 			// capacity limit. If yes, we grow them to accomodate new events.
+			PROFILING_START(allocationStart);
+
 			caerSpecialEventPacket grownPacket = (caerSpecialEventPacket) caerEventPacketGrow(
 				(caerEventPacketHeader) state->currentSpecialPacket, state->currentSpecialPacketPosition * 2);
 			if (grownPacket == NULL) {
@@ -1328,6 +1626,8 @@ static void dynapseEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent)
 			}
 
 			state->currentSpecialPacket = grownPacket;
+
+			PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION], allocationStart);
 		}
 
 		bool tsReset = false;
@@ -1401,16 +1701,60 @@ static void dynapseEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent)
 					uint8_t chipID = data & 0x0F;
 					uint32_t neuronID = (data >> 4) & 0x00FF;
 
-					caerSpikeEvent currentSpikeEvent = caerSpikeEventPacketGetEvent(state->currentSpikePacket,
-						state->currentSpikePacketPosition);
+					// Spike packets are allocated only when needed, as with splitting
+					// most of them may stay empty for a while.
+					size_t spikeIdx = caerDynapseSpikePacketIndex(state->currentSpikePacketSplit, chipID,
+						sourceCoreID);
+
+					if (state->currentSpikePacket[spikeIdx] == NULL) {
+						PROFILING_START(allocationStart);
+
+						state->currentSpikePacket[spikeIdx] = caerSpikeEventPacketAllocate(
+						DYNAPSE_SPIKE_DEFAULT_SIZE, I16T(handle->info.deviceID), state->wrapOverflow);
+						if (state->currentSpikePacket[spikeIdx] == NULL) {
+							caerLog(CAER_LOG_CRITICAL, handle->info.deviceString,
+								"Failed to allocate spike event packet.");
+							return;
+						}
+
+						PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION],
+							allocationStart);
+					}
+					else if (state->currentSpikePacketPosition[spikeIdx]
+						>= caerEventPacketHeaderGetEventCapacity(
+							(caerEventPacketHeader) state->currentSpikePacket[spikeIdx])) {
+						// If not committed, let's check if the packet has reached its maximum
+						// capacity limit. If yes, we grow it to accomodate new events.
+						PROFILING_START(allocationStart);
+
+						caerSpikeEventPacket grownPacket = (caerSpikeEventPacket) caerEventPacketGrow(
+							(caerEventPacketHeader) state->currentSpikePacket[spikeIdx],
+							state->currentSpikePacketPosition[spikeIdx] * 2);
+						if (grownPacket == NULL) {
+							caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to grow spike event packet.");
+							return;
+						}
+
+						state->currentSpikePacket[spikeIdx] = grownPacket;
+
+						PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_PACKET_ALLOCATION],
+							allocationStart);
+					}
+
+					caerSpikeEvent currentSpikeEvent = caerSpikeEventPacketGetEventUnchecked(
+						state->currentSpikePacket[spikeIdx], state->currentSpikePacketPosition[spikeIdx]);
 
 					// Timestamp at event-stream insertion point.
 					caerSpikeEventSetTimestamp(currentSpikeEvent, state->currentTimestamp);
 					caerSpikeEventSetSourceCoreID(currentSpikeEvent, sourceCoreID);
 					caerSpikeEventSetChipID(currentSpikeEvent, chipID);
 					caerSpikeEventSetNeuronID(currentSpikeEvent, neuronID);
-					caerSpikeEventValidate(currentSpikeEvent, state->currentSpikePacket);
-					state->currentSpikePacketPosition++;
+					caerSpikeEventValidate(currentSpikeEvent, state->currentSpikePacket[spikeIdx]);
+					state->currentSpikePacketPosition[spikeIdx]++;
+
+					if (spikeCountersEnabled) {
+						state->spikeCounters[caerDynapseSpikeCountersIndex(chipID, sourceCoreID, neuronID)]++;
+					}
 
 					break;
 				}
@@ -1477,8 +1821,12 @@ static void dynapseEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent)
 		int32_t currentPacketContainerCommitSize = I32T(
 			atomic_load_explicit(&state->maxPacketContainerPacketSize, memory_order_relaxed));
 		bool containerSizeCommit = (currentPacketContainerCommitSize > 0)
-			&& ((state->currentSpikePacketPosition >= currentPacketContainerCommitSize)
-				|| (state->currentSpecialPacketPosition >= currentPacketContainerCommitSize));
+			&& (state->currentSpecialPacketPosition >= currentPacketContainerCommitSize);
+
+		for (size_t j = 0; j < state->currentSpikePacketsNumber && !containerSizeCommit; j++) {
+			containerSizeCommit = (currentPacketContainerCommitSize > 0)
+				&& (state->currentSpikePacketPosition[j] >= currentPacketContainerCommitSize);
+		}
 
 		bool containerTimeCommit = generateFullTimestamp(state->wrapOverflow, state->currentTimestamp)
 			> state->currentPacketContainerCommitTimestamp;
@@ -1486,17 +1834,25 @@ static void dynapseEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent)
 		// Commit packet containers to the ring-buffer, so they can be processed by the
 		// main-loop, when any of the required conditions are met.
 		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
+			PROFILING_START(commitStart);
+
 			// One or more of the commit triggers are hit. Set the packet container up to contain
 			// any non-empty packets. Empty packets are not forwarded to save memory.
 			bool emptyContainerCommit = true;
 
-			if (state->currentSpikePacketPosition > 0) {
-				caerEventPacketContainerSetEventPacket(state->currentPacketContainer, DYNAPSE_SPIKE_EVENT_POS,
-					(caerEventPacketHeader) state->currentSpikePacket);
+			for (size_t j = 0; j < state->currentSpikePacketsNumber; j++) {
+				if (state->currentSpikePacketPosition[j] > 0) {
+					caerEventPacketContainerSetEventPacket(state->currentPacketContainer,
+						I32T(DYNAPSE_SPIKE_EVENT_POS + j), (caerEventPacketHeader) state->currentSpikePacket[j]);
 
-				state->currentSpikePacket = NULL;
-				state->currentSpikePacketPosition = 0;
-				emptyContainerCommit = false;
+					state->currentSpikePacket[j] = NULL;
+					state->currentSpikePacketPosition[j] = 0;
+					emptyContainerCommit = false;
+				}
+			}
+
+			if (spikeCountersEnabled) {
+				dynapseSpikeCountersPublish(state);
 			}
 
 			if (state->currentSpecialPacketPosition > 0) {
@@ -1519,6 +1875,13 @@ static void dynapseEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent)
 				}
 			}
 
+			// Under overload, drop the less important packets first, see CAER_HOST_CONFIG_SHEDDING.
+			if (!emptyContainerCommit
+				&& !sheddingApply(state->currentPacketContainer, state->dataExchangeSheddingLevel,
+					DYNAPSE_CONTAINER_PACKETS_MAX, state->dataExchangeBuffer)) {
+				emptyContainerCommit = true;
+			}
+
 			// Filter out completely empty commits. This can happen when data is turned off,
 			// but the timestamps are still going forward.
 			if (emptyContainerCommit) {
@@ -1526,7 +1889,16 @@ static void dynapseEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent)
 				state->currentPacketContainer = NULL;
 			}
 			else {
+				caerEventPacketContainerSetHostTimestamp(state->currentPacketContainer,
+					clockCorrelationToHost(&state->clockCorrelation,
+						caerEventPacketContainerGetHighestEventTimestamp(state->currentPacketContainer)));
+
+				size_t containerSize = memoryUsageContainerSize(state->currentPacketContainer);
+				memoryUsageAdd(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, containerSize);
+
 				if (!ringBufferPut(state->dataExchangeBuffer, state->currentPacketContainer)) {
+					memoryUsageRemove(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, containerSize);
+
 					// Failed to forward packet container, just drop it, it doesn't contain
 					// any critical information anyway.
 					caerLog(CAER_LOG_INFO, handle->info.deviceString,
@@ -1536,6 +1908,8 @@ static void dynapseEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent)
 					state->currentPacketContainer = NULL;
 				}
 				else {
+					watermarkUpdate(&state->dataExchangeWatermark, ringBufferUsage(state->dataExchangeBuffer));
+
 					if (state->dataNotifyIncrease != NULL) {
 						state->dataNotifyIncrease(state->dataNotifyUserPtr);
 					}
@@ -1552,7 +1926,8 @@ static void dynapseEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent)
 			// be ordered after any other event packets in any processing or output stream.
 			if (tsReset) {
 				// Allocate packet container just for this event.
-				caerEventPacketContainer tsResetContainer = caerEventPacketContainerAllocate(DYNAPSE_EVENT_TYPES);
+				caerEventPacketContainer tsResetContainer = caerEventPacketContainerAllocate(
+					I32T(DYNAPSE_SPIKE_EVENT_POS + state->currentSpikePacketsNumber));
 				if (tsResetContainer == NULL) {
 					caerLog(CAER_LOG_CRITICAL, handle->info.deviceString,
 						"Failed to allocate tsReset event packet container.");
@@ -1578,25 +1953,53 @@ static void dynapseEventTranslator(void *vhd, uint8_t *buffer, size_t bytesSent)
 				caerEventPacketContainerSetEventPacket(tsResetContainer, SPECIAL_EVENT,
 					(caerEventPacketHeader) tsResetPacket);
 
+				// Timestamps restart from zero, and so does the clock correlation.
+				caerEventPacketContainerSetHostTimestamp(tsResetContainer, state->usbState.dataTransferTime);
+				clockCorrelationReset(&state->clockCorrelation);
+
+				size_t tsResetContainerSize = memoryUsageContainerSize(tsResetContainer);
+				memoryUsageAdd(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, tsResetContainerSize);
+
 				// Reset MUST be committed, always, else downstream data processing and
 				// outputs get confused if they have no notification of timestamps
-				// jumping back go zero.
-				while (!ringBufferPut(state->dataExchangeBuffer, tsResetContainer)) {
-					// Prevent dead-lock if shutdown is requested and nothing is consuming
-					// data anymore, but the ring-buffer is full (and would thus never empty),
-					// thus blocking the USB handling thread in this loop.
-					if (!atomic_load_explicit(&state->dataAcquisitionThreadRun, memory_order_relaxed)) {
-						return;
-					}
+				// jumping back go zero. The ring-buffer's priority path never blocks
+				// the USB handling thread: if the ring-buffer is full, the reset waits
+				// there and enters as soon as there is space, still ahead of later data.
+				if (!ringBufferPutPriority(state->dataExchangeBuffer, tsResetContainer)) {
+					memoryUsageRemove(&state->usbState.memoryUsage,
+						CAER_DEVICE_MEMORY_DATA_EXCHANGE, tsResetContainerSize);
+
+					caerLog(CAER_LOG_ERROR, handle->info.deviceString,
+						"Dropped tsReset EventPacket Container because too many are waiting for ring-buffer space!");
+
+					caerEventPacketContainerFree(tsResetContainer);
 				}
+				else {
+					watermarkUpdate(&state->dataExchangeWatermark, ringBufferUsage(state->dataExchangeBuffer));
 
-				// Signal new container as usual.
-				if (state->dataNotifyIncrease != NULL) {
-					state->dataNotifyIncrease(state->dataNotifyUserPtr);
+					// Signal new container as usual.
+					if (state->dataNotifyIncrease != NULL) {
+						state->dataNotifyIncrease(state->dataNotifyUserPtr);
+					}
 				}
 			}
+
+			PROFILING_STOP(state->usbState.profiling.stages[CAER_DEVICE_PROFILING_COMMIT], commitStart);
 		}
 	}
+
+	// Account for the memory held by the current, uncommitted packets.
+	size_t packetsMemory = memoryUsagePacketSize((caerEventPacketHeader) state->currentSpecialPacket);
+
+	for (size_t i = 0; i < state->currentSpikePacketsNumber; i++) {
+		packetsMemory += memoryUsagePacketSize((caerEventPacketHeader) state->currentSpikePacket[i]);
+	}
+
+	memoryUsageSet(&state->usbState.memoryUsage, CAER_DEVICE_MEMORY_PACKETS, packetsMemory);
+
+	// Pair the latest device timestamp with the USB transfer completion time.
+	clockCorrelationUpdate(&state->clockCorrelation, generateFullTimestamp(state->wrapOverflow, state->currentTimestamp),
+		state->usbState.dataTransferTime);
 }
 
 static int dynapseDataAcquisitionThread(void *inPtr) {
@@ -1609,6 +2012,12 @@ static int dynapseDataAcquisitionThread(void *inPtr) {
 	// Set thread name.
 	thrd_set_name(state->deviceThreadName);
 
+	// Apply CPU affinity, real-time scheduling and memory locking, if requested.
+	usbThreadConfigure(handle->info.deviceString, U32T(atomic_load(&state->dataAcquisitionThreadCpuAffinity)),
+		U32T(atomic_load(&state->dataAcquisitionThreadSchedPolicy)),
+		U32T(atomic_load(&state->dataAcquisitionThreadSchedPriority)),
+		atomic_load(&state->dataAcquisitionThreadMemoryLock));
+
 	// Reset configuration update, so as to not re-do work afterwards.
 	atomic_store(&state->dataAcquisitionThreadConfigUpdate, 0);
 
@@ -1630,9 +2039,6 @@ static int dynapseDataAcquisitionThread(void *inPtr) {
 
 	caerLog(CAER_LOG_DEBUG, handle->info.deviceString, "data acquisition thread ready to process events.");
 
-	// Handle USB events (1 second timeout).
-	struct timeval te = { .tv_sec = 1, .tv_usec = 0 };
-
 	while (atomic_load_explicit(&state->dataAcquisitionThreadRun, memory_order_relaxed)
 		&& state->usbState.activeDataTransfers > 0) {
 		// Check config refresh, in this case to adjust buffer sizes.
@@ -1640,6 +2046,15 @@ static int dynapseDataAcquisitionThread(void *inPtr) {
 			dynapseDataAcquisitionThreadConfig(handle);
 		}
 
+		// Handle USB events (1 second timeout), or retry waiting timestamp
+		// resets soon (1 ms timeout), as consumers make space.
+		struct timeval te = { .tv_sec = 1, .tv_usec = 0 };
+
+		if (!ringBufferFlush(state->dataExchangeBuffer)) {
+			te.tv_sec = 0;
+			te.tv_usec = 1000;
+		}
+
 		libusb_handle_events_timeout(state->usbState.deviceContext, &te);
 	}
 
@@ -1742,7 +2157,8 @@ bool caerDynapseSendDataToUSB(caerDeviceHandle cdh, const uint32_t *pointer, siz
 	return (true);
 }
 
-bool caerDynapseWriteSramWords(caerDeviceHandle cdh, const uint16_t *data, uint32_t baseAddr, uint32_t numWords) {
+bool caerDynapseSendDataToUSBPipelined(caerDeviceHandle cdh, const uint32_t *data, size_t numConfig,
+	size_t maxTransfersInFlight, size_t verifyInterval, double *configsPerSecond) {
 	dynapseHandle handle = (dynapseHandle) cdh;
 
 	// Check if the pointer is valid.
@@ -1755,86 +2171,452 @@ bool caerDynapseWriteSramWords(caerDeviceHandle cdh, const uint16_t *data, uint3
 		return (false);
 	}
 
+	if (data == NULL || numConfig == 0) {
+		return (false);
+	}
+
 	dynapseState state = &handle->state;
 
+	// We need malloc because the number of configs is not limited here.
+	uint8_t *spiMultiConfig = malloc(numConfig * USB_CONFIG_MULTIPLE_SIZE);
+	if (spiMultiConfig == NULL) {
+		caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to malloc spiMultiConfigArray");
+		return (false);
+	}
+
+	for (size_t i = 0; i < numConfig; i++) {
+		spiMultiConfig[(i * 6) + 0] = DYNAPSE_CONFIG_CHIP;
+		spiMultiConfig[(i * 6) + 1] = DYNAPSE_CONFIG_CHIP_CONTENT;
+		spiMultiConfig[(i * 6) + 2] = U8T((data[i] >> 24) & 0x0FF);
+		spiMultiConfig[(i * 6) + 3] = U8T((data[i] >> 16) & 0x0FF);
+		spiMultiConfig[(i * 6) + 4] = U8T((data[i] >> 8) & 0x0FF);
+		spiMultiConfig[(i * 6) + 5] = U8T((data[i] >> 0) & 0x0FF);
+	}
+
+	bool result = usbConfigMultipleSendPipelined(&state->usbState, handle->info.deviceString,
+		VENDOR_REQUEST_FPGA_CONFIG_AER_MULTIPLE, spiMultiConfig, numConfig, maxTransfersInFlight, verifyInterval,
+		true, configsPerSecond);
+
+	free(spiMultiConfig);
+
+	return (result);
+}
+
+bool caerDynapseWriteBiases(caerDeviceHandle cdh, uint8_t chipId, const struct caer_dynapse_bias_value *biases,
+	size_t biasesNumber, size_t *biasesSent) {
+	dynapseHandle handle = (dynapseHandle) cdh;
+
+	if (biasesSent != NULL) {
+		*biasesSent = 0;
+	}
+
+	// Check if the pointer is valid.
+	if (handle == NULL) {
+		return (false);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType != CAER_DEVICE_DYNAPSE) {
+		return (false);
+	}
+
+	int chipIndex = dynapseNetworkChipIndex(chipId);
+	if (chipIndex < 0 || biases == NULL) {
+		return (false);
+	}
+
+	for (size_t i = 0; i < biasesNumber; i++) {
+		if (biases[i].biasAddress >= DYNAPSE_CONFIG_BIAS_NUMBER) {
+			caerLog(CAER_LOG_ERROR, handle->info.deviceString, "Invalid bias address %" PRIu8 ".",
+				biases[i].biasAddress);
+			return (false);
+		}
+	}
+
+	dynapseState state = &handle->state;
+	struct dynapse_bias_cache *cache = &state->biasCache;
+
+	uint32_t *biasBits = malloc(biasesNumber * sizeof(*biasBits));
+	if (biasBits == NULL && biasesNumber != 0) {
+		caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate memory for bias table.");
+		return (false);
+	}
+
+	// Only send what differs from the cache. The cache is updated right away,
+	// so duplicate entries in the table are also only sent once.
 	size_t numConfig = 0;
-	// Handle even and odd numbers of words to write
-	if ( numWords % 2 == 0 ) {
-		numConfig = numWords/2;
+
+	for (size_t i = 0; i < biasesNumber; i++) {
+		uint8_t addr = biases[i].biasAddress;
+
+		if (cache->valid[chipIndex][addr] && cache->biasBits[chipIndex][addr] == biases[i].biasBits) {
+			continue;
+		}
+
+		cache->biasBits[chipIndex][addr] = biases[i].biasBits;
+		cache->valid[chipIndex][addr] = true;
+
+		biasBits[numConfig++] = biases[i].biasBits;
 	}
-	else {
-		// Handle the case where we have 1 trailing word
-		// by just writing it manually
-		spiConfigSend(state->usbState.deviceHandle, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_RWCOMMAND,
-			      DYNAPSE_CONFIG_SRAM_WRITE);
-		spiConfigSend(state->usbState.deviceHandle, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_WRITEDATA, data[numWords-1]);
-		spiConfigSend(state->usbState.deviceHandle, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_ADDRESS, baseAddr+(numWords-1));
-
-		// reduce numWords to the, now even, number of remaining words.
-		// Otherwise the spiMultiConfig array filling loop will be incorrect
-		numWords--;
-
-		// return if there was only 1 word to write
-		if (numWords == 0) {
-			return true;
+
+	if (numConfig == 0) {
+		free(biasBits);
+		return (true);
+	}
+
+	// Remember current chip selection, to restore it at the end.
+	uint32_t previousChipId = 0;
+	bool success = spiConfigReceive(state->usbState.deviceHandle, DYNAPSE_CONFIG_CHIP, DYNAPSE_CONFIG_CHIP_ID,
+		&previousChipId);
+
+	bool chipChanged = false;
+
+	if (success && previousChipId != chipId) {
+		success = spiConfigSend(state->usbState.deviceHandle, DYNAPSE_CONFIG_CHIP, DYNAPSE_CONFIG_CHIP_ID, chipId);
+		chipChanged = success;
+	}
+
+	if (success) {
+		success = caerDynapseSendDataToUSBPipelined(cdh, biasBits, numConfig, 0, 0, NULL);
+	}
+
+	if (chipChanged) {
+		success = spiConfigSend(state->usbState.deviceHandle, DYNAPSE_CONFIG_CHIP, DYNAPSE_CONFIG_CHIP_ID,
+			previousChipId) && success;
+	}
+
+	free(biasBits);
+
+	if (!success) {
+		// Device state unknown for everything we tried to send.
+		for (size_t i = 0; i < biasesNumber; i++) {
+			cache->valid[chipIndex][biases[i].biasAddress] = false;
 		}
-		numConfig = numWords/2;
 
+		caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to write biases on chip %" PRIu8 ".", chipId);
+		return (false);
 	}
 
+	if (biasesSent != NULL) {
+		*biasesSent = numConfig;
+	}
 
-	// We need malloc because allocating dynamically sized arrays on the stack is not allowed.
-	uint8_t *spiMultiConfig = malloc(numConfig * 6 * sizeof(*spiMultiConfig));
+	return (true);
+}
 
+bool caerDynapseBiasCacheInvalidate(caerDeviceHandle cdh, int16_t chipId) {
+	dynapseHandle handle = (dynapseHandle) cdh;
+
+	// Check if the pointer is valid.
+	if (handle == NULL) {
+		return (false);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType != CAER_DEVICE_DYNAPSE) {
+		return (false);
+	}
+
+	struct dynapse_bias_cache *cache = &handle->state.biasCache;
+
+	if (chipId < 0) {
+		memset(cache->valid, 0, sizeof(cache->valid));
+		return (true);
+	}
+
+	int chipIndex = (chipId <= UINT8_MAX) ? (dynapseNetworkChipIndex(U8T(chipId))) : (-1);
+	if (chipIndex < 0) {
+		return (false);
+	}
+
+	memset(cache->valid[chipIndex], 0, sizeof(cache->valid[chipIndex]));
+
+	return (true);
+}
+
+static inline void dynapseSetMultiConfig(uint8_t *spiMultiConfig, size_t idx, uint8_t moduleAddr, uint8_t paramAddr,
+	uint32_t param) {
+	spiMultiConfig[(idx * 6) + 0] = moduleAddr;
+	spiMultiConfig[(idx * 6) + 1] = paramAddr;
+	spiMultiConfig[(idx * 6) + 2] = U8T((param >> 24) & 0x0FF);
+	spiMultiConfig[(idx * 6) + 3] = U8T((param >> 16) & 0x0FF);
+	spiMultiConfig[(idx * 6) + 4] = U8T((param >> 8) & 0x0FF);
+	spiMultiConfig[(idx * 6) + 5] = U8T((param >> 0) & 0x0FF);
+}
+
+bool caerDynapseWriteSramWords(caerDeviceHandle cdh, const uint16_t *data, uint32_t baseAddr, uint32_t numWords) {
+	dynapseHandle handle = (dynapseHandle) cdh;
+
+	// Check if the pointer is valid.
+	if (handle == NULL) {
+		return (false);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType != CAER_DEVICE_DYNAPSE) {
+		return (false);
+	}
+
+	if (data == NULL || numWords == 0) {
+		return (false);
+	}
+
+	dynapseState state = &handle->state;
+
+	// Burst mode writes two words per config, a trailing odd word is written
+	// normally at the end, in the same batch.
+	size_t numBurstConfig = numWords / 2;
+	bool oddWord = (numWords % 2) != 0;
+
+	// Burst: 4 setup configs, data, 1 to disable burst mode again.
+	// Odd word: write command, data and address.
+	size_t numConfig = ((numBurstConfig > 0) ? (numBurstConfig + 5) : (0)) + ((oddWord) ? (3) : (0));
+
+	// We need malloc because allocating dynamically sized arrays on the stack is not allowed.
+	uint8_t *spiMultiConfig = malloc(numConfig * USB_CONFIG_MULTIPLE_SIZE);
 	if (spiMultiConfig == NULL) {
 		caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to malloc spiMultiConfigArray");
 		return (false); // No memory allocated, don't need to free.
 	}
 
-	for (size_t i = 0; i < numConfig; i++) {
-		// Data word configuration
-		spiMultiConfig[i * 6 + 0] = DYNAPSE_CONFIG_SRAM;
-		spiMultiConfig[i * 6 + 1] = DYNAPSE_CONFIG_SRAM_WRITEDATA;
-		spiMultiConfig[i * 6 + 2] = U8T((data[i*2+1] >> 8) & 0x0FF);
-		spiMultiConfig[i * 6 + 3] = U8T((data[i*2+1] >> 0) & 0x0FF);
-		spiMultiConfig[i * 6 + 4] = U8T((data[i*2] >> 8) & 0x0FF);
-		spiMultiConfig[i * 6 + 5] = U8T((data[i*2] >> 0) & 0x0FF);
-	}
-
-	// Prepare the SRAM controller for writing
-	// First we write the base address by writing a spoof word to it
-	spiConfigSend(state->usbState.deviceHandle, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_RWCOMMAND, DYNAPSE_CONFIG_SRAM_WRITE);
-	spiConfigSend(state->usbState.deviceHandle, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_WRITEDATA, 0x0);
-	spiConfigSend(state->usbState.deviceHandle, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_ADDRESS, baseAddr);
-	// Then we enable burst mode
-	spiConfigSend(state->usbState.deviceHandle, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_BURSTMODE, 1);
+	size_t idx = 0;
+
+	if (numBurstConfig > 0) {
+		// Prepare the SRAM controller for writing
+		// First we write the base address by writing a spoof word to it
+		dynapseSetMultiConfig(spiMultiConfig, idx++, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_RWCOMMAND,
+			DYNAPSE_CONFIG_SRAM_WRITE);
+		dynapseSetMultiConfig(spiMultiConfig, idx++, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_WRITEDATA, 0x0);
+		dynapseSetMultiConfig(spiMultiConfig, idx++, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_ADDRESS, baseAddr);
+		// Then we enable burst mode
+		dynapseSetMultiConfig(spiMultiConfig, idx++, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_BURSTMODE, 1);
+
+		for (size_t i = 0; i < numBurstConfig; i++) {
+			// Data word configuration, least significant half word first.
+			dynapseSetMultiConfig(spiMultiConfig, idx++, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_WRITEDATA,
+				U32T(data[i * 2 + 1] << 16) | data[i * 2]);
+		}
 
-	size_t idxConfig = 0;
+		// Disable burst mode again or things will go wrong when accessing the SRAM in the future
+		dynapseSetMultiConfig(spiMultiConfig, idx++, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_BURSTMODE, 0);
+	}
 
-	// Start writing data
-	while (numConfig > 0) {
-		size_t configNum = (numConfig > 85) ? (85) : (numConfig);
-		size_t configSize = configNum * 6;
+	if (oddWord) {
+		dynapseSetMultiConfig(spiMultiConfig, idx++, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_RWCOMMAND,
+			DYNAPSE_CONFIG_SRAM_WRITE);
+		dynapseSetMultiConfig(spiMultiConfig, idx++, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_WRITEDATA,
+			data[numWords - 1]);
+		dynapseSetMultiConfig(spiMultiConfig, idx++, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_ADDRESS,
+			baseAddr + (numWords - 1));
+	}
 
-		int result = libusb_control_transfer(state->usbState.deviceHandle,
-			LIBUSB_ENDPOINT_OUT | LIBUSB_REQUEST_TYPE_VENDOR | LIBUSB_RECIPIENT_DEVICE,
-			VENDOR_REQUEST_FPGA_CONFIG_MULTIPLE, U16T(configNum), 0, spiMultiConfig + idxConfig, U16T(configSize), 0);
-		if (result != (int) configSize) {
-			caerLog(CAER_LOG_CRITICAL, handle->info.deviceString,
-				"Failed to send chip config, USB transfer failed with error %d.", result);
+	// Control transfers complete in order, so the whole sequence can be pipelined.
+	bool result = usbConfigMultipleSendPipelined(&state->usbState, handle->info.deviceString,
+		VENDOR_REQUEST_FPGA_CONFIG_MULTIPLE, spiMultiConfig, numConfig, 0, 0, false, NULL);
 
-			free(spiMultiConfig);
-			return (false);
-		}
+	free(spiMultiConfig);
 
-		numConfig -= configNum;
-		idxConfig += configSize;
+	if (!result) {
+		// Never leave burst mode enabled after a failure.
+		spiConfigSend(state->usbState.deviceHandle, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_BURSTMODE, 0);
 	}
 
-	// Disable burst mode again or things will go wrong when accessing the SRAM in the future
-	spiConfigSend(state->usbState.deviceHandle, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_BURSTMODE, 0);
+	return (result);
+}
 
-	free(spiMultiConfig);
+bool caerDynapseStimulusStreamStart(caerDeviceHandle cdh, uint32_t baseAddr, uint32_t halfSize) {
+	dynapseHandle handle = (dynapseHandle) cdh;
+
+	// Check if the pointer is valid.
+	if (handle == NULL) {
+		return (false);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType != CAER_DEVICE_DYNAPSE) {
+		return (false);
+	}
+
+	if (halfSize == 0) {
+		return (false);
+	}
+
+	dynapseState state = &handle->state;
+
+	// Stop any previous playback, the stream owns the spike generator from now on.
+	if (!spiConfigSend(state->usbState.deviceHandle, DYNAPSE_CONFIG_SPIKEGEN, DYNAPSE_CONFIG_SPIKEGEN_RUN, false)) {
+		return (false);
+	}
+
+	state->stimulusStream.baseAddr = baseAddr;
+	state->stimulusStream.halfSize = halfSize;
+	state->stimulusStream.nextHalf = 0;
+	state->stimulusStream.queuedStimCount = 0;
+	state->stimulusStream.queued = false;
+	state->stimulusStream.active = true;
+
+	return (true);
+}
+
+bool caerDynapseStimulusStreamQueue(caerDeviceHandle cdh, const uint16_t *data, uint32_t numWords,
+	uint32_t stimCount) {
+	dynapseHandle handle = (dynapseHandle) cdh;
+
+	// Check if the pointer is valid.
+	if (handle == NULL) {
+		return (false);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType != CAER_DEVICE_DYNAPSE) {
+		return (false);
+	}
+
+	dynapseState state = &handle->state;
+
+	if (!state->stimulusStream.active) {
+		caerLog(CAER_LOG_ERROR, handle->info.deviceString, "Stimulus stream: not started.");
+		return (false);
+	}
+
+	if (state->stimulusStream.queued) {
+		caerLog(CAER_LOG_ERROR, handle->info.deviceString,
+			"Stimulus stream: a segment is already queued, swap before queuing the next one.");
+		return (false);
+	}
+
+	if (numWords > state->stimulusStream.halfSize) {
+		caerLog(CAER_LOG_ERROR, handle->info.deviceString,
+			"Stimulus stream: segment of %" PRIu32 " words doesn't fit into half of %" PRIu32 " words.", numWords,
+			state->stimulusStream.halfSize);
+		return (false);
+	}
+
+	// The other half may be playing right now, we only ever write into the idle one.
+	uint32_t halfAddr = state->stimulusStream.baseAddr
+		+ (state->stimulusStream.nextHalf * state->stimulusStream.halfSize);
+
+	if (!caerDynapseWriteSramWords(cdh, data, halfAddr, numWords)) {
+		return (false);
+	}
+
+	state->stimulusStream.queuedStimCount = stimCount;
+	state->stimulusStream.queued = true;
+
+	return (true);
+}
+
+bool caerDynapseStimulusStreamSwap(caerDeviceHandle cdh) {
+	dynapseHandle handle = (dynapseHandle) cdh;
+
+	// Check if the pointer is valid.
+	if (handle == NULL) {
+		return (false);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType != CAER_DEVICE_DYNAPSE) {
+		return (false);
+	}
+
+	dynapseState state = &handle->state;
+
+	if (!state->stimulusStream.active || !state->stimulusStream.queued) {
+		caerLog(CAER_LOG_ERROR, handle->info.deviceString, "Stimulus stream: no segment queued.");
+		return (false);
+	}
+
+	uint32_t halfAddr = state->stimulusStream.baseAddr
+		+ (state->stimulusStream.nextHalf * state->stimulusStream.halfSize);
+
+	// Restart the spike generator on the queued half with a single USB transfer,
+	// to keep the gap between segments as short as possible.
+	uint8_t spiMultiConfig[4 * 6] = { 0 };
+
+	dynapseSetMultiConfig(spiMultiConfig, 0, DYNAPSE_CONFIG_SPIKEGEN, DYNAPSE_CONFIG_SPIKEGEN_RUN, false);
+	dynapseSetMultiConfig(spiMultiConfig, 1, DYNAPSE_CONFIG_SPIKEGEN, DYNAPSE_CONFIG_SPIKEGEN_BASEADDR, halfAddr);
+	dynapseSetMultiConfig(spiMultiConfig, 2, DYNAPSE_CONFIG_SPIKEGEN, DYNAPSE_CONFIG_SPIKEGEN_STIMCOUNT,
+		state->stimulusStream.queuedStimCount);
+	dynapseSetMultiConfig(spiMultiConfig, 3, DYNAPSE_CONFIG_SPIKEGEN, DYNAPSE_CONFIG_SPIKEGEN_RUN, true);
+
+	int result = libusb_control_transfer(state->usbState.deviceHandle,
+		LIBUSB_ENDPOINT_OUT | LIBUSB_REQUEST_TYPE_VENDOR | LIBUSB_RECIPIENT_DEVICE, VENDOR_REQUEST_FPGA_CONFIG_MULTIPLE,
+		4, 0, spiMultiConfig, sizeof(spiMultiConfig), 0);
+	if (result != sizeof(spiMultiConfig)) {
+		caerLog(CAER_LOG_CRITICAL, handle->info.deviceString,
+			"Failed to swap stimulus segment, USB transfer failed with error %d.", result);
+		return (false);
+	}
+
+	state->stimulusStream.nextHalf ^= 1;
+	state->stimulusStream.queued = false;
+
+	return (true);
+}
+
+bool caerDynapseStimulusStreamStop(caerDeviceHandle cdh) {
+	dynapseHandle handle = (dynapseHandle) cdh;
+
+	// Check if the pointer is valid.
+	if (handle == NULL) {
+		return (false);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType != CAER_DEVICE_DYNAPSE) {
+		return (false);
+	}
+
+	dynapseState state = &handle->state;
+
+	state->stimulusStream.active = false;
+	state->stimulusStream.queued = false;
+
+	return (spiConfigSend(state->usbState.deviceHandle, DYNAPSE_CONFIG_SPIKEGEN, DYNAPSE_CONFIG_SPIKEGEN_RUN, false));
+}
+
+bool caerDynapseSpikeCountersGet(caerDeviceHandle cdh, uint32_t *counters, int64_t *timestamp) {
+	dynapseHandle handle = (dynapseHandle) cdh;
+
+	// Check if the pointer is valid.
+	if (handle == NULL) {
+		return (false);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType != CAER_DEVICE_DYNAPSE) {
+		return (false);
+	}
+
+	if (counters == NULL) {
+		return (false);
+	}
+
+	struct dynapse_spike_counters_snapshot *snapshot = &handle->state.spikeCountersSnapshot;
+	uint_fast32_t sequenceStart = 0, sequenceEnd = 0;
+	int64_t snapshotTimestamp = 0;
+
+	// Retry until we get a copy that was not being updated while we read it.
+	do {
+		sequenceStart = atomic_load_explicit(&snapshot->sequence, memory_order_acquire);
+		if ((sequenceStart & 0x01) != 0) {
+			continue;
+		}
+
+		for (size_t i = 0; i < DYNAPSE_SPIKE_COUNTERS_NUMBER; i++) {
+			counters[i] = U32T(atomic_load_explicit(&snapshot->counters[i], memory_order_relaxed));
+		}
+
+		snapshotTimestamp = atomic_load_explicit(&snapshot->timestamp, memory_order_relaxed);
+
+		atomic_thread_fence(memory_order_acquire);
+		sequenceEnd = atomic_load_explicit(&snapshot->sequence, memory_order_relaxed);
+	}
+	while ((sequenceStart & 0x01) != 0 || sequenceStart != sequenceEnd);
+
+	if (timestamp != NULL) {
+		*timestamp = snapshotTimestamp;
+	}
 
 	return (true);
 }
@@ -1894,8 +2676,8 @@ bool caerDynapseWriteSram(caerDeviceHandle cdh, uint16_t coreId, uint32_t neuron
 		return (false);
 	}
 
-	uint32_t bits = neuronId << 7| U32T(sramId << 5) | U32T(coreId << 15) | 1 << 17 | 1 << 4 | U32T(destinationCore << 18)
-		| U32T(sy << 27) | U32T(dy << 25) | U32T(dx << 22) | U32T(sx << 24) | U32T(virtualCoreId << 28);
+	uint32_t bits = dynapseGenerateSramAddressBits(coreId, neuronId, sramId)
+		| dynapseGenerateSramContentBits(virtualCoreId, sx, dx, sy, dy, destinationCore);
 
 	if (caerDeviceConfigSet(cdh, DYNAPSE_CONFIG_CHIP, DYNAPSE_CONFIG_CHIP_CONTENT, bits) == false) {
 		return (false);
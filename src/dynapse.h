@@ -4,6 +4,10 @@
 #include "devices/dynapse.h"
 #include "ringbuffer/ringbuffer.h"
 #include "usb_utils.h"
+#include "watermark.h"
+#include "shedding.h"
+#include "clock_correlation.h"
+#include "dynapse_network.h"
 #include <stdatomic.h>
 
 #if defined(HAVE_PTHREADS)
@@ -21,16 +25,47 @@
 #define VENDOR_REQUEST_FPGA_CONFIG_AER_MULTIPLE 0xC6
 
 #define DYNAPSE_EVENT_TYPES 2
-#define DYNAPSE_SPIKE_EVENT_POS 1
+
+// One spike packet per chip and core at most (DYNAPSE_SPIKES_SPLIT_CORE).
+#define DYNAPSE_SPIKE_PACKETS_MAX (DYNAPSE_CONFIG_NUMCHIPS * DYNAPSE_CONFIG_NUMCORES)
+
+// Packet container positions, with the spike packets split at most.
+#define DYNAPSE_CONTAINER_PACKETS_MAX (DYNAPSE_SPIKE_EVENT_POS + DYNAPSE_SPIKE_PACKETS_MAX)
 
 #define DYNAPSE_SPIKE_DEFAULT_SIZE 4096
 #define DYNAPSE_SPECIAL_DEFAULT_SIZE 128
 
+struct dynapse_stimulus_stream {
+	bool active;
+	uint32_t baseAddr;
+	uint32_t halfSize;
+	// Half the next segment is written into (the other may be playing).
+	uint32_t nextHalf;
+	bool queued;
+	uint32_t queuedStimCount;
+};
+
+// Published spike counters, protected by a sequence lock: the data acquisition
+// thread is the only writer, and never waits on readers.
+struct dynapse_spike_counters_snapshot {
+	atomic_uint_fast32_t sequence;
+	atomic_int_fast64_t timestamp;
+	atomic_uint_least32_t counters[DYNAPSE_SPIKE_COUNTERS_NUMBER];
+};
+
+// Last bias values written by caerDynapseWriteBiases(), per chip.
+struct dynapse_bias_cache {
+	uint32_t biasBits[DYNAPSE_CONFIG_NUMCHIPS][DYNAPSE_CONFIG_BIAS_NUMBER];
+	bool valid[DYNAPSE_CONFIG_NUMCHIPS][DYNAPSE_CONFIG_BIAS_NUMBER];
+};
+
 struct dynapse_state {
 	// Data Acquisition Thread -> Mainloop Exchange
 	RingBuffer dataExchangeBuffer;
 	atomic_uint_fast32_t dataExchangeBufferSize; // Only takes effect on DataStart() calls!
 	atomic_bool dataExchangeBlocking;
+	struct watermark_state dataExchangeWatermark;
+	atomic_uint_fast8_t dataExchangeSheddingLevel[DYNAPSE_CONTAINER_PACKETS_MAX];
 	atomic_bool dataExchangeStartProducers;
 	atomic_bool dataExchangeStopProducers;
 	void (*dataNotifyIncrease)(void *ptr);
@@ -46,6 +81,10 @@ struct dynapse_state {
 	atomic_uint_fast32_t usbBufferSize;
 	// Data Acquisition Thread
 	thrd_t dataAcquisitionThread;
+	atomic_uint_fast32_t dataAcquisitionThreadCpuAffinity; // Only takes effect on DataStart() calls!
+	atomic_uint_fast32_t dataAcquisitionThreadSchedPolicy; // Only takes effect on DataStart() calls!
+	atomic_uint_fast32_t dataAcquisitionThreadSchedPriority; // Only takes effect on DataStart() calls!
+	atomic_bool dataAcquisitionThreadMemoryLock; // Only takes effect on DataStart() calls!
 	atomic_bool dataAcquisitionThreadRun;
 	atomic_uint_fast32_t dataAcquisitionThreadConfigUpdate;
 	// Timestamp fields
@@ -53,17 +92,33 @@ struct dynapse_state {
 	int32_t wrapAdd;
 	int32_t lastTimestamp;
 	int32_t currentTimestamp;
+	// Device to host clock correlation
+	struct clock_correlation clockCorrelation;
 	// Packet Container state
 	caerEventPacketContainer currentPacketContainer;
 	atomic_uint_fast32_t maxPacketContainerPacketSize;
 	atomic_uint_fast32_t maxPacketContainerInterval;
 	int64_t currentPacketContainerCommitTimestamp;
 	// Spike Packet state
-	caerSpikeEventPacket currentSpikePacket;
-	int32_t currentSpikePacketPosition;
+	caerSpikeEventPacket currentSpikePacket[DYNAPSE_SPIKE_PACKETS_MAX];
+	int32_t currentSpikePacketPosition[DYNAPSE_SPIKE_PACKETS_MAX];
+	atomic_uint_fast32_t spikePacketSplit; // Only takes effect on DataStart() calls!
+	uint32_t currentSpikePacketSplit;
+	size_t currentSpikePacketsNumber;
+	// Spike counters state
+	atomic_bool spikeCountersEnabled;
+	atomic_bool spikeCountersReset;
+	uint32_t spikeCounters[DYNAPSE_SPIKE_COUNTERS_NUMBER];
+	struct dynapse_spike_counters_snapshot spikeCountersSnapshot;
 	// Special Packet state
 	caerSpecialEventPacket currentSpecialPacket;
 	int32_t currentSpecialPacketPosition;
+	// Network compiler state
+	struct dynapse_network_image networkImage;
+	// Spike generator stimulus streaming state
+	struct dynapse_stimulus_stream stimulusStream;
+	// Bias cache state
+	struct dynapse_bias_cache biasCache;
 };
 
 typedef struct dynapse_state *dynapseState;
@@ -93,5 +148,11 @@ bool dynapseDataStart(caerDeviceHandle handle, void (*dataNotifyIncrease)(void *
 	void *dataShutdownUserPtr);
 bool dynapseDataStop(caerDeviceHandle handle);
 caerEventPacketContainer dynapseDataGet(caerDeviceHandle handle);
+size_t dynapseDataGetBatch(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t maxContainers);
+int64_t dynapseTimestampToHost(caerDeviceHandle handle, int64_t deviceTimestamp);
+bool dynapseProfilingGet(caerDeviceHandle handle, struct caer_device_profiling_stage *stages);
+bool dynapseMemoryUsageGet(caerDeviceHandle handle, struct caer_device_memory_usage *usages);
+bool dynapseDataWatermarkNotifySet(caerDeviceHandle handle, void (*dataWatermarkNotify)(void *ptr, bool high),
+	void *dataWatermarkUserPtr);
 
 #endif /* LIBCAER_SRC_DYNAPSE_H_ */
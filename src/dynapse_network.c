@@ -0,0 +1,308 @@
+#include "dynapse.h"
+
+// Worst case for one chip: full CAM clear, every CAM entry and every SRAM entry.
+#define DYNAPSE_NETWORK_MAX_CONFIGS_PER_CHIP \
+	((DYNAPSE_CONFIG_NUMCORES * DYNAPSE_CONFIG_NUMNEURONS) + (DYNAPSE_CONFIG_NUMNEURONS * DYNAPSE_CONFIG_NUMCAM) \
+		+ (DYNAPSE_CONFIG_NUMNEURONS * DYNAPSE_CONFIG_NUMSRAM_NEU))
+
+static const uint8_t dynapseNetworkChipIds[DYNAPSE_NETWORK_CHIPS] = { DYNAPSE_CONFIG_DYNAPSE_U0,
+	DYNAPSE_CONFIG_DYNAPSE_U1, DYNAPSE_CONFIG_DYNAPSE_U2, DYNAPSE_CONFIG_DYNAPSE_U3 };
+
+static size_t dynapseNetworkCompileChip(dynapseNetworkImage image, caerDynapseNetwork network, size_t chipIndex,
+	uint32_t *configs);
+
+int dynapseNetworkChipIndex(uint8_t chipId) {
+	for (size_t i = 0; i < DYNAPSE_NETWORK_CHIPS; i++) {
+		if (dynapseNetworkChipIds[i] == chipId) {
+			return ((int) i);
+		}
+	}
+
+	return (-1);
+}
+
+void dynapseNetworkImageInvalidate(dynapseNetworkImage image, int chipIndex, bool cam, bool sram) {
+	for (size_t i = 0; i < DYNAPSE_NETWORK_CHIPS; i++) {
+		if (chipIndex >= 0 && (size_t) chipIndex != i) {
+			continue;
+		}
+
+		if (cam) {
+			image->camValid[i] = false;
+		}
+
+		if (sram) {
+			image->sramValid[i] = false;
+		}
+	}
+}
+
+void dynapseNetworkImageFree(dynapseNetworkImage image) {
+	free(image->programmed);
+	image->programmed = NULL;
+
+	dynapseNetworkImageInvalidate(image, -1, true, true);
+}
+
+uint32_t dynapseGenerateSramAddressBits(uint16_t coreId, uint32_t neuronId, uint16_t sramId) {
+	return (neuronId << 7 | U32T(sramId << 5) | U32T(coreId << 15) | 1 << 17 | 1 << 4);
+}
+
+uint32_t dynapseGenerateSramContentBits(uint16_t virtualCoreId, bool sx, uint8_t dx, bool sy, uint8_t dy,
+	uint16_t destinationCore) {
+	return (U32T(destinationCore << 18) | U32T(sy << 27) | U32T(dy << 25) | U32T(dx << 22) | U32T(sx << 24)
+		| U32T(virtualCoreId << 28));
+}
+
+caerDynapseNetwork caerDynapseNetworkAllocate(void) {
+	caerDynapseNetwork network = calloc(1, sizeof(*network));
+	if (network == NULL) {
+		caerLog(CAER_LOG_CRITICAL, "Dynap-se Network", "Failed to allocate memory for network description.");
+		return (NULL);
+	}
+
+	return (network);
+}
+
+void caerDynapseNetworkFree(caerDynapseNetwork network) {
+	free(network);
+}
+
+void caerDynapseNetworkClear(caerDynapseNetwork network) {
+	if (network == NULL) {
+		return;
+	}
+
+	memset(network, 0, sizeof(*network));
+}
+
+bool caerDynapseNetworkSetSynapse(caerDynapseNetwork network, uint8_t chipId, uint32_t preNeuronAddr,
+	uint32_t postNeuronAddr, uint32_t camId, int16_t synapseType) {
+	int chipIndex = dynapseNetworkChipIndex(chipId);
+
+	if (network == NULL || chipIndex < 0 || preNeuronAddr >= DYNAPSE_CONFIG_NUMNEURONS
+		|| postNeuronAddr >= DYNAPSE_CONFIG_NUMNEURONS || camId >= DYNAPSE_CONFIG_NUMCAM || synapseType < 0
+		|| synapseType > DYNAPSE_NETWORK_CAM_TYPE_MASK) {
+		return (false);
+	}
+
+	network->cam[chipIndex][postNeuronAddr][camId] = U16T(
+		preNeuronAddr | U32T(synapseType << DYNAPSE_NETWORK_CAM_TYPE_SHIFT));
+
+	return (true);
+}
+
+bool caerDynapseNetworkClearSynapse(caerDynapseNetwork network, uint8_t chipId, uint32_t postNeuronAddr,
+	uint32_t camId) {
+	int chipIndex = dynapseNetworkChipIndex(chipId);
+
+	if (network == NULL || chipIndex < 0 || postNeuronAddr >= DYNAPSE_CONFIG_NUMNEURONS
+		|| camId >= DYNAPSE_CONFIG_NUMCAM) {
+		return (false);
+	}
+
+	network->cam[chipIndex][postNeuronAddr][camId] = 0;
+
+	return (true);
+}
+
+bool caerDynapseNetworkSetRoute(caerDynapseNetwork network, uint8_t chipId, uint32_t neuronAddr, uint16_t sramId,
+	uint16_t virtualCoreId, bool sx, uint8_t dx, bool sy, uint8_t dy, uint16_t destinationCore) {
+	int chipIndex = dynapseNetworkChipIndex(chipId);
+
+	if (network == NULL || chipIndex < 0 || neuronAddr >= DYNAPSE_CONFIG_NUMNEURONS
+		|| sramId >= DYNAPSE_CONFIG_NUMSRAM_NEU) {
+		return (false);
+	}
+
+	network->sram[chipIndex][neuronAddr][sramId] = dynapseGenerateSramContentBits(virtualCoreId, sx, dx, sy, dy,
+		destinationCore);
+
+	return (true);
+}
+
+bool caerDynapseNetworkClearRoute(caerDynapseNetwork network, uint8_t chipId, uint32_t neuronAddr, uint16_t sramId) {
+	int chipIndex = dynapseNetworkChipIndex(chipId);
+
+	if (network == NULL || chipIndex < 0 || neuronAddr >= DYNAPSE_CONFIG_NUMNEURONS
+		|| sramId >= DYNAPSE_CONFIG_NUMSRAM_NEU) {
+		return (false);
+	}
+
+	network->sram[chipIndex][neuronAddr][sramId] = 0;
+
+	return (true);
+}
+
+static size_t dynapseNetworkCompileChip(dynapseNetworkImage image, caerDynapseNetwork network, size_t chipIndex,
+	uint32_t *configs) {
+	caerDynapseNetwork programmed = image->programmed;
+	size_t numConfig = 0;
+
+	if (!image->camValid[chipIndex]) {
+		// Unknown CAM content: clear everything first (like DYNAPSE_CONFIG_CLEAR_CAM),
+		// then only the non-cleared entries have to be sent.
+		for (uint32_t core = 0; core < DYNAPSE_CONFIG_NUMCORES; core++) {
+			for (uint32_t row = 0; row < DYNAPSE_CONFIG_NUMNEURONS; row++) {
+				configs[numConfig++] = U32T(row << 5 | core << 15 | 1 << 17);
+			}
+		}
+
+		memset(programmed->cam[chipIndex], 0, sizeof(programmed->cam[chipIndex]));
+	}
+
+	for (uint32_t post = 0; post < DYNAPSE_CONFIG_NUMNEURONS; post++) {
+		for (uint32_t camId = 0; camId < DYNAPSE_CONFIG_NUMCAM; camId++) {
+			uint16_t cam = network->cam[chipIndex][post][camId];
+
+			if (cam == programmed->cam[chipIndex][post][camId]) {
+				continue;
+			}
+
+			configs[numConfig++] = caerDynapseGenerateCamBits(cam & DYNAPSE_NETWORK_CAM_PRE_MASK, post, camId,
+				I16T((cam >> DYNAPSE_NETWORK_CAM_TYPE_SHIFT) & DYNAPSE_NETWORK_CAM_TYPE_MASK));
+		}
+	}
+
+	for (uint32_t neuron = 0; neuron < DYNAPSE_CONFIG_NUMNEURONS; neuron++) {
+		for (uint16_t sramId = 0; sramId < DYNAPSE_CONFIG_NUMSRAM_NEU; sramId++) {
+			uint32_t sram = network->sram[chipIndex][neuron][sramId];
+
+			// Unknown SRAM content: every entry has to be sent, there is no cheaper way to clear.
+			if (image->sramValid[chipIndex] && sram == programmed->sram[chipIndex][neuron][sramId]) {
+				continue;
+			}
+
+			configs[numConfig++] = dynapseGenerateSramAddressBits(U16T(neuron >> 8), neuron & 0xFF, sramId) | sram;
+		}
+	}
+
+	return (numConfig);
+}
+
+bool caerDynapseNetworkApply(caerDeviceHandle cdh, caerDynapseNetwork network, size_t *configsSent) {
+	dynapseHandle handle = (dynapseHandle) cdh;
+
+	if (configsSent != NULL) {
+		*configsSent = 0;
+	}
+
+	// Check if the pointer is valid.
+	if (handle == NULL) {
+		return (false);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType != CAER_DEVICE_DYNAPSE) {
+		return (false);
+	}
+
+	if (network == NULL) {
+		return (false);
+	}
+
+	dynapseState state = &handle->state;
+	dynapseNetworkImage image = &state->networkImage;
+
+	if (image->programmed == NULL) {
+		image->programmed = calloc(1, sizeof(*image->programmed));
+		if (image->programmed == NULL) {
+			caerLog(CAER_LOG_CRITICAL, handle->info.deviceString,
+				"Failed to allocate memory for network programming image.");
+			return (false);
+		}
+
+		// Nothing is known about the device content yet.
+		dynapseNetworkImageInvalidate(image, -1, true, true);
+	}
+
+	uint32_t *configs = malloc(DYNAPSE_NETWORK_MAX_CONFIGS_PER_CHIP * sizeof(*configs));
+	if (configs == NULL) {
+		caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate memory for network configuration.");
+		return (false);
+	}
+
+	// Remember current chip selection, to restore it at the end.
+	uint32_t previousChipId = 0;
+	if (!spiConfigReceive(state->usbState.deviceHandle, DYNAPSE_CONFIG_CHIP, DYNAPSE_CONFIG_CHIP_ID,
+		&previousChipId)) {
+		free(configs);
+		return (false);
+	}
+
+	bool success = true;
+	bool chipChanged = false;
+
+	for (size_t chipIndex = 0; chipIndex < DYNAPSE_NETWORK_CHIPS; chipIndex++) {
+		size_t numConfig = dynapseNetworkCompileChip(image, network, chipIndex, configs);
+
+		if (numConfig == 0) {
+			// Nothing changed on this chip.
+			continue;
+		}
+
+		// Until the transfer has fully succeeded, the chip content is uncertain.
+		dynapseNetworkImageInvalidate(image, (int) chipIndex, true, true);
+
+		chipChanged = true;
+
+		if (!spiConfigSend(state->usbState.deviceHandle, DYNAPSE_CONFIG_CHIP, DYNAPSE_CONFIG_CHIP_ID,
+			dynapseNetworkChipIds[chipIndex])
+			|| !caerDynapseSendDataToUSBPipelined(cdh, configs, numConfig, 0, 0, NULL)) {
+			caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to program network on chip %" PRIu8 ".",
+				dynapseNetworkChipIds[chipIndex]);
+
+			success = false;
+			break;
+		}
+
+		memcpy(image->programmed->cam[chipIndex], network->cam[chipIndex], sizeof(network->cam[chipIndex]));
+		memcpy(image->programmed->sram[chipIndex], network->sram[chipIndex], sizeof(network->sram[chipIndex]));
+
+		image->camValid[chipIndex] = true;
+		image->sramValid[chipIndex] = true;
+
+		if (configsSent != NULL) {
+			*configsSent += numConfig;
+		}
+
+		caerLog(CAER_LOG_DEBUG, handle->info.deviceString, "Programmed network on chip %" PRIu8 " with %zu configs.",
+			dynapseNetworkChipIds[chipIndex], numConfig);
+	}
+
+	free(configs);
+
+	if (chipChanged
+		&& !spiConfigSend(state->usbState.deviceHandle, DYNAPSE_CONFIG_CHIP, DYNAPSE_CONFIG_CHIP_ID, previousChipId)) {
+		return (false);
+	}
+
+	return (success);
+}
+
+bool caerDynapseNetworkInvalidate(caerDeviceHandle cdh, int16_t chipId) {
+	dynapseHandle handle = (dynapseHandle) cdh;
+
+	// Check if the pointer is valid.
+	if (handle == NULL) {
+		return (false);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType != CAER_DEVICE_DYNAPSE) {
+		return (false);
+	}
+
+	int chipIndex = -1;
+
+	if (chipId >= 0) {
+		chipIndex = (chipId <= UINT8_MAX) ? (dynapseNetworkChipIndex(U8T(chipId))) : (-1);
+		if (chipIndex < 0) {
+			return (false);
+		}
+	}
+
+	dynapseNetworkImageInvalidate(&handle->state.networkImage, chipIndex, true, true);
+
+	return (true);
+}
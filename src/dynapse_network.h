@@ -0,0 +1,44 @@
+#ifndef LIBCAER_SRC_DYNAPSE_NETWORK_H_
+#define LIBCAER_SRC_DYNAPSE_NETWORK_H_
+
+#include "libcaer.h"
+#include "devices/dynapse.h"
+
+#define DYNAPSE_NETWORK_CHIPS 4
+
+// CAM image entries: pre-synaptic neuron address (10 bits) and synapse type (2 bits).
+// Zero is the content of a cleared CAM (see DYNAPSE_CONFIG_CLEAR_CAM).
+#define DYNAPSE_NETWORK_CAM_PRE_MASK 0x03FF
+#define DYNAPSE_NETWORK_CAM_TYPE_SHIFT 10
+#define DYNAPSE_NETWORK_CAM_TYPE_MASK 0x03
+
+// SRAM image entries: routing content bits as sent to the chip, without the address part.
+// Zero is the content of an empty SRAM (see DYNAPSE_CONFIG_DEFAULT_SRAM_EMPTY).
+
+struct caer_dynapse_network {
+	uint16_t cam[DYNAPSE_NETWORK_CHIPS][DYNAPSE_CONFIG_NUMNEURONS][DYNAPSE_CONFIG_NUMCAM];
+	uint32_t sram[DYNAPSE_NETWORK_CHIPS][DYNAPSE_CONFIG_NUMNEURONS][DYNAPSE_CONFIG_NUMSRAM_NEU];
+};
+
+// Host-side image of what is currently programmed on the device.
+struct dynapse_network_image {
+	// Allocated on first use only, NULL before.
+	struct caer_dynapse_network *programmed;
+	// Whether the content of 'programmed' is known to match the device.
+	bool camValid[DYNAPSE_NETWORK_CHIPS];
+	bool sramValid[DYNAPSE_NETWORK_CHIPS];
+};
+
+typedef struct dynapse_network_image *dynapseNetworkImage;
+
+// Returns the network index (0-3) for a chip ID (DYNAPSE_CONFIG_DYNAPSE_U*), or -1 if invalid.
+int dynapseNetworkChipIndex(uint8_t chipId);
+// Pass a negative chip index to invalidate all chips.
+void dynapseNetworkImageInvalidate(dynapseNetworkImage image, int chipIndex, bool cam, bool sram);
+void dynapseNetworkImageFree(dynapseNetworkImage image);
+
+uint32_t dynapseGenerateSramAddressBits(uint16_t coreId, uint32_t neuronId, uint16_t sramId);
+uint32_t dynapseGenerateSramContentBits(uint16_t virtualCoreId, bool sx, uint8_t dx, bool sy, uint8_t dy,
+	uint16_t destinationCore);
+
+#endif /* LIBCAER_SRC_DYNAPSE_NETWORK_H_ */
@@ -12,6 +12,7 @@
 #include "events/point3d.h"
 #include "events/point4d.h"
 #include "events/spike.h"
+#include "events/pcm.h"
 
 caerEventPacketContainer caerEventPacketContainerAllocate(int32_t eventPacketsNumber) {
 	if (eventPacketsNumber <= 0) {
@@ -34,6 +35,7 @@ caerEventPacketContainer caerEventPacketContainerAllocate(int32_t eventPacketsNu
 	packetContainer->eventPacketsNumber = eventPacketsNumber;
 	packetContainer->lowestEventTimestamp = -1;
 	packetContainer->highestEventTimestamp = -1;
+	packetContainer->hostTimestamp = -1;
 
 	return (packetContainer);
 }
@@ -436,3 +438,35 @@ caerSpikeEventPacket caerSpikeEventPacketAllocate(int32_t eventCapacity, int16_t
 
 	return (packet);
 }
+
+caerPCMEventPacket caerPCMEventPacketAllocate(int32_t eventCapacity, int16_t eventSource, int32_t tsOverflow,
+	int32_t maxSampleNumber) {
+	if (eventCapacity <= 0 || eventSource < 0 || tsOverflow < 0 || maxSampleNumber <= 0) {
+		return (NULL);
+	}
+
+	size_t samplesSize = sizeof(int32_t) * (size_t) maxSampleNumber;
+	// '- sizeof(int32_t)' to compensate for samples[1] at end of struct for C++ compatibility.
+	size_t eventSize = (sizeof(struct caer_pcm_event) - sizeof(int32_t)) + samplesSize;
+	size_t eventPacketSize = sizeof(struct caer_pcm_event_packet) + ((size_t) eventCapacity * eventSize);
+
+	// Zero out event memory (all events invalid).
+	caerPCMEventPacket packet = calloc(1, eventPacketSize);
+	if (packet == NULL) {
+		caerLog(CAER_LOG_CRITICAL, "PCM Event",
+			"Failed to allocate %zu bytes of memory for PCM Event Packet of capacity %"
+			PRIi32 " from source %" PRIi16 ". Error: %d.", eventPacketSize, eventCapacity, eventSource,
+			errno);
+		return (NULL);
+	}
+
+	// Fill in header fields.
+	caerEventPacketHeaderSetEventType(&packet->packetHeader, PCM_EVENT);
+	caerEventPacketHeaderSetEventSource(&packet->packetHeader, eventSource);
+	caerEventPacketHeaderSetEventSize(&packet->packetHeader, I32T(eventSize));
+	caerEventPacketHeaderSetEventTSOffset(&packet->packetHeader, offsetof(struct caer_pcm_event, timestamp));
+	caerEventPacketHeaderSetEventTSOverflow(&packet->packetHeader, tsOverflow);
+	caerEventPacketHeaderSetEventCapacity(&packet->packetHeader, eventCapacity);
+
+	return (packet);
+}
@@ -0,0 +1,663 @@
+#include "flight_recorder.h"
+#include <stdatomic.h>
+
+#if defined(HAVE_PTHREADS)
+	#include "c11threads_posix.h"
+#endif
+
+#if defined(OS_UNIX)
+	#include <sys/mman.h>
+#endif
+
+#define FLIGHT_RECORDER_THREAD_NAME "Flight Recorder"
+
+// Records start at multiples of this, so their headers are aligned.
+#define FLIGHT_RECORDER_RECORD_ALIGNMENT 8
+
+// How long the writer thread sleeps when there is nothing to write (ns).
+#define FLIGHT_RECORDER_WRITER_SLEEP 1000000
+
+enum flight_recorder_dump_state {
+	FLIGHT_RECORDER_IDLE,
+	// Post-trigger window still open, more data can become part of the recording.
+	FLIGHT_RECORDER_COLLECTING,
+	// All data of the recording is known, only writing it out remains.
+	FLIGHT_RECORDER_FLUSHING,
+};
+
+// Header of each stored container, followed by its packets back-to-back,
+// each with its events (capacity reduced to the number of events).
+struct flight_recorder_record {
+	uint64_t sequence;
+	int64_t lowestTimestamp;
+	int64_t highestTimestamp;
+	// Counts timestamp resets, timestamps are only comparable inside one epoch.
+	uint32_t epoch;
+	// Bytes of packet data following the header.
+	uint32_t dataSize;
+	// Bytes taken by the whole record in storage, header and padding included.
+	uint32_t recordSize;
+};
+
+struct caer_flight_recorder {
+	// Circular storage, holding records back-to-back from head to tail. When
+	// a record doesn't fit before the end, storage wraps around to the start,
+	// and the records before the wrap-around end at wrapEnd.
+	uint8_t *storage;
+	size_t storageSize;
+	bool storageMapped;
+	size_t head;
+	size_t tail;
+	size_t wrapEnd;
+	bool wrapped;
+	size_t recordsNumber;
+	uint64_t nextSequence;
+	// Trigger settings.
+	int64_t preTrigger;
+	int64_t postTrigger;
+	uint64_t triggerTypes;
+	char *filePrefix;
+	// Time of the latest stored data.
+	uint32_t currentEpoch;
+	int64_t lastTimestamp;
+	// Recording in progress: next record to write out, and where it ends.
+	enum flight_recorder_dump_state dumpState;
+	uint32_t dumpEpoch;
+	int64_t dumpEnd;
+	uint64_t dumpSequence;
+	size_t dumpPosition;
+	uint64_t dumpEndSequence;
+	// Trigger that came in while the previous recording was being flushed.
+	bool triggerPending;
+	int64_t pendingTimestamp;
+	uint32_t pendingEpoch;
+	// Statistics.
+	uint32_t recordingsNumber;
+	uint64_t droppedContainers;
+	// Protects all of the above, shared with the writer thread.
+	mtx_t lock;
+	thrd_t writerThread;
+	atomic_bool writerRun;
+};
+
+static const char *flightRecorderString = "Flight Recorder";
+
+static void flightRecorderMemoryFree(caerFlightRecorder recorder);
+static bool flightRecorderSpaceGet(caerFlightRecorder recorder, uint32_t recordSize, size_t *position);
+static bool flightRecorderIsPinned(caerFlightRecorder recorder, uint64_t sequence);
+static size_t flightRecorderNextPosition(caerFlightRecorder recorder, size_t position, uint32_t recordSize);
+static void flightRecorderTriggerLocked(caerFlightRecorder recorder, int64_t timestamp, uint32_t epoch);
+static void flightRecorderRecordingStart(caerFlightRecorder recorder, int64_t timestamp, uint32_t epoch);
+static FILE *flightRecorderFileOpen(const char *filePrefix, uint32_t fileNumber, const uint8_t *data);
+static int flightRecorderWriterThread(void *inPtr);
+
+caerFlightRecorder caerFlightRecorderCreate(size_t memorySize, int64_t preTrigger, int64_t postTrigger,
+	const char *filePrefix) {
+	// Record sizes are stored as 32 bit integers.
+	if (memorySize <= sizeof(struct flight_recorder_record) || memorySize > UINT32_MAX || preTrigger < 0
+		|| postTrigger < 0 || filePrefix == NULL) {
+		caerLog(CAER_LOG_ERROR, flightRecorderString, "Invalid arguments passed to flight recorder creation.");
+		return (NULL);
+	}
+
+	caerFlightRecorder recorder = calloc(1, sizeof(*recorder));
+	if (recorder == NULL) {
+		caerLog(CAER_LOG_CRITICAL, flightRecorderString, "Failed to allocate flight recorder memory.");
+		return (NULL);
+	}
+
+	recorder->storageSize = memorySize;
+	recorder->preTrigger = preTrigger;
+	recorder->postTrigger = postTrigger;
+	recorder->triggerTypes = CAER_FLIGHT_RECORDER_DEFAULT_TRIGGER_TYPES;
+	recorder->dumpState = FLIGHT_RECORDER_IDLE;
+
+	recorder->filePrefix = malloc(strlen(filePrefix) + 1);
+	if (recorder->filePrefix == NULL) {
+		flightRecorderMemoryFree(recorder);
+
+		caerLog(CAER_LOG_CRITICAL, flightRecorderString, "Failed to allocate file prefix memory.");
+		return (NULL);
+	}
+
+	strcpy(recorder->filePrefix, filePrefix);
+
+#if defined(OS_UNIX)
+	// Anonymous memory mappings only take up physical memory once they are
+	// written to, so big regions are cheap until they actually fill up.
+	void *storage = mmap(NULL, memorySize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (storage != MAP_FAILED) {
+		recorder->storage = storage;
+		recorder->storageMapped = true;
+	}
+#else
+	recorder->storage = malloc(memorySize);
+#endif
+
+	if (recorder->storage == NULL) {
+		flightRecorderMemoryFree(recorder);
+
+		caerLog(CAER_LOG_CRITICAL, flightRecorderString, "Failed to allocate %zu bytes of recording memory.",
+			memorySize);
+		return (NULL);
+	}
+
+	if (mtx_init(&recorder->lock, mtx_plain) != thrd_success) {
+		flightRecorderMemoryFree(recorder);
+
+		caerLog(CAER_LOG_CRITICAL, flightRecorderString, "Failed to initialize lock.");
+		return (NULL);
+	}
+
+	atomic_store(&recorder->writerRun, true);
+
+	if ((errno = thrd_create(&recorder->writerThread, &flightRecorderWriterThread, recorder)) != thrd_success) {
+		mtx_destroy(&recorder->lock);
+		flightRecorderMemoryFree(recorder);
+
+		caerLog(CAER_LOG_CRITICAL, flightRecorderString, "Failed to start writer thread. Error: %d.", errno);
+		return (NULL);
+	}
+
+	return (recorder);
+}
+
+void caerFlightRecorderFree(caerFlightRecorder recorder) {
+	if (recorder == NULL) {
+		return;
+	}
+
+	// Close the post-trigger window of a recording in progress at the data
+	// stored so far. A trigger waiting for the previous recording is dropped.
+	mtx_lock(&recorder->lock);
+
+	if (recorder->dumpState == FLIGHT_RECORDER_COLLECTING) {
+		recorder->dumpState = FLIGHT_RECORDER_FLUSHING;
+		recorder->dumpEndSequence = recorder->nextSequence;
+	}
+
+	recorder->triggerPending = false;
+
+	mtx_unlock(&recorder->lock);
+
+	// The writer thread finishes the current recording before exiting.
+	atomic_store(&recorder->writerRun, false);
+
+	if ((errno = thrd_join(recorder->writerThread, NULL)) != thrd_success) {
+		// This should never happen!
+		caerLog(CAER_LOG_CRITICAL, flightRecorderString, "Failed to join writer thread. Error: %d.", errno);
+	}
+
+	mtx_destroy(&recorder->lock);
+
+	flightRecorderMemoryFree(recorder);
+}
+
+bool caerFlightRecorderPut(caerFlightRecorder recorder, caerEventPacketContainerConst container) {
+	if (recorder == NULL || container == NULL) {
+		return (false);
+	}
+
+	// Packets are stored with only their events, not their full capacity.
+	size_t dataSize = 0;
+
+	CAER_EVENT_PACKET_CONTAINER_CONST_ITERATOR_START(container)
+		dataSize += CAER_EVENT_PACKET_HEADER_SIZE
+			+ ((size_t) caerEventPacketHeaderGetEventNumber(caerEventPacketContainerIteratorElement)
+				* (size_t) caerEventPacketHeaderGetEventSize(caerEventPacketContainerIteratorElement));
+	CAER_EVENT_PACKET_CONTAINER_ITERATOR_END
+
+	if (dataSize == 0) {
+		// Nothing to store.
+		return (true);
+	}
+
+	size_t recordSize = sizeof(struct flight_recorder_record) + dataSize;
+	recordSize = (recordSize + (FLIGHT_RECORDER_RECORD_ALIGNMENT - 1)) & ~((size_t) FLIGHT_RECORDER_RECORD_ALIGNMENT - 1);
+
+	int64_t lowestTimestamp = caerEventPacketContainerGetLowestEventTimestamp(container);
+	int64_t highestTimestamp = caerEventPacketContainerGetHighestEventTimestamp(container);
+
+	mtx_lock(&recorder->lock);
+
+	size_t position;
+	if (recordSize > recorder->storageSize || !flightRecorderSpaceGet(recorder, U32T(recordSize), &position)) {
+		recorder->droppedContainers++;
+
+		mtx_unlock(&recorder->lock);
+		return (false);
+	}
+
+	// Containers without events carry no time, they happen at the latest known one.
+	if (highestTimestamp < 0) {
+		lowestTimestamp = recorder->lastTimestamp;
+		highestTimestamp = recorder->lastTimestamp;
+	}
+
+	struct flight_recorder_record record = { .sequence = recorder->nextSequence, .lowestTimestamp = lowestTimestamp,
+		.highestTimestamp = highestTimestamp, .epoch = recorder->currentEpoch, .dataSize = U32T(dataSize),
+		.recordSize = U32T(recordSize) };
+
+	memcpy(recorder->storage + position, &record, sizeof(struct flight_recorder_record));
+
+	uint8_t *data = recorder->storage + position + sizeof(struct flight_recorder_record);
+
+	CAER_EVENT_PACKET_CONTAINER_CONST_ITERATOR_START(container)
+		size_t packetSize = CAER_EVENT_PACKET_HEADER_SIZE
+			+ ((size_t) caerEventPacketHeaderGetEventNumber(caerEventPacketContainerIteratorElement)
+				* (size_t) caerEventPacketHeaderGetEventSize(caerEventPacketContainerIteratorElement));
+
+		memcpy(data, caerEventPacketContainerIteratorElement, packetSize);
+		caerEventPacketHeaderSetEventCapacity((caerEventPacketHeader) data,
+			caerEventPacketHeaderGetEventNumber(caerEventPacketContainerIteratorElement));
+
+		data += packetSize;
+	CAER_EVENT_PACKET_CONTAINER_ITERATOR_END
+
+	recorder->tail = position + recordSize;
+	recorder->recordsNumber++;
+	recorder->nextSequence++;
+	recorder->lastTimestamp = highestTimestamp;
+
+	if (recorder->dumpState != FLIGHT_RECORDER_IDLE && record.sequence == recorder->dumpSequence) {
+		// The recording was waiting for this record.
+		recorder->dumpPosition = position;
+	}
+
+	if (recorder->dumpState == FLIGHT_RECORDER_COLLECTING
+		&& (record.epoch != recorder->dumpEpoch || record.lowestTimestamp > recorder->dumpEnd)) {
+		// Past the post-trigger window: the recording is complete.
+		recorder->dumpState = FLIGHT_RECORDER_FLUSHING;
+		recorder->dumpEndSequence = record.sequence;
+	}
+
+	caerSpecialEventPacketConst special = (caerSpecialEventPacketConst) caerEventPacketContainerFindEventPacketByTypeConst(
+		container, SPECIAL_EVENT);
+
+	if (special != NULL) {
+		CAER_SPECIAL_CONST_ITERATOR_VALID_START(special)
+			uint8_t type = caerSpecialEventGetType(caerSpecialIteratorElement);
+
+			if (type < 64 && ((recorder->triggerTypes >> type) & 0x01) != 0) {
+				flightRecorderTriggerLocked(recorder, caerSpecialEventGetTimestamp64(caerSpecialIteratorElement, special),
+					record.epoch);
+			}
+
+			if (type == TIMESTAMP_RESET) {
+				// Timestamps start over from zero after this container.
+				recorder->currentEpoch++;
+				recorder->lastTimestamp = 0;
+			}
+		CAER_SPECIAL_ITERATOR_VALID_END
+	}
+
+	mtx_unlock(&recorder->lock);
+
+	return (true);
+}
+
+void caerFlightRecorderTrigger(caerFlightRecorder recorder) {
+	if (recorder == NULL) {
+		return;
+	}
+
+	mtx_lock(&recorder->lock);
+
+	flightRecorderTriggerLocked(recorder, recorder->lastTimestamp, recorder->currentEpoch);
+
+	mtx_unlock(&recorder->lock);
+}
+
+void caerFlightRecorderSetTriggerTypes(caerFlightRecorder recorder, uint64_t triggerTypes) {
+	if (recorder == NULL) {
+		return;
+	}
+
+	mtx_lock(&recorder->lock);
+
+	recorder->triggerTypes = triggerTypes;
+
+	mtx_unlock(&recorder->lock);
+}
+
+uint32_t caerFlightRecorderGetRecordingsNumber(caerFlightRecorder recorder) {
+	if (recorder == NULL) {
+		return (0);
+	}
+
+	mtx_lock(&recorder->lock);
+
+	uint32_t recordingsNumber = recorder->recordingsNumber;
+
+	mtx_unlock(&recorder->lock);
+
+	return (recordingsNumber);
+}
+
+uint64_t caerFlightRecorderGetDroppedContainers(caerFlightRecorder recorder) {
+	if (recorder == NULL) {
+		return (0);
+	}
+
+	mtx_lock(&recorder->lock);
+
+	uint64_t droppedContainers = recorder->droppedContainers;
+
+	mtx_unlock(&recorder->lock);
+
+	return (droppedContainers);
+}
+
+static void flightRecorderMemoryFree(caerFlightRecorder recorder) {
+#if defined(OS_UNIX)
+	if (recorder->storageMapped) {
+		munmap(recorder->storage, recorder->storageSize);
+	}
+#else
+	free(recorder->storage);
+#endif
+
+	free(recorder->filePrefix);
+	free(recorder);
+}
+
+// Find room for a new record at the tail, overwriting the oldest records as needed.
+static bool flightRecorderSpaceGet(caerFlightRecorder recorder, uint32_t recordSize, size_t *position) {
+	while (true) {
+		if (!recorder->wrapped) {
+			// Records from head to tail.
+			if ((recorder->storageSize - recorder->tail) >= recordSize) {
+				*position = recorder->tail;
+				return (true);
+			}
+
+			// Not enough room before the end, continue at the start.
+			recorder->wrapEnd = recorder->tail;
+			recorder->tail = 0;
+			recorder->wrapped = true;
+		}
+		else {
+			// Records from head to wrapEnd, and from the start to tail.
+			if ((recorder->head - recorder->tail) >= recordSize) {
+				*position = recorder->tail;
+				return (true);
+			}
+
+			if (recorder->head == recorder->wrapEnd) {
+				// Records before the wrap-around all gone.
+				recorder->head = 0;
+				recorder->wrapped = false;
+				continue;
+			}
+
+			// Overwrite the oldest record, unless it still has to be written out.
+			struct flight_recorder_record oldest;
+			memcpy(&oldest, recorder->storage + recorder->head, sizeof(struct flight_recorder_record));
+
+			if (flightRecorderIsPinned(recorder, oldest.sequence)) {
+				return (false);
+			}
+
+			recorder->head += oldest.recordSize;
+			recorder->recordsNumber--;
+		}
+	}
+}
+
+static bool flightRecorderIsPinned(caerFlightRecorder recorder, uint64_t sequence) {
+	switch (recorder->dumpState) {
+		case FLIGHT_RECORDER_COLLECTING:
+			return (sequence >= recorder->dumpSequence);
+
+		case FLIGHT_RECORDER_FLUSHING:
+			return (sequence >= recorder->dumpSequence && sequence < recorder->dumpEndSequence);
+
+		default:
+			return (false);
+	}
+}
+
+// Position of the record stored after the given one, which must exist.
+static size_t flightRecorderNextPosition(caerFlightRecorder recorder, size_t position, uint32_t recordSize) {
+	position += recordSize;
+
+	// The wrap-around position can't change while records before it are kept.
+	if (recorder->wrapped && position == recorder->wrapEnd) {
+		position = 0;
+	}
+
+	return (position);
+}
+
+static void flightRecorderTriggerLocked(caerFlightRecorder recorder, int64_t timestamp, uint32_t epoch) {
+	switch (recorder->dumpState) {
+		case FLIGHT_RECORDER_IDLE:
+			flightRecorderRecordingStart(recorder, timestamp, epoch);
+			break;
+
+		case FLIGHT_RECORDER_COLLECTING:
+			// Extend the post-trigger window of the current recording.
+			if ((timestamp + recorder->postTrigger) > recorder->dumpEnd) {
+				recorder->dumpEnd = timestamp + recorder->postTrigger;
+			}
+			break;
+
+		case FLIGHT_RECORDER_FLUSHING:
+			// Start a new recording once the current one is written out.
+			// Only the first trigger is kept, later ones fall into its window.
+			if (!recorder->triggerPending) {
+				recorder->triggerPending = true;
+				recorder->pendingTimestamp = timestamp;
+				recorder->pendingEpoch = epoch;
+			}
+			break;
+	}
+}
+
+static void flightRecorderRecordingStart(caerFlightRecorder recorder, int64_t timestamp, uint32_t epoch) {
+	recorder->dumpState = FLIGHT_RECORDER_COLLECTING;
+	recorder->dumpEpoch = epoch;
+	recorder->dumpEnd = timestamp + recorder->postTrigger;
+
+	// By default, start with the next record to be stored.
+	recorder->dumpSequence = recorder->nextSequence;
+
+	// Find the oldest stored record inside the pre-trigger window, and, for
+	// late starts, any stored record already past the post-trigger window.
+	bool startFound = false;
+	size_t position = recorder->head;
+
+	if (recorder->wrapped && position == recorder->wrapEnd) {
+		position = 0;
+	}
+
+	for (size_t i = 0; i < recorder->recordsNumber; i++) {
+		struct flight_recorder_record record;
+		memcpy(&record, recorder->storage + position, sizeof(struct flight_recorder_record));
+
+		if (!startFound && record.epoch == epoch && record.highestTimestamp >= (timestamp - recorder->preTrigger)) {
+			startFound = true;
+			recorder->dumpSequence = record.sequence;
+			recorder->dumpPosition = position;
+		}
+
+		if (startFound && (record.epoch != epoch || record.lowestTimestamp > recorder->dumpEnd)) {
+			recorder->dumpState = FLIGHT_RECORDER_FLUSHING;
+			recorder->dumpEndSequence = record.sequence;
+			break;
+		}
+
+		position = flightRecorderNextPosition(recorder, position, record.recordSize);
+	}
+}
+
+static FILE *flightRecorderFileOpen(const char *filePrefix, uint32_t fileNumber, const uint8_t *data) {
+	size_t fileNameLength = (size_t) snprintf(NULL, 0, "%s-%" PRIu32 ".aedat", filePrefix, fileNumber);
+
+	char fileName[fileNameLength + 1];
+	snprintf(fileName, fileNameLength + 1, "%s-%" PRIu32 ".aedat", filePrefix, fileNumber);
+
+	FILE *file = fopen(fileName, "wb");
+	if (file == NULL) {
+		caerLog(CAER_LOG_ERROR, flightRecorderString, "Failed to open recording file '%s'. Error: %d.", fileName,
+			errno);
+		return (NULL);
+	}
+
+	// All stored packets come from one source, take it from the first one.
+	int16_t sourceID = caerEventPacketHeaderGetEventSource((caerEventPacketHeaderConst) data);
+
+	time_t currentTimeEpoch = time(NULL);
+
+#if defined(OS_WINDOWS)
+	// localtime() is thread-safe on Windows (and there is no localtime_r() at all).
+	struct tm *currentTime = localtime(&currentTimeEpoch);
+
+	// Windows doesn't support %z (numerical timezone), so no TZ info here.
+	size_t currentTimeStringLength = 19;
+	char currentTimeString[currentTimeStringLength + 1]; // + 1 for terminating NUL byte.
+	strftime(currentTimeString, currentTimeStringLength + 1, "%Y-%m-%d %H:%M:%S", currentTime);
+#else
+	tzset();
+
+	struct tm currentTime;
+	localtime_r(&currentTimeEpoch, &currentTime);
+
+	size_t currentTimeStringLength = 29;
+	char currentTimeString[currentTimeStringLength + 1]; // + 1 for terminating NUL byte.
+	strftime(currentTimeString, currentTimeStringLength + 1, "%Y-%m-%d %H:%M:%S (TZ%z)", &currentTime);
+#endif
+
+	// AEDAT 3.1 header, lines end with CR LF.
+	if (fprintf(file,
+		"#!AER-DAT3.1\r\n#Format: RAW\r\n#Source %" PRIi16 ": %s\r\n#Start-Time: %s\r\n#!END-HEADER\r\n",
+		sourceID, flightRecorderString, currentTimeString) < 0) {
+		caerLog(CAER_LOG_ERROR, flightRecorderString, "Failed to write header of recording file '%s'.", fileName);
+
+		fclose(file);
+		return (NULL);
+	}
+
+	caerLog(CAER_LOG_INFO, flightRecorderString, "Writing recording to file '%s'.", fileName);
+
+	return (file);
+}
+
+static int flightRecorderWriterThread(void *inPtr) {
+	caerFlightRecorder recorder = inPtr;
+
+	thrd_set_name(FLIGHT_RECORDER_THREAD_NAME);
+
+	// Records are copied out of storage under the lock, and written to
+	// the file from this buffer without holding it.
+	uint8_t *buffer = NULL;
+	size_t bufferSize = 0;
+
+	FILE *file = NULL;
+	uint32_t fileNumber = 1;
+	bool writeFailed = false;
+
+	while (true) {
+		size_t dataSize = 0;
+		bool recordingDone = false;
+
+		mtx_lock(&recorder->lock);
+
+		bool recordAvailable = (recorder->dumpState != FLIGHT_RECORDER_IDLE
+			&& recorder->dumpSequence < recorder->nextSequence
+			&& (recorder->dumpState == FLIGHT_RECORDER_COLLECTING
+				|| recorder->dumpSequence < recorder->dumpEndSequence));
+
+		if (recordAvailable) {
+			struct flight_recorder_record record;
+			memcpy(&record, recorder->storage + recorder->dumpPosition, sizeof(struct flight_recorder_record));
+
+			if (record.dataSize > bufferSize) {
+				uint8_t *newBuffer = realloc(buffer, record.dataSize);
+				if (newBuffer != NULL) {
+					buffer = newBuffer;
+					bufferSize = record.dataSize;
+				}
+			}
+
+			if (!writeFailed && record.dataSize <= bufferSize) {
+				memcpy(buffer, recorder->storage + recorder->dumpPosition + sizeof(struct flight_recorder_record),
+					record.dataSize);
+				dataSize = record.dataSize;
+			}
+			else if (!writeFailed) {
+				caerLog(CAER_LOG_ERROR, flightRecorderString,
+					"Failed to allocate memory for writing, discarding rest of recording.");
+				writeFailed = true;
+			}
+
+			// Once copied, the record can be overwritten again.
+			recorder->dumpSequence++;
+			recorder->dumpPosition = flightRecorderNextPosition(recorder, recorder->dumpPosition, record.recordSize);
+		}
+		else if (recorder->dumpState == FLIGHT_RECORDER_FLUSHING) {
+			// All data of the recording was copied.
+			recorder->dumpState = FLIGHT_RECORDER_IDLE;
+			recordingDone = true;
+
+			if (recorder->triggerPending) {
+				recorder->triggerPending = false;
+				flightRecorderRecordingStart(recorder, recorder->pendingTimestamp, recorder->pendingEpoch);
+			}
+		}
+
+		bool writerIdle = (recorder->dumpState == FLIGHT_RECORDER_IDLE);
+
+		mtx_unlock(&recorder->lock);
+
+		if (dataSize != 0) {
+			if (file == NULL) {
+				file = flightRecorderFileOpen(recorder->filePrefix, fileNumber, buffer);
+				fileNumber++;
+
+				if (file == NULL) {
+					writeFailed = true;
+				}
+			}
+
+			if (file != NULL && fwrite(buffer, 1, dataSize, file) != dataSize) {
+				caerLog(CAER_LOG_ERROR, flightRecorderString,
+					"Failed to write to recording file, discarding rest of recording. Error: %d.", errno);
+				writeFailed = true;
+			}
+		}
+
+		if (recordingDone) {
+			if (file != NULL) {
+				if (fclose(file) != 0) {
+					caerLog(CAER_LOG_ERROR, flightRecorderString, "Failed to close recording file. Error: %d.", errno);
+					writeFailed = true;
+				}
+
+				if (!writeFailed) {
+					mtx_lock(&recorder->lock);
+					recorder->recordingsNumber++;
+					mtx_unlock(&recorder->lock);
+				}
+
+				file = NULL;
+			}
+
+			writeFailed = false;
+		}
+
+		if (!recordAvailable && !recordingDone) {
+			if (writerIdle && !atomic_load(&recorder->writerRun)) {
+				break;
+			}
+
+			// Nothing to write, wait for more data.
+			struct timespec noDataSleep = { .tv_sec = 0, .tv_nsec = FLIGHT_RECORDER_WRITER_SLEEP };
+			thrd_sleep(&noDataSleep, NULL);
+		}
+	}
+
+	free(buffer);
+
+	return (EXIT_SUCCESS);
+}
@@ -1,4 +1,5 @@
 #include "libcaer.h"
+#include "profiling.h"
 #include <stdatomic.h>
 #include <stdarg.h>
 #include <time.h>
@@ -42,9 +43,13 @@ void caerLog(enum caer_log_level logLevel, const char *subSystem, const char *fo
 }
 
 void caerLogVA(enum caer_log_level logLevel, const char *subSystem, const char *format, va_list args) {
+	PROFILING_START(logStart);
+
 	caerLogVAFull(atomic_load_explicit(&caerLogFileDescriptor1, memory_order_relaxed),
 		atomic_load_explicit(&caerLogFileDescriptor2, memory_order_relaxed),
 		atomic_load_explicit(&caerLogLevel, memory_order_relaxed), logLevel, subSystem, format, args);
+
+	PROFILING_STOP(profilingLogging, logStart);
 }
 
 void caerLogVAFull(int logFileDescriptor1, int logFileDescriptor2, uint8_t systemLogLevel, enum caer_log_level logLevel,
@@ -0,0 +1,70 @@
+#include "memory_usage.h"
+
+static inline void memoryUsageUpdatePeak(struct memory_usage_counter *counter, uint_fast64_t current) {
+	uint_fast64_t peak = atomic_load_explicit(&counter->peak, memory_order_relaxed);
+
+	// On failure, peak is updated with the latest value and we check again.
+	while (current > peak
+		&& !atomic_compare_exchange_weak_explicit(&counter->peak, &peak, current, memory_order_relaxed,
+			memory_order_relaxed)) {
+		;
+	}
+}
+
+void memoryUsageAdd(struct memory_usage *usage, size_t type, size_t bytes) {
+	struct memory_usage_counter *counter = &usage->counters[type];
+
+	uint_fast64_t current = atomic_fetch_add_explicit(&counter->current, bytes, memory_order_relaxed) + bytes;
+
+	memoryUsageUpdatePeak(counter, current);
+}
+
+void memoryUsageRemove(struct memory_usage *usage, size_t type, size_t bytes) {
+	atomic_fetch_sub_explicit(&usage->counters[type].current, bytes, memory_order_relaxed);
+}
+
+void memoryUsageSet(struct memory_usage *usage, size_t type, size_t bytes) {
+	struct memory_usage_counter *counter = &usage->counters[type];
+
+	atomic_store_explicit(&counter->current, bytes, memory_order_relaxed);
+
+	memoryUsageUpdatePeak(counter, bytes);
+}
+
+bool memoryUsageGet(struct memory_usage *usage, struct caer_device_memory_usage *usages) {
+	for (size_t i = 0; i < CAER_DEVICE_MEMORY_TYPES; i++) {
+		usages[i].current = atomic_load_explicit(&usage->counters[i].current, memory_order_relaxed);
+		usages[i].peak = atomic_load_explicit(&usage->counters[i].peak, memory_order_relaxed);
+	}
+
+	return (true);
+}
+
+uint64_t memoryUsageCurrent(struct memory_usage *usage, size_t type) {
+	return (atomic_load_explicit(&usage->counters[type].current, memory_order_relaxed));
+}
+
+size_t memoryUsagePacketSize(caerEventPacketHeader packet) {
+	if (packet == NULL) {
+		return (0);
+	}
+
+	return (CAER_EVENT_PACKET_HEADER_SIZE
+		+ ((size_t) caerEventPacketHeaderGetEventCapacity(packet) * (size_t) caerEventPacketHeaderGetEventSize(packet)));
+}
+
+size_t memoryUsageContainerSize(caerEventPacketContainer container) {
+	if (container == NULL) {
+		return (0);
+	}
+
+	int32_t packetsNumber = caerEventPacketContainerGetEventPacketsNumber(container);
+
+	size_t size = sizeof(struct caer_event_packet_container) + ((size_t) packetsNumber * sizeof(caerEventPacketHeader));
+
+	for (int32_t i = 0; i < packetsNumber; i++) {
+		size += memoryUsagePacketSize(caerEventPacketContainerGetEventPacket(container, i));
+	}
+
+	return (size);
+}
@@ -0,0 +1,26 @@
+#ifndef LIBCAER_SRC_MEMORY_USAGE_H_
+#define LIBCAER_SRC_MEMORY_USAGE_H_
+
+#include "libcaer.h"
+#include "devices/usb.h"
+#include <stdatomic.h>
+
+struct memory_usage_counter {
+	atomic_uint_fast64_t current;
+	atomic_uint_fast64_t peak;
+};
+
+struct memory_usage {
+	struct memory_usage_counter counters[CAER_DEVICE_MEMORY_TYPES];
+};
+
+void memoryUsageAdd(struct memory_usage *usage, size_t type, size_t bytes);
+void memoryUsageRemove(struct memory_usage *usage, size_t type, size_t bytes);
+void memoryUsageSet(struct memory_usage *usage, size_t type, size_t bytes);
+bool memoryUsageGet(struct memory_usage *usage, struct caer_device_memory_usage *usages);
+uint64_t memoryUsageCurrent(struct memory_usage *usage, size_t type);
+
+size_t memoryUsagePacketSize(caerEventPacketHeader packet);
+size_t memoryUsageContainerSize(caerEventPacketContainer container);
+
+#endif /* LIBCAER_SRC_MEMORY_USAGE_H_ */
@@ -0,0 +1,909 @@
+#include "playback.h"
+
+static bool playbackHeaderLineRead(FILE *file, char *line, size_t lineLength);
+static bool playbackHeaderParse(playbackHandle handle);
+static caerEventPacketHeader playbackPacketRead(playbackHandle handle);
+static caerEventPacketContainer playbackContainerRead(playbackHandle handle, bool *timestampReset);
+static bool playbackPace(playbackState state, int64_t timestamp);
+static bool playbackContainerCommit(playbackHandle handle, caerEventPacketContainer container);
+static int playbackDataAcquisitionThread(void *inPtr);
+
+static inline void freeAllDataMemory(playbackState state) {
+	if (state->dataExchangeBuffer != NULL) {
+		ringBufferFree(state->dataExchangeBuffer);
+		state->dataExchangeBuffer = NULL;
+	}
+
+	if (state->pendingPacket != NULL) {
+		free(state->pendingPacket);
+		state->pendingPacket = NULL;
+	}
+
+	memoryUsageSet(&state->memoryUsage, CAER_DEVICE_MEMORY_PACKETS, 0);
+}
+
+caerDeviceHandle caerPlaybackOpen(uint16_t deviceID, const char *fileName) {
+	caerLog(CAER_LOG_DEBUG, __func__, "Initializing %s.", PLAYBACK_DEVICE_NAME);
+
+	if (fileName == NULL) {
+		caerLog(CAER_LOG_CRITICAL, __func__, "No recording to play back given.");
+		return (NULL);
+	}
+
+	playbackHandle handle = calloc(1, sizeof(*handle));
+	if (handle == NULL) {
+		// Failed to allocate memory for device handle!
+		caerLog(CAER_LOG_CRITICAL, __func__, "Failed to allocate memory for device handle.");
+		return (NULL);
+	}
+
+	// Set main deviceType correctly right away.
+	handle->deviceType = CAER_DEVICE_PLAYBACK;
+
+	playbackState state = &handle->state;
+
+	// Initialize state variables to default values (if not zero, taken care of by calloc above).
+	atomic_store_explicit(&state->dataExchangeBufferSize, 64, memory_order_relaxed);
+	atomic_store_explicit(&state->dataExchangeBlocking, false, memory_order_relaxed);
+	watermarkInit(&state->dataExchangeWatermark);
+	atomic_store_explicit(&state->pacingSpeed, 100, memory_order_relaxed); // Real-time by default.
+
+	atomic_thread_fence(memory_order_release);
+
+	// Set device thread name. Linux cuts it down to its maximum length of 15 chars.
+	snprintf(state->deviceThreadName, sizeof(state->deviceThreadName), "%s ID-%" PRIu16, PLAYBACK_DEVICE_NAME,
+		deviceID);
+
+	size_t fullLogStringLength = (size_t) snprintf(NULL, 0, "%s ID-%" PRIu16 " [%s]", PLAYBACK_DEVICE_NAME, deviceID,
+		fileName);
+
+	char *fullLogString = malloc(fullLogStringLength + 1);
+	if (fullLogString == NULL) {
+		free(handle);
+
+		caerLog(CAER_LOG_CRITICAL, __func__, "Unable to allocate memory for %s device info string.",
+			PLAYBACK_DEVICE_NAME);
+		return (NULL);
+	}
+
+	snprintf(fullLogString, fullLogStringLength + 1, "%s ID-%" PRIu16 " [%s]", PLAYBACK_DEVICE_NAME, deviceID,
+		fileName);
+
+	handle->info.deviceID = I16T(deviceID);
+	handle->info.deviceString = fullLogString;
+
+	state->file = fopen(fileName, "rb");
+	if (state->file == NULL) {
+		caerLog(CAER_LOG_CRITICAL, fullLogString, "Failed to open recording. Error: %d.", errno);
+
+		free(fullLogString);
+		free(handle);
+
+		return (NULL);
+	}
+
+	if (!playbackHeaderParse(handle)) {
+		fclose(state->file);
+
+		free(handle->info.sourceString);
+		free(fullLogString);
+		free(handle);
+
+		return (NULL);
+	}
+
+	if (state->sourceIDKnown) {
+		caerLog(CAER_LOG_DEBUG, fullLogString, "Initialized successfully, playing back source %" PRIi16 " (%s).",
+			handle->info.sourceID, handle->info.sourceString);
+	}
+	else {
+		caerLog(CAER_LOG_DEBUG, fullLogString,
+			"Initialized successfully, playing back the source of the first event packet.");
+	}
+
+	return ((caerDeviceHandle) handle);
+}
+
+bool playbackClose(caerDeviceHandle cdh) {
+	playbackHandle handle = (playbackHandle) cdh;
+	playbackState state = &handle->state;
+
+	caerLog(CAER_LOG_DEBUG, handle->info.deviceString, "Shutting down ...");
+
+	fclose(state->file);
+
+	caerLog(CAER_LOG_DEBUG, handle->info.deviceString, "Shutdown successful.");
+
+	// Free memory.
+	free(handle->info.sourceString);
+	free(handle->info.deviceString);
+	free(handle);
+
+	return (true);
+}
+
+struct caer_playback_info caerPlaybackInfoGet(caerDeviceHandle cdh) {
+	playbackHandle handle = (playbackHandle) cdh;
+
+	// Check if the pointer is valid.
+	if (handle == NULL) {
+		struct caer_playback_info emptyInfo = { 0, .deviceString = NULL, .sourceString = NULL };
+		return (emptyInfo);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType != CAER_DEVICE_PLAYBACK) {
+		struct caer_playback_info emptyInfo = { 0, .deviceString = NULL, .sourceString = NULL };
+		return (emptyInfo);
+	}
+
+	// Return a copy of the device information.
+	return (handle->info);
+}
+
+bool playbackSendDefaultConfig(caerDeviceHandle cdh) {
+	// Nothing to send to, just go back to real-time pacing.
+	return (playbackConfigSet(cdh, PLAYBACK_CONFIG_PACING, PLAYBACK_CONFIG_PACING_SPEED, 100));
+}
+
+bool playbackConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, uint32_t param) {
+	playbackHandle handle = (playbackHandle) cdh;
+	playbackState state = &handle->state;
+
+	switch (modAddr) {
+		case CAER_HOST_CONFIG_DATAEXCHANGE:
+			switch (paramAddr) {
+				case CAER_HOST_CONFIG_DATAEXCHANGE_BUFFER_SIZE:
+					atomic_store(&state->dataExchangeBufferSize, param);
+					break;
+
+				case CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING:
+					atomic_store(&state->dataExchangeBlocking, param);
+					break;
+
+				case CAER_HOST_CONFIG_DATAEXCHANGE_HIGH_WATERMARK:
+					return (watermarkSetHigh(&state->dataExchangeWatermark, param));
+					break;
+
+				case CAER_HOST_CONFIG_DATAEXCHANGE_LOW_WATERMARK:
+					return (watermarkSetLow(&state->dataExchangeWatermark, param));
+					break;
+
+				default:
+					return (false);
+					break;
+			}
+			break;
+
+		case CAER_HOST_CONFIG_THREAD:
+			switch (paramAddr) {
+				case CAER_HOST_CONFIG_THREAD_CPU_AFFINITY:
+					atomic_store(&state->dataAcquisitionThreadCpuAffinity, param);
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_SCHED_POLICY:
+					if (param > CAER_HOST_CONFIG_THREAD_SCHED_RR) {
+						return (false);
+					}
+
+					atomic_store(&state->dataAcquisitionThreadSchedPolicy, param);
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_SCHED_PRIORITY:
+					atomic_store(&state->dataAcquisitionThreadSchedPriority, param);
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_MEMORY_LOCK:
+					atomic_store(&state->dataAcquisitionThreadMemoryLock, param);
+					break;
+
+				default:
+					return (false);
+					break;
+			}
+			break;
+
+		case PLAYBACK_CONFIG_PACING:
+			switch (paramAddr) {
+				case PLAYBACK_CONFIG_PACING_SPEED:
+					atomic_store(&state->pacingSpeed, param);
+					break;
+
+				default:
+					return (false);
+					break;
+			}
+			break;
+
+		default:
+			return (false);
+			break;
+	}
+
+	return (true);
+}
+
+bool playbackConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, uint32_t *param) {
+	playbackHandle handle = (playbackHandle) cdh;
+	playbackState state = &handle->state;
+
+	switch (modAddr) {
+		case CAER_HOST_CONFIG_DATAEXCHANGE:
+			switch (paramAddr) {
+				case CAER_HOST_CONFIG_DATAEXCHANGE_BUFFER_SIZE:
+					*param = U32T(atomic_load(&state->dataExchangeBufferSize));
+					break;
+
+				case CAER_HOST_CONFIG_DATAEXCHANGE_BLOCKING:
+					*param = atomic_load(&state->dataExchangeBlocking);
+					break;
+
+				case CAER_HOST_CONFIG_DATAEXCHANGE_HIGH_WATERMARK:
+					*param = U32T(atomic_load(&state->dataExchangeWatermark.high));
+					break;
+
+				case CAER_HOST_CONFIG_DATAEXCHANGE_LOW_WATERMARK:
+					*param = U32T(atomic_load(&state->dataExchangeWatermark.low));
+					break;
+
+				default:
+					return (false);
+					break;
+			}
+			break;
+
+		case CAER_HOST_CONFIG_THREAD:
+			switch (paramAddr) {
+				case CAER_HOST_CONFIG_THREAD_CPU_AFFINITY:
+					*param = U32T(atomic_load(&state->dataAcquisitionThreadCpuAffinity));
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_SCHED_POLICY:
+					*param = U32T(atomic_load(&state->dataAcquisitionThreadSchedPolicy));
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_SCHED_PRIORITY:
+					*param = U32T(atomic_load(&state->dataAcquisitionThreadSchedPriority));
+					break;
+
+				case CAER_HOST_CONFIG_THREAD_MEMORY_LOCK:
+					*param = atomic_load(&state->dataAcquisitionThreadMemoryLock);
+					break;
+
+				default:
+					return (false);
+					break;
+			}
+			break;
+
+		case PLAYBACK_CONFIG_PACING:
+			switch (paramAddr) {
+				case PLAYBACK_CONFIG_PACING_SPEED:
+					*param = U32T(atomic_load(&state->pacingSpeed));
+					break;
+
+				default:
+					return (false);
+					break;
+			}
+			break;
+
+		default:
+			return (false);
+			break;
+	}
+
+	return (true);
+}
+
+bool playbackDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr),
+	void (*dataNotifyDecrease)(void *ptr), void *dataNotifyUserPtr, void (*dataShutdownNotify)(void *ptr),
+	void *dataShutdownUserPtr) {
+	playbackHandle handle = (playbackHandle) cdh;
+	playbackState state = &handle->state;
+
+	// Store new data available/not available anymore call-backs.
+	state->dataNotifyIncrease = dataNotifyIncrease;
+	state->dataNotifyDecrease = dataNotifyDecrease;
+	state->dataNotifyUserPtr = dataNotifyUserPtr;
+	state->dataShutdownNotify = dataShutdownNotify;
+	state->dataShutdownUserPtr = dataShutdownUserPtr;
+
+	// Always play back from the start of the recording.
+	if (fseek(state->file, state->fileDataStart, SEEK_SET) != 0) {
+		caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to rewind recording. Error: %d.", errno);
+		return (false);
+	}
+
+	// Pacing is anchored anew on the first packet container.
+	state->pacingBaseSpeed = 0;
+	state->lastHostTime = -1;
+	state->lastTimestamp = -1;
+
+	// Initialize RingBuffer.
+	state->dataExchangeBuffer = ringBufferInit(atomic_load(&state->dataExchangeBufferSize));
+	if (state->dataExchangeBuffer == NULL) {
+		caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to initialize data exchange buffer.");
+		return (false);
+	}
+
+	// Watermarks follow the new buffer size.
+	watermarkReset(&state->dataExchangeWatermark, ringBufferSize(state->dataExchangeBuffer),
+		ringBufferPutCapacity(state->dataExchangeBuffer));
+
+	// The data acquisition thread stops by itself at the end of the recording,
+	// so signal it as running before it starts, not from inside it.
+	atomic_store(&state->dataAcquisitionThreadRun, true);
+
+	if ((errno = thrd_create(&state->dataAcquisitionThread, &playbackDataAcquisitionThread, handle)) != thrd_success) {
+		atomic_store(&state->dataAcquisitionThreadRun, false);
+		freeAllDataMemory(state);
+
+		caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to start data acquisition thread. Error: %d.",
+		errno);
+		return (false);
+	}
+
+	return (true);
+}
+
+bool playbackDataStop(caerDeviceHandle cdh) {
+	playbackHandle handle = (playbackHandle) cdh;
+	playbackState state = &handle->state;
+
+	// Stop data acquisition thread.
+	atomic_store(&state->dataAcquisitionThreadRun, false);
+
+	// Wait for data acquisition thread to terminate...
+	if ((errno = thrd_join(state->dataAcquisitionThread, NULL)) != thrd_success) {
+		// This should never happen!
+		caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to join data acquisition thread. Error: %d.",
+		errno);
+		return (false);
+	}
+
+	// Empty ringbuffer.
+	caerEventPacketContainer container;
+	while ((container = ringBufferGet(state->dataExchangeBuffer)) != NULL) {
+		memoryUsageRemove(&state->memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, memoryUsageContainerSize(container));
+
+		// Notify data-not-available call-back.
+		if (state->dataNotifyDecrease != NULL) {
+			state->dataNotifyDecrease(state->dataNotifyUserPtr);
+		}
+
+		// Free container, which will free its subordinate packets too.
+		caerEventPacketContainerFree(container);
+	}
+
+	// Free packet read ahead and ringbuffer.
+	freeAllDataMemory(state);
+
+	return (true);
+}
+
+// Remember to properly free the returned memory after usage!
+caerEventPacketContainer playbackDataGet(caerDeviceHandle cdh) {
+	playbackHandle handle = (playbackHandle) cdh;
+	playbackState state = &handle->state;
+	caerEventPacketContainer container = NULL;
+
+	retry: container = ringBufferGet(state->dataExchangeBuffer);
+
+	if (container != NULL) {
+		// The container now belongs to the caller.
+		size_t containerSize = memoryUsageContainerSize(container);
+		memoryUsageRemove(&state->memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, containerSize);
+		memoryUsageAdd(&state->memoryUsage, CAER_DEVICE_MEMORY_DELIVERED, containerSize);
+
+		watermarkUpdate(&state->dataExchangeWatermark, ringBufferUsage(state->dataExchangeBuffer));
+
+		// Found an event container, return it and signal this piece of data
+		// is no longer available for later acquisition.
+		if (state->dataNotifyDecrease != NULL) {
+			state->dataNotifyDecrease(state->dataNotifyUserPtr);
+		}
+
+		return (container);
+	}
+
+	// Didn't find any event container, either report this or retry, depending
+	// on blocking setting. Once the end of the recording is reached, no more
+	// data will come, so don't block forever.
+	if (atomic_load_explicit(&state->dataExchangeBlocking, memory_order_relaxed)
+		&& atomic_load_explicit(&state->dataAcquisitionThreadRun, memory_order_relaxed)) {
+		// Don't retry right away in a tight loop, back off and wait a little.
+		// If no data is available, sleep for a millisecond to avoid wasting resources.
+		struct timespec noDataSleep = { .tv_sec = 0, .tv_nsec = 1000000 };
+		if (thrd_sleep(&noDataSleep, NULL) == 0) {
+			goto retry;
+		}
+	}
+
+	// Nothing.
+	return (NULL);
+}
+
+size_t playbackDataGetBatch(caerDeviceHandle cdh, caerEventPacketContainer *containers, size_t maxContainers) {
+	playbackHandle handle = (playbackHandle) cdh;
+	playbackState state = &handle->state;
+
+	size_t containersNumber = 0;
+
+	if (containers == NULL || maxContainers == 0) {
+		return (0);
+	}
+
+	retry: containersNumber = ringBufferGetBatch(state->dataExchangeBuffer, (void **) containers, maxContainers);
+
+	if (containersNumber != 0) {
+		// The containers now belong to the caller.
+		for (size_t i = 0; i < containersNumber; i++) {
+			size_t containerSize = memoryUsageContainerSize(containers[i]);
+			memoryUsageRemove(&state->memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, containerSize);
+			memoryUsageAdd(&state->memoryUsage, CAER_DEVICE_MEMORY_DELIVERED, containerSize);
+
+			// Signal each piece of data is no longer available for later acquisition.
+			if (state->dataNotifyDecrease != NULL) {
+				state->dataNotifyDecrease(state->dataNotifyUserPtr);
+			}
+		}
+
+		watermarkUpdate(&state->dataExchangeWatermark, ringBufferUsage(state->dataExchangeBuffer));
+
+		return (containersNumber);
+	}
+
+	// Didn't find any event container, either report this or retry, depending
+	// on blocking setting. Once the end of the recording is reached, no more
+	// data will come, so don't block forever.
+	if (atomic_load_explicit(&state->dataExchangeBlocking, memory_order_relaxed)
+		&& atomic_load_explicit(&state->dataAcquisitionThreadRun, memory_order_relaxed)) {
+		// Don't retry right away in a tight loop, back off and wait a little.
+		// If no data is available, sleep for a millisecond to avoid wasting resources.
+		struct timespec noDataSleep = { .tv_sec = 0, .tv_nsec = 1000000 };
+		if (thrd_sleep(&noDataSleep, NULL) == 0) {
+			goto retry;
+		}
+	}
+
+	// Nothing.
+	return (0);
+}
+
+int64_t playbackTimestampToHost(caerDeviceHandle cdh, int64_t deviceTimestamp) {
+	(void) (cdh);
+	(void) (deviceTimestamp);
+
+	// Recordings carry no host time, and pacing can change at any time.
+	return (-1);
+}
+
+bool playbackProfilingGet(caerDeviceHandle cdh, struct caer_device_profiling_stage *stages) {
+	playbackHandle handle = (playbackHandle) cdh;
+
+	return (profilingGet(&handle->state.profiling, stages));
+}
+
+bool playbackMemoryUsageGet(caerDeviceHandle cdh, struct caer_device_memory_usage *usages) {
+	playbackHandle handle = (playbackHandle) cdh;
+
+	return (memoryUsageGet(&handle->state.memoryUsage, usages));
+}
+
+bool playbackDataWatermarkNotifySet(caerDeviceHandle cdh, void (*dataWatermarkNotify)(void *ptr, bool high),
+	void *dataWatermarkUserPtr) {
+	playbackHandle handle = (playbackHandle) cdh;
+	playbackState state = &handle->state;
+
+	// Both producer and consumers may call the notification, so it can't change under them.
+	if (state->dataExchangeBuffer != NULL) {
+		caerLog(CAER_LOG_ERROR, handle->info.deviceString,
+			"Cannot change watermark notification while data exchange is running.");
+		return (false);
+	}
+
+	state->dataExchangeWatermark.notify = dataWatermarkNotify;
+	state->dataExchangeWatermark.notifyUserPtr = dataWatermarkUserPtr;
+
+	return (true);
+}
+
+static bool playbackHeaderLineRead(FILE *file, char *line, size_t lineLength) {
+	if (fgets(line, (int) lineLength, file) == NULL) {
+		return (false);
+	}
+
+	size_t length = strlen(line);
+
+	if (length == 0 || line[length - 1] != '\n') {
+		// Line too long, skip the rest of it. Only the start is ever needed.
+		int c;
+		while ((c = fgetc(file)) != EOF && c != '\n') {
+			;
+		}
+	}
+
+	// Header lines end with CR LF.
+	while (length > 0 && (line[length - 1] == '\n' || line[length - 1] == '\r')) {
+		line[--length] = '\0';
+	}
+
+	return (true);
+}
+
+static bool playbackHeaderParse(playbackHandle handle) {
+	playbackState state = &handle->state;
+	char line[PLAYBACK_HEADER_LINE_LENGTH];
+	bool formatFound = false;
+
+	if (!playbackHeaderLineRead(state->file, line, PLAYBACK_HEADER_LINE_LENGTH)
+		|| strcmp(line, PLAYBACK_HEADER_VERSION) != 0) {
+		caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Not an AEDAT 3.1 recording.");
+		return (false);
+	}
+
+	while (true) {
+		if (!playbackHeaderLineRead(state->file, line, PLAYBACK_HEADER_LINE_LENGTH)) {
+			caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Recording header is incomplete.");
+			return (false);
+		}
+
+		if (strcmp(line, PLAYBACK_HEADER_END) == 0) {
+			break;
+		}
+
+		if (strncmp(line, "#Format:", strlen("#Format:")) == 0) {
+			if (strcmp(line, PLAYBACK_HEADER_FORMAT) != 0) {
+				caerLog(CAER_LOG_CRITICAL, handle->info.deviceString,
+					"Unsupported recording format, only RAW is supported: '%s'.", line);
+				return (false);
+			}
+
+			formatFound = true;
+		}
+		else if (!state->sourceIDKnown && strncmp(line, PLAYBACK_HEADER_SOURCE, strlen(PLAYBACK_HEADER_SOURCE)) == 0) {
+			// Format is '#Source <ID>: <description>'.
+			char *idStart = line + strlen(PLAYBACK_HEADER_SOURCE);
+			char *idEnd = NULL;
+			long sourceID = strtol(idStart, &idEnd, 10);
+
+			if (idEnd == idStart || *idEnd != ':' || sourceID < 0 || sourceID > INT16_MAX) {
+				caerLog(CAER_LOG_WARNING, handle->info.deviceString, "Ignoring invalid source header line '%s'.", line);
+				continue;
+			}
+
+			char *description = idEnd + 1;
+			while (*description == ' ') {
+				description++;
+			}
+
+			size_t descriptionLength = strlen(description);
+
+			handle->info.sourceString = malloc(descriptionLength + 1);
+			if (handle->info.sourceString == NULL) {
+				caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate source description.");
+				return (false);
+			}
+
+			memcpy(handle->info.sourceString, description, descriptionLength + 1);
+
+			handle->info.sourceID = I16T(sourceID);
+			state->sourceIDKnown = true;
+		}
+	}
+
+	if (!formatFound) {
+		caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Recording header doesn't specify the data format.");
+		return (false);
+	}
+
+	if (handle->info.sourceString == NULL) {
+		handle->info.sourceString = calloc(1, 1);
+		if (handle->info.sourceString == NULL) {
+			caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate source description.");
+			return (false);
+		}
+	}
+
+	state->fileDataStart = ftell(state->file);
+	if (state->fileDataStart < 0) {
+		caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to get recording data position. Error: %d.",
+		errno);
+		return (false);
+	}
+
+	return (true);
+}
+
+static caerEventPacketHeader playbackPacketRead(playbackHandle handle) {
+	playbackState state = &handle->state;
+
+	while (true) {
+		struct caer_event_packet_header header;
+
+		size_t headerRead = fread(&header, 1, CAER_EVENT_PACKET_HEADER_SIZE, state->file);
+		if (headerRead != CAER_EVENT_PACKET_HEADER_SIZE) {
+			if (ferror(state->file)) {
+				caerLog(CAER_LOG_ERROR, handle->info.deviceString, "Failed to read from recording.");
+			}
+			else if (headerRead != 0) {
+				caerLog(CAER_LOG_ERROR, handle->info.deviceString, "Recording ends with a truncated packet header.");
+			}
+
+			// End of recording.
+			return (NULL);
+		}
+
+		int16_t eventType = caerEventPacketHeaderGetEventType(&header);
+		int16_t eventSource = caerEventPacketHeaderGetEventSource(&header);
+		int32_t eventSize = caerEventPacketHeaderGetEventSize(&header);
+		int32_t eventTSOffset = caerEventPacketHeaderGetEventTSOffset(&header);
+		int32_t eventNumber = caerEventPacketHeaderGetEventNumber(&header);
+		int32_t eventValid = caerEventPacketHeaderGetEventValid(&header);
+
+		if ((U16T(eventType) & PLAYBACK_COMPRESSED_TYPE_MASK) != 0) {
+			caerLog(CAER_LOG_ERROR, handle->info.deviceString, "Compressed event packets are not supported.");
+			return (NULL);
+		}
+
+		// Size and offset are known non-negative when compared, so do it unsigned: corrupted
+		// headers then cannot make any signed arithmetic overflow.
+		if (eventSize < 4 || eventTSOffset < 0 || U32T(eventTSOffset) > (U32T(eventSize) - 4U) || eventNumber < 0
+			|| eventValid < 0 || eventValid > eventNumber) {
+			caerLog(CAER_LOG_ERROR, handle->info.deviceString, "Recording contains an invalid packet header.");
+			return (NULL);
+		}
+
+		size_t eventsSize = (size_t) eventNumber * (size_t) eventSize;
+
+		// Without a source in the header, play back the one of the first packet.
+		if (!state->sourceIDKnown) {
+			handle->info.sourceID = eventSource;
+			state->sourceIDKnown = true;
+		}
+
+		if (eventSource != handle->info.sourceID || eventType >= PLAYBACK_EVENT_TYPES) {
+			// Not played back, skip its events.
+			if (fseek(state->file, (long) eventsSize, SEEK_CUR) != 0) {
+				caerLog(CAER_LOG_ERROR, handle->info.deviceString, "Failed to skip event packet. Error: %d.", errno);
+				return (NULL);
+			}
+
+			continue;
+		}
+
+		caerEventPacketHeader packet = malloc(CAER_EVENT_PACKET_HEADER_SIZE + eventsSize);
+		if (packet == NULL) {
+			caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate event packet.");
+			return (NULL);
+		}
+
+		memcpy(packet, &header, CAER_EVENT_PACKET_HEADER_SIZE);
+
+		if (fread(((uint8_t *) packet) + CAER_EVENT_PACKET_HEADER_SIZE, 1, eventsSize, state->file) != eventsSize) {
+			free(packet);
+
+			caerLog(CAER_LOG_ERROR, handle->info.deviceString, "Recording ends with a truncated event packet.");
+			return (NULL);
+		}
+
+		// Only the events present are stored in recordings, and they now come from this device.
+		caerEventPacketHeaderSetEventCapacity(packet, eventNumber);
+		caerEventPacketHeaderSetEventSource(packet, handle->info.deviceID);
+
+		return (packet);
+	}
+}
+
+static caerEventPacketContainer playbackContainerRead(playbackHandle handle, bool *timestampReset) {
+	playbackState state = &handle->state;
+	caerEventPacketHeader packets[PLAYBACK_EVENT_TYPES] = { NULL };
+	int32_t packetsNumber = 0;
+
+	*timestampReset = false;
+
+	while (true) {
+		caerEventPacketHeader packet = state->pendingPacket;
+
+		if (packet != NULL) {
+			state->pendingPacket = NULL;
+			memoryUsageSet(&state->memoryUsage, CAER_DEVICE_MEMORY_PACKETS, 0);
+		}
+		else {
+			packet = playbackPacketRead(handle);
+			if (packet == NULL) {
+				// End of recording, or read error (already logged).
+				break;
+			}
+		}
+
+		int16_t eventType = caerEventPacketHeaderGetEventType(packet);
+
+		bool isTimestampReset = (eventType == SPECIAL_EVENT)
+			&& (caerSpecialEventPacketFindValidEventByTypeConst((caerSpecialEventPacketConst) packet, TIMESTAMP_RESET)
+				!= NULL);
+
+		// A packet type repeating starts the next container, and timestamp resets
+		// get a container of their own, like with live devices.
+		if (packets[eventType] != NULL || (isTimestampReset && packetsNumber > 0)) {
+			state->pendingPacket = packet;
+			memoryUsageSet(&state->memoryUsage, CAER_DEVICE_MEMORY_PACKETS, memoryUsagePacketSize(packet));
+			break;
+		}
+
+		packets[eventType] = packet;
+
+		if (eventType >= packetsNumber) {
+			packetsNumber = eventType + 1;
+		}
+
+		if (isTimestampReset) {
+			*timestampReset = true;
+			break;
+		}
+	}
+
+	if (packetsNumber == 0) {
+		return (NULL);
+	}
+
+	caerEventPacketContainer container = caerEventPacketContainerAllocate(packetsNumber);
+	if (container == NULL) {
+		for (int32_t i = 0; i < packetsNumber; i++) {
+			free(packets[i]);
+		}
+
+		caerLog(CAER_LOG_CRITICAL, handle->info.deviceString, "Failed to allocate event packet container.");
+		return (NULL);
+	}
+
+	for (int32_t i = 0; i < packetsNumber; i++) {
+		caerEventPacketContainerSetEventPacket(container, i, packets[i]);
+	}
+
+	return (container);
+}
+
+static bool playbackPace(playbackState state, int64_t timestamp) {
+	while (atomic_load_explicit(&state->dataAcquisitionThreadRun, memory_order_relaxed)) {
+		uint32_t speed = U32T(atomic_load_explicit(&state->pacingSpeed, memory_order_relaxed));
+
+		// Unpaced, or no events to pace on.
+		if (speed == 0 || timestamp < 0) {
+			return (true);
+		}
+
+		int64_t currentTime = usbHostTime();
+
+		if (speed != state->pacingBaseSpeed || state->lastHostTime < 0 || timestamp < state->lastTimestamp) {
+			if (state->lastHostTime < 0 || timestamp < state->lastTimestamp) {
+				// Start, timestamp reset or timestamps going back: deliver right
+				// away, and pace the following containers from here.
+				state->pacingBaseHostTime = currentTime;
+				state->pacingBaseTimestamp = timestamp;
+			}
+			else {
+				// Speed change: continue from the last delivered container.
+				state->pacingBaseHostTime = state->lastHostTime;
+				state->pacingBaseTimestamp = state->lastTimestamp;
+			}
+
+			state->pacingBaseSpeed = speed;
+		}
+
+		int64_t waitTime = state->pacingBaseHostTime
+			+ (((timestamp - state->pacingBaseTimestamp) * 100) / I64T(speed)) - currentTime;
+		if (waitTime <= 0) {
+			return (true);
+		}
+
+		// Sleep in small steps, to notice speed changes and stops.
+		if (waitTime > PLAYBACK_PACING_SLEEP_MAX) {
+			waitTime = PLAYBACK_PACING_SLEEP_MAX;
+		}
+
+		struct timespec pacingSleep = { .tv_sec = 0, .tv_nsec = waitTime * 1000 };
+		thrd_sleep(&pacingSleep, NULL);
+	}
+
+	return (false);
+}
+
+static bool playbackContainerCommit(playbackHandle handle, caerEventPacketContainer container) {
+	playbackState state = &handle->state;
+
+	PROFILING_START(commitStart);
+
+	size_t containerSize = memoryUsageContainerSize(container);
+
+	// Account for it before the consumer can take it.
+	memoryUsageAdd(&state->memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, containerSize);
+
+	// Playback never drops data: wait for the consumer to make room.
+	while (!ringBufferPut(state->dataExchangeBuffer, container)) {
+		if (!atomic_load_explicit(&state->dataAcquisitionThreadRun, memory_order_relaxed)) {
+			memoryUsageRemove(&state->memoryUsage, CAER_DEVICE_MEMORY_DATA_EXCHANGE, containerSize);
+			return (false);
+		}
+
+		struct timespec fullSleep = { .tv_sec = 0, .tv_nsec = 100000 };
+		thrd_sleep(&fullSleep, NULL);
+	}
+
+	watermarkUpdate(&state->dataExchangeWatermark, ringBufferUsage(state->dataExchangeBuffer));
+
+	if (state->dataNotifyIncrease != NULL) {
+		state->dataNotifyIncrease(state->dataNotifyUserPtr);
+	}
+
+	PROFILING_STOP(state->profiling.stages[CAER_DEVICE_PROFILING_COMMIT], commitStart);
+
+	return (true);
+}
+
+static int playbackDataAcquisitionThread(void *inPtr) {
+	// inPtr is a pointer to device handle.
+	playbackHandle handle = inPtr;
+	playbackState state = &handle->state;
+
+	caerLog(CAER_LOG_DEBUG, handle->info.deviceString, "Initializing data acquisition thread ...");
+
+	// Set thread name.
+	thrd_set_name(state->deviceThreadName);
+
+	// Apply CPU affinity, real-time scheduling and memory locking, if requested.
+	usbThreadConfigure(handle->info.deviceString, U32T(atomic_load(&state->dataAcquisitionThreadCpuAffinity)),
+		U32T(atomic_load(&state->dataAcquisitionThreadSchedPolicy)),
+		U32T(atomic_load(&state->dataAcquisitionThreadSchedPriority)),
+		atomic_load(&state->dataAcquisitionThreadMemoryLock));
+
+	caerLog(CAER_LOG_DEBUG, handle->info.deviceString, "data acquisition thread ready to process events.");
+
+	while (atomic_load_explicit(&state->dataAcquisitionThreadRun, memory_order_relaxed)) {
+		PROFILING_START(readStart);
+
+		bool timestampReset = false;
+		caerEventPacketContainer container = playbackContainerRead(handle, &timestampReset);
+		if (container == NULL) {
+			caerLog(CAER_LOG_INFO, handle->info.deviceString, "End of recording reached.");
+			break;
+		}
+
+		PROFILING_STOP(state->profiling.stages[CAER_DEVICE_PROFILING_TRANSLATOR], readStart);
+
+		int64_t timestamp = caerEventPacketContainerGetHighestEventTimestamp(container);
+
+		if (!playbackPace(state, timestamp)) {
+			caerEventPacketContainerFree(container);
+			break;
+		}
+
+		int64_t currentTime = usbHostTime();
+		caerEventPacketContainerSetHostTimestamp(container, currentTime);
+
+		if (!playbackContainerCommit(handle, container)) {
+			caerEventPacketContainerFree(container);
+			break;
+		}
+
+		// Timestamps start over after a reset, so does pacing.
+		state->lastHostTime = (timestampReset) ? (-1) : (currentTime);
+		if (timestamp >= 0) {
+			state->lastTimestamp = timestamp;
+		}
+	}
+
+	caerLog(CAER_LOG_DEBUG, handle->info.deviceString, "shutting down data acquisition thread ...");
+
+	// Ensure shutdown is stored and notified, could be because of the end of the recording!
+	atomic_store(&state->dataAcquisitionThreadRun, false);
+
+	if (state->dataShutdownNotify != NULL) {
+		state->dataShutdownNotify(state->dataShutdownUserPtr);
+	}
+
+	caerLog(CAER_LOG_DEBUG, handle->info.deviceString, "data acquisition thread shut down.");
+
+	return (EXIT_SUCCESS);
+}
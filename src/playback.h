@@ -0,0 +1,103 @@
+#ifndef LIBCAER_SRC_PLAYBACK_H_
+#define LIBCAER_SRC_PLAYBACK_H_
+
+#include "devices/playback.h"
+#include "events/special.h"
+#include "ringbuffer/ringbuffer.h"
+#include "usb_utils.h"
+#include "watermark.h"
+#include <stdatomic.h>
+
+#if defined(HAVE_PTHREADS)
+	#include "c11threads_posix.h"
+#endif
+
+#define PLAYBACK_DEVICE_NAME "Playback"
+
+#define PLAYBACK_HEADER_VERSION "#!AER-DAT3.1"
+#define PLAYBACK_HEADER_FORMAT "#Format: RAW"
+#define PLAYBACK_HEADER_SOURCE "#Source "
+#define PLAYBACK_HEADER_END "#!END-HEADER"
+#define PLAYBACK_HEADER_LINE_LENGTH 1024
+
+// Packets are placed at the container position given by their event type,
+// types from this value up are skipped.
+#define PLAYBACK_EVENT_TYPES 32
+
+// Compressed packets have the highest bit of their event type set.
+#define PLAYBACK_COMPRESSED_TYPE_MASK 0x8000
+
+// Longest pacing sleep, to react quickly to speed changes and stops (µs).
+#define PLAYBACK_PACING_SLEEP_MAX 10000
+
+struct playback_state {
+	// Data Acquisition Thread -> Mainloop Exchange
+	RingBuffer dataExchangeBuffer;
+	atomic_uint_fast32_t dataExchangeBufferSize; // Only takes effect on DataStart() calls!
+	atomic_bool dataExchangeBlocking;
+	struct watermark_state dataExchangeWatermark;
+	void (*dataNotifyIncrease)(void *ptr);
+	void (*dataNotifyDecrease)(void *ptr);
+	void *dataNotifyUserPtr;
+	void (*dataShutdownNotify)(void *ptr);
+	void *dataShutdownUserPtr;
+	// Recording State
+	char deviceThreadName[17 + 1]; // Longest is "Playback ID-65535", +1 for terminating NUL character.
+	FILE *file;
+	long fileDataStart;
+	bool sourceIDKnown;
+	// Next packet, already read from the recording, that belongs to the next container.
+	caerEventPacketHeader pendingPacket;
+	// Data Acquisition Thread
+	thrd_t dataAcquisitionThread;
+	atomic_bool dataAcquisitionThreadRun;
+	atomic_uint_fast32_t dataAcquisitionThreadCpuAffinity; // Only takes effect on DataStart() calls!
+	atomic_uint_fast32_t dataAcquisitionThreadSchedPolicy; // Only takes effect on DataStart() calls!
+	atomic_uint_fast32_t dataAcquisitionThreadSchedPriority; // Only takes effect on DataStart() calls!
+	atomic_bool dataAcquisitionThreadMemoryLock; // Only takes effect on DataStart() calls!
+	// Pacing, in percent of real-time (zero is unpaced)
+	atomic_uint_fast32_t pacingSpeed;
+	uint32_t pacingBaseSpeed;
+	int64_t pacingBaseHostTime;
+	int64_t pacingBaseTimestamp;
+	int64_t lastHostTime; // Host time (µs) of the last delivered container, -1 to anchor pacing anew.
+	int64_t lastTimestamp;
+	// Data acquisition time accounting, only updated if profiling support is enabled.
+	struct profiling_state profiling;
+	// Bytes held by the playback's data acquisition, by type.
+	struct memory_usage memoryUsage;
+};
+
+typedef struct playback_state *playbackState;
+
+struct playback_handle {
+	uint16_t deviceType;
+	// Information fields
+	struct caer_playback_info info;
+	// State for data management.
+	struct playback_state state;
+};
+
+typedef struct playback_handle *playbackHandle;
+
+bool playbackClose(caerDeviceHandle handle);
+
+bool playbackSendDefaultConfig(caerDeviceHandle handle);
+// Negative addresses are used for host-side configuration.
+// Positive addresses (including zero) are used for playback-side configuration.
+bool playbackConfigSet(caerDeviceHandle handle, int8_t modAddr, uint8_t paramAddr, uint32_t param);
+bool playbackConfigGet(caerDeviceHandle handle, int8_t modAddr, uint8_t paramAddr, uint32_t *param);
+
+bool playbackDataStart(caerDeviceHandle handle, void (*dataNotifyIncrease)(void *ptr),
+	void (*dataNotifyDecrease)(void *ptr), void *dataNotifyUserPtr, void (*dataShutdownNotify)(void *ptr),
+	void *dataShutdownUserPtr);
+bool playbackDataStop(caerDeviceHandle handle);
+caerEventPacketContainer playbackDataGet(caerDeviceHandle handle);
+size_t playbackDataGetBatch(caerDeviceHandle handle, caerEventPacketContainer *containers, size_t maxContainers);
+int64_t playbackTimestampToHost(caerDeviceHandle handle, int64_t deviceTimestamp);
+bool playbackProfilingGet(caerDeviceHandle handle, struct caer_device_profiling_stage *stages);
+bool playbackMemoryUsageGet(caerDeviceHandle handle, struct caer_device_memory_usage *usages);
+bool playbackDataWatermarkNotifySet(caerDeviceHandle handle, void (*dataWatermarkNotify)(void *ptr, bool high),
+	void *dataWatermarkUserPtr);
+
+#endif /* LIBCAER_SRC_PLAYBACK_H_ */
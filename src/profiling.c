@@ -0,0 +1,47 @@
+#include "profiling.h"
+#include <time.h>
+
+struct profiling_stage profilingLogging;
+
+#if LIBCAER_HAVE_PROFILING == 1
+
+uint64_t profilingTime(void) {
+	// CLOCK_MONOTONIC goes through the vDSO on Linux, so it's about as cheap as
+	// reading the TSC directly, but doesn't depend on it being invariant and synced.
+	struct timespec currentTime;
+	clock_gettime(CLOCK_MONOTONIC, &currentTime);
+
+	return ((U64T(currentTime.tv_sec) * 1000000000) + U64T(currentTime.tv_nsec));
+}
+
+void profilingAccount(struct profiling_stage *stage, uint64_t startTime) {
+	uint64_t elapsed = profilingTime() - startTime;
+
+	// Device stages are only written by their data acquisition thread, but the
+	// logging stage is shared by all threads that log. Atomic adds keep both exact,
+	// relaxed is enough: readers only need each counter to be consistent by itself.
+	atomic_fetch_add_explicit(&stage->calls, 1, memory_order_relaxed);
+	atomic_fetch_add_explicit(&stage->nanoseconds, elapsed, memory_order_relaxed);
+}
+
+#endif
+
+bool profilingGet(struct profiling_state *state, struct caer_device_profiling_stage *stages) {
+#if LIBCAER_HAVE_PROFILING == 1
+	for (size_t i = 0; i < CAER_DEVICE_PROFILING_STAGES; i++) {
+		struct profiling_stage *stage =
+			(i == CAER_DEVICE_PROFILING_LOGGING) ? (&profilingLogging) : (&state->stages[i]);
+
+		stages[i].calls = atomic_load_explicit(&stage->calls, memory_order_relaxed);
+		stages[i].nanoseconds = atomic_load_explicit(&stage->nanoseconds, memory_order_relaxed);
+	}
+
+	return (true);
+#else
+	// Profiling support not compiled in.
+	(void) state;
+	(void) stages;
+
+	return (false);
+#endif
+}
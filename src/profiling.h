@@ -0,0 +1,35 @@
+#ifndef LIBCAER_SRC_PROFILING_H_
+#define LIBCAER_SRC_PROFILING_H_
+
+#include "libcaer.h"
+#include "devices/usb.h"
+#include <stdatomic.h>
+
+struct profiling_stage {
+	atomic_uint_fast64_t calls;
+	atomic_uint_fast64_t nanoseconds;
+};
+
+struct profiling_state {
+	struct profiling_stage stages[CAER_DEVICE_PROFILING_STAGES];
+};
+
+// Logging is process-wide, not tied to any device.
+extern struct profiling_stage profilingLogging;
+
+#if LIBCAER_HAVE_PROFILING == 1
+	uint64_t profilingTime(void);
+	void profilingAccount(struct profiling_stage *stage, uint64_t startTime);
+
+	// Accumulate the time spent from PROFILING_START() to PROFILING_STOP() into STAGE.
+	// Both compile to nothing if profiling support is disabled.
+	#define PROFILING_START(NAME) uint64_t NAME = profilingTime()
+	#define PROFILING_STOP(STAGE, NAME) profilingAccount(&(STAGE), NAME)
+#else
+	#define PROFILING_START(NAME)
+	#define PROFILING_STOP(STAGE, NAME)
+#endif
+
+bool profilingGet(struct profiling_state *state, struct caer_device_profiling_stage *stages);
+
+#endif /* LIBCAER_SRC_PROFILING_H_ */
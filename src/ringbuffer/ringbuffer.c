@@ -22,11 +22,30 @@
 #define CACHELINE_ALIGNED alignas(CACHELINE_SIZE)
 #define CACHELINE_ALONE(t, v) CACHELINE_ALIGNED t v; uint8_t PAD_##v[CACHELINE_SIZE - (sizeof(t) & (CACHELINE_SIZE - 1))]
 
+// Single producer, multiple consumers: every slot carries a sequence number,
+// which tells for which put/get position the slot is ready. The producer owns
+// putPos, consumers claim positions by advancing getPos with CAS, so several
+// threads can get elements concurrently. Positions only ever increase, they
+// are masked when indexing the slots.
+struct ring_buffer_slot {
+	atomic_size_t sequence;
+	atomic_uintptr_t element;
+};
+
+// Regular puts always leave this many slots free for priority puts.
+#define RING_BUFFER_PRIORITY_SLOTS 1
+
+// Priority elements that find the buffer full wait here, in order, until
+// there is space again. Only touched by the producer.
+#define RING_BUFFER_PRIORITY_PENDING 8
+
 struct ring_buffer {
-	CACHELINE_ALONE(size_t, putPos);
-	CACHELINE_ALONE(size_t, getPos);
+	CACHELINE_ALONE(atomic_size_t, putPos);
+	CACHELINE_ALONE(atomic_size_t, getPos);
 	CACHELINE_ALONE(size_t, size);
-	atomic_uintptr_t elements[];
+	CACHELINE_ALIGNED void *priorityPending[RING_BUFFER_PRIORITY_PENDING];
+	size_t priorityPendingNumber;
+	struct ring_buffer_slot elements[];
 };
 
 RingBuffer ringBufferInit(size_t size) {
@@ -35,20 +54,29 @@ RingBuffer ringBufferInit(size_t size) {
 		return (NULL);
 	}
 
+	// Sequence numbers can't tell published and released slots apart with
+	// only one slot. Two slots, one reserved for priority puts, still hold
+	// one regular element at most.
+	if (size == 1) {
+		size = 2;
+	}
+
 	RingBuffer rBuf = portable_aligned_alloc(CACHELINE_SIZE,
-		sizeof(struct ring_buffer) + (size * sizeof(atomic_uintptr_t)));
+		sizeof(struct ring_buffer) + (size * sizeof(struct ring_buffer_slot)));
 	if (rBuf == NULL) {
 		return (NULL);
 	}
 
 	// Initialize counter variables.
-	rBuf->putPos = 0;
-	rBuf->getPos = 0;
+	atomic_store_explicit(&rBuf->putPos, 0, memory_order_relaxed);
+	atomic_store_explicit(&rBuf->getPos, 0, memory_order_relaxed);
 	rBuf->size = size;
+	rBuf->priorityPendingNumber = 0;
 
-	// Initialize pointers.
+	// Initialize slots, all ready for their first put.
 	for (size_t i = 0; i < size; i++) {
-		atomic_store_explicit(&rBuf->elements[i], (uintptr_t) NULL, memory_order_relaxed);
+		atomic_store_explicit(&rBuf->elements[i].sequence, i, memory_order_relaxed);
+		atomic_store_explicit(&rBuf->elements[i].element, (uintptr_t) NULL, memory_order_relaxed);
 	}
 
 	atomic_thread_fence(memory_order_release);
@@ -60,56 +88,188 @@ void ringBufferFree(RingBuffer rBuf) {
 	portable_aligned_free(rBuf);
 }
 
+static inline bool ringBufferPutSlot(RingBuffer rBuf, void *elem) {
+	size_t putPos = atomic_load_explicit(&rBuf->putPos, memory_order_relaxed);
+	struct ring_buffer_slot *slot = &rBuf->elements[putPos & (rBuf->size - 1)];
+
+	// If the slot where we want to put the new element was released by
+	// the consumer of the previous round, it's free and we can use it.
+	if (atomic_load_explicit(&slot->sequence, memory_order_acquire) == putPos) {
+		atomic_store_explicit(&slot->element, (uintptr_t) elem, memory_order_relaxed);
+
+		// Increase put pointer. Only the producer writes it, consumers
+		// just read it to know the usage.
+		atomic_store_explicit(&rBuf->putPos, putPos + 1, memory_order_relaxed);
+
+		// Publish element to consumers.
+		atomic_store_explicit(&slot->sequence, putPos + 1, memory_order_release);
+
+		return (true);
+	}
+
+	// Else, buffer is full.
+	return (false);
+}
+
 bool ringBufferPut(RingBuffer rBuf, void *elem) {
 	if (elem == NULL) {
-		// NULL elements are disallowed (used as place-holders).
+		// NULL elements are disallowed (used to signal an empty buffer).
 		// Critical error, should never happen -> exit!
 		exit(EXIT_FAILURE);
 	}
 
-	void *curr = (void *) atomic_load_explicit(&rBuf->elements[rBuf->putPos], memory_order_acquire);
+	// Pending priority elements go first, to keep the order of all elements.
+	if (!ringBufferFlush(rBuf)) {
+		return (false);
+	}
+
+	// Keep the reserved slots free for priority elements. Elements claimed by
+	// consumers, but not yet released, are caught by the slot check below.
+	if (rBuf->size > RING_BUFFER_PRIORITY_SLOTS
+		&& ringBufferUsage(rBuf) >= (rBuf->size - RING_BUFFER_PRIORITY_SLOTS)) {
+		return (false);
+	}
 
-	// If the place where we want to put the new element is NULL, it's still
-	// free and we can use it.
-	if (curr == NULL) {
-		atomic_store_explicit(&rBuf->elements[rBuf->putPos], (uintptr_t ) elem, memory_order_release);
+	return (ringBufferPutSlot(rBuf, elem));
+}
 
-		// Increase local put pointer.
-		rBuf->putPos = ((rBuf->putPos + 1) & (rBuf->size - 1));
+bool ringBufferPutPriority(RingBuffer rBuf, void *elem) {
+	if (elem == NULL) {
+		// NULL elements are disallowed (used to signal an empty buffer).
+		// Critical error, should never happen -> exit!
+		exit(EXIT_FAILURE);
+	}
 
+	if (ringBufferFlush(rBuf) && ringBufferPutSlot(rBuf, elem)) {
 		return (true);
 	}
 
-	// Else, buffer is full.
-	return (false);
+	// No free slot, not even a reserved one: wait in line for later flushes.
+	if (rBuf->priorityPendingNumber == RING_BUFFER_PRIORITY_PENDING) {
+		return (false);
+	}
+
+	rBuf->priorityPending[rBuf->priorityPendingNumber++] = elem;
+
+	return (true);
 }
 
-void *ringBufferGet(RingBuffer rBuf) {
-	void *curr = (void *) atomic_load_explicit(&rBuf->elements[rBuf->getPos], memory_order_acquire);
+bool ringBufferFlush(RingBuffer rBuf) {
+	size_t flushed = 0;
+
+	while (flushed < rBuf->priorityPendingNumber && ringBufferPutSlot(rBuf, rBuf->priorityPending[flushed])) {
+		flushed++;
+	}
+
+	if (flushed != 0) {
+		rBuf->priorityPendingNumber -= flushed;
+
+		// Move the remaining ones to the front, keeping their order.
+		for (size_t i = 0; i < rBuf->priorityPendingNumber; i++) {
+			rBuf->priorityPending[i] = rBuf->priorityPending[flushed + i];
+		}
+	}
 
-	// If the place where we want to get an element from is not NULL, there
-	// is valid content there, which we return, and reset the place to NULL.
-	if (curr != NULL) {
-		atomic_store_explicit(&rBuf->elements[rBuf->getPos], (uintptr_t) NULL, memory_order_release);
+	return (rBuf->priorityPendingNumber == 0);
+}
 
-		// Increase local get pointer.
-		rBuf->getPos = ((rBuf->getPos + 1) & (rBuf->size - 1));
+void *ringBufferGet(RingBuffer rBuf) {
+	void *elem = NULL;
 
-		return (curr);
+	if (ringBufferGetBatch(rBuf, &elem, 1) == 1) {
+		return (elem);
 	}
 
 	// Else, buffer is empty.
 	return (NULL);
 }
 
+size_t ringBufferGetBatch(RingBuffer rBuf, void **elems, size_t maxElems) {
+	size_t getPos = atomic_load_explicit(&rBuf->getPos, memory_order_relaxed);
+
+	while (true) {
+		// Count how many consecutive slots, starting at the get position,
+		// hold an element that was published for that position.
+		size_t available = 0;
+
+		while (available < maxElems && available < rBuf->size) {
+			struct ring_buffer_slot *slot = &rBuf->elements[(getPos + available) & (rBuf->size - 1)];
+
+			if (atomic_load_explicit(&slot->sequence, memory_order_acquire) != (getPos + available + 1)) {
+				break;
+			}
+
+			available++;
+		}
+
+		if (available == 0) {
+			size_t currGetPos = atomic_load_explicit(&rBuf->getPos, memory_order_relaxed);
+
+			// Other consumers took the elements we looked at, try again
+			// from the new position. Else, buffer is empty.
+			if (currGetPos != getPos) {
+				getPos = currGetPos;
+				continue;
+			}
+
+			return (0);
+		}
+
+		// Claim all of them at once. On failure another consumer was faster,
+		// getPos now holds the new position to try again from.
+		if (atomic_compare_exchange_weak_explicit(&rBuf->getPos, &getPos, getPos + available,
+			memory_order_relaxed, memory_order_relaxed)) {
+			for (size_t i = 0; i < available; i++) {
+				struct ring_buffer_slot *slot = &rBuf->elements[(getPos + i) & (rBuf->size - 1)];
+
+				elems[i] = (void *) atomic_load_explicit(&slot->element, memory_order_relaxed);
+
+				// Release the slot to the producer, for its next round.
+				atomic_store_explicit(&slot->sequence, getPos + i + rBuf->size, memory_order_release);
+			}
+
+			return (available);
+		}
+	}
+}
+
+size_t ringBufferUsage(RingBuffer rBuf) {
+	size_t getPos = atomic_load_explicit(&rBuf->getPos, memory_order_relaxed);
+	size_t putPos = atomic_load_explicit(&rBuf->putPos, memory_order_relaxed);
+
+	// The two loads aren't ordered with respect to the other threads' updates,
+	// so the difference can briefly be out of range: clamp it.
+	size_t usage = putPos - getPos;
+
+	if (usage > rBuf->size) {
+		return ((putPos < getPos) ? (0) : (rBuf->size));
+	}
+
+	return (usage);
+}
+
+size_t ringBufferSize(RingBuffer rBuf) {
+	return (rBuf->size);
+}
+
+size_t ringBufferPutCapacity(RingBuffer rBuf) {
+	if (rBuf->size > RING_BUFFER_PRIORITY_SLOTS) {
+		return (rBuf->size - RING_BUFFER_PRIORITY_SLOTS);
+	}
+
+	return (rBuf->size);
+}
+
 void *ringBufferLook(RingBuffer rBuf) {
-	void *curr = (void *) atomic_load_explicit(&rBuf->elements[rBuf->getPos], memory_order_acquire);
+	size_t getPos = atomic_load_explicit(&rBuf->getPos, memory_order_relaxed);
+	struct ring_buffer_slot *slot = &rBuf->elements[getPos & (rBuf->size - 1)];
 
-	// If the place where we want to get an element from is not NULL, there
-	// is valid content there, which we return, without removing it from the
-	// ring buffer.
-	if (curr != NULL) {
-		return (curr);
+	// If the slot where we want to get an element from was published for the
+	// current get position, there is valid content there, which we return,
+	// without removing it from the ring buffer. With multiple consumers, it
+	// may be gone by the time this returns.
+	if (atomic_load_explicit(&slot->sequence, memory_order_acquire) == (getPos + 1)) {
+		return ((void *) atomic_load_explicit(&slot->element, memory_order_relaxed));
 	}
 
 	// Else, buffer is empty.
@@ -13,12 +13,29 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+// Single producer, multiple consumers: Put(), PutPriority() and Flush() must only
+// ever be called from one thread, Get() and GetBatch() from any number of threads.
 typedef struct ring_buffer *RingBuffer;
 
 RingBuffer ringBufferInit(size_t size);
 void ringBufferFree(RingBuffer rBuf);
 bool ringBufferPut(RingBuffer rBuf, void *elem);
+// Never blocks and can use the slots regular puts leave free. If even those are
+// taken, the element waits, still in order, and enters on the next put or flush.
+// Fails only if too many elements are already waiting.
+bool ringBufferPutPriority(RingBuffer rBuf, void *elem);
+// Producer side: move waiting priority elements into the buffer.
+// Returns true if none are left waiting.
+bool ringBufferFlush(RingBuffer rBuf);
 void *ringBufferGet(RingBuffer rBuf);
+size_t ringBufferGetBatch(RingBuffer rBuf, void **elems, size_t maxElems);
+// Number of elements in the buffer, not yet claimed by consumers. Can be called
+// from any thread, and is only a snapshot when others are using the buffer.
+size_t ringBufferUsage(RingBuffer rBuf);
+// Number of slots, including the one reserved for priority puts.
+size_t ringBufferSize(RingBuffer rBuf);
+// Number of elements regular puts can fill the buffer up to.
+size_t ringBufferPutCapacity(RingBuffer rBuf);
 void *ringBufferLook(RingBuffer rBuf);
 
 #endif /* RINGBUFFER_H_ */
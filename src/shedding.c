@@ -0,0 +1,50 @@
+#include "shedding.h"
+
+bool sheddingApply(caerEventPacketContainer container, atomic_uint_fast8_t *levels, size_t levelsNumber,
+	RingBuffer rBuf) {
+	size_t size = ringBufferSize(rBuf);
+	size_t putCapacity = ringBufferPutCapacity(rBuf);
+	size_t usage = 0;
+	bool usageValid = false;
+	bool packetsLeft = false;
+
+	// Containers may have less positions than there are levels (Dynap-se spike splitting).
+	size_t packetsNumber = (size_t) caerEventPacketContainerGetEventPacketsNumber(container);
+	if (levelsNumber > packetsNumber) {
+		levelsNumber = packetsNumber;
+	}
+
+	for (size_t i = 0; i < levelsNumber; i++) {
+		caerEventPacketHeader packet = caerEventPacketContainerGetEventPacket(container, I32T(i));
+		if (packet == NULL) {
+			continue;
+		}
+
+		uint_fast8_t level = atomic_load_explicit(&levels[i], memory_order_relaxed);
+
+		if (level != 0) {
+			// Only look at the fill level if there is anything to shed.
+			if (!usageValid) {
+				usage = ringBufferUsage(rBuf);
+				usageValid = true;
+			}
+
+			// Regular puts can't fill all of the ring-buffer, cap the level in
+			// elements to what they can fill, so that 100 is reachable.
+			size_t levelElements = (((size_t) level * size) + 99) / 100;
+			if (levelElements > putCapacity) {
+				levelElements = putCapacity;
+			}
+
+			if (usage >= levelElements) {
+				caerEventPacketContainerSetEventPacket(container, I32T(i), NULL);
+				free(packet);
+				continue;
+			}
+		}
+
+		packetsLeft = true;
+	}
+
+	return (packetsLeft);
+}
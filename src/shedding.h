@@ -0,0 +1,17 @@
+#ifndef LIBCAER_SRC_SHEDDING_H_
+#define LIBCAER_SRC_SHEDDING_H_
+
+#include "libcaer.h"
+#include "events/packetContainer.h"
+#include "ringbuffer/ringbuffer.h"
+#include <stdatomic.h>
+
+// Remove the packets of a container, about to be put into a ring-buffer,
+// whose shedding level (in percent of the ring-buffer size, zero never sheds)
+// its fill level has reached. Levels are capped to what regular puts can fill.
+// Levels past the container's size are ignored.
+// Returns false if no packets are left.
+bool sheddingApply(caerEventPacketContainer container, atomic_uint_fast8_t *levels, size_t levelsNumber,
+	RingBuffer rBuf);
+
+#endif /* LIBCAER_SRC_SHEDDING_H_ */
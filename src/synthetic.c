@@ -0,0 +1,746 @@
+#include "synthetic.h"
+
+// Same container layout as DAVIS devices (sample position unused).
+#define SYNTHETIC_EVENT_TYPES 5
+#define SYNTHETIC_POLARITY_DEFAULT_SIZE 4096
+#define SYNTHETIC_SPECIAL_DEFAULT_SIZE 128
+#define SYNTHETIC_FRAME_DEFAULT_SIZE 4
+#define SYNTHETIC_IMU_DEFAULT_SIZE 64
+
+// Time between end of exposure and end of frame (ADC readout), in µs.
+#define SYNTHETIC_FRAME_READOUT 1000
+// Rates are given per second, time advances in µs.
+#define SYNTHETIC_RATE_DIVISOR 1000000
+#define SYNTHETIC_TS_OVERFLOW_SHIFT 31
+
+struct synthetic_pixel {
+	uint16_t x;
+	uint16_t y;
+};
+
+struct caer_synthetic_generator {
+	int16_t sourceID;
+	int16_t sizeX;
+	int16_t sizeY;
+	uint64_t randomState;
+	// Configuration.
+	uint32_t noiseRate;
+	uint32_t edgeRate;
+	uint32_t edgeSpeed;
+	uint32_t flickerPixelsNumber;
+	uint32_t flickerFrequency;
+	uint32_t hotPixelsNumber;
+	uint32_t hotPixelRate;
+	uint32_t imuRate;
+	uint32_t frameInterval;
+	uint32_t frameExposure;
+	// Fixed pixel positions, drawn when configured.
+	struct synthetic_pixel *flickerPixels;
+	struct synthetic_pixel *hotPixels;
+	// Generation state. Rate accumulators count in 1/SYNTHETIC_RATE_DIVISOR events.
+	int64_t currentTimestamp;
+	uint64_t noiseAccumulator;
+	uint64_t edgeAccumulator;
+	uint64_t edgeMoveAccumulator;
+	uint16_t edgePosition;
+	uint64_t hotPixelAccumulator;
+	uint64_t imuAccumulator;
+	// Start of the next (or current) frame, -1 if frames are disabled.
+	int64_t frameStart;
+	// Exposure of the current frame, latched at its start.
+	uint32_t currentFrameExposure;
+	uint32_t frameNumber;
+	// Timestamp reset pending, with the overflow counter of the time before it.
+	bool timestampReset;
+	int32_t timestampResetOverflow;
+	// Packets of the container being generated.
+	caerEventPacketHeader packets[SYNTHETIC_EVENT_TYPES];
+};
+
+static const char *syntheticString = "Synthetic Generator";
+
+static uint64_t syntheticRandom(caerSyntheticGenerator generator);
+static bool syntheticPixelsSet(caerSyntheticGenerator generator, struct synthetic_pixel **pixels, uint32_t number);
+static bool syntheticPacketReserve(caerSyntheticGenerator generator, enum caer_default_event_types type);
+static void syntheticPacketsFree(caerSyntheticGenerator generator);
+static bool syntheticPolarityEvent(caerSyntheticGenerator generator, int32_t timestamp, uint16_t x, uint16_t y,
+	bool polarity);
+static bool syntheticSpecialEvent(caerSyntheticGenerator generator, int32_t timestamp, enum caer_special_event_types type);
+static bool syntheticIMU6Event(caerSyntheticGenerator generator, int32_t timestamp);
+static bool syntheticFrameEvent(caerSyntheticGenerator generator, int32_t timestamp);
+static int64_t syntheticIdleTicks(caerSyntheticGenerator generator, int64_t fullTimestamp, int64_t end);
+static bool syntheticTick(caerSyntheticGenerator generator, int64_t fullTimestamp);
+static caerEventPacketContainer syntheticTimestampResetContainer(caerSyntheticGenerator generator);
+
+caerSyntheticGenerator caerSyntheticGeneratorCreate(int16_t sourceID, int16_t sizeX, int16_t sizeY, uint64_t seed) {
+	if (sourceID < 0 || sizeX <= 0 || sizeY <= 0) {
+		caerLog(CAER_LOG_ERROR, syntheticString, "Invalid arguments passed to synthetic generator creation.");
+		return (NULL);
+	}
+
+	caerSyntheticGenerator generator = calloc(1, sizeof(*generator));
+	if (generator == NULL) {
+		caerLog(CAER_LOG_CRITICAL, syntheticString, "Failed to allocate synthetic generator memory.");
+		return (NULL);
+	}
+
+	generator->sourceID = sourceID;
+	generator->sizeX = sizeX;
+	generator->sizeY = sizeY;
+
+	// xorshift state must never be zero.
+	generator->randomState = (seed != 0) ? (seed) : (0x2545F4914F6CDD1DULL);
+
+	generator->edgeSpeed = 100;
+	generator->flickerFrequency = 100;
+	generator->hotPixelRate = 1000;
+	generator->frameExposure = 4000;
+	generator->frameStart = -1;
+
+	return (generator);
+}
+
+void caerSyntheticGeneratorFree(caerSyntheticGenerator generator) {
+	if (generator == NULL) {
+		return;
+	}
+
+	syntheticPacketsFree(generator);
+
+	free(generator->flickerPixels);
+	free(generator->hotPixels);
+
+	free(generator);
+}
+
+bool caerSyntheticGeneratorConfigSet(caerSyntheticGenerator generator, uint8_t paramAddr, uint32_t param) {
+	if (generator == NULL) {
+		return (false);
+	}
+
+	switch (paramAddr) {
+		case CAER_SYNTHETIC_NOISE_RATE:
+			generator->noiseRate = param;
+			break;
+
+		case CAER_SYNTHETIC_EDGE_RATE:
+			generator->edgeRate = param;
+			break;
+
+		case CAER_SYNTHETIC_EDGE_SPEED:
+			generator->edgeSpeed = param;
+			break;
+
+		case CAER_SYNTHETIC_FLICKER_PIXELS:
+			if (!syntheticPixelsSet(generator, &generator->flickerPixels, param)) {
+				return (false);
+			}
+
+			generator->flickerPixelsNumber = param;
+			break;
+
+		case CAER_SYNTHETIC_FLICKER_FREQUENCY:
+			// Need at least one µs between toggles.
+			if (param == 0 || param > (SYNTHETIC_RATE_DIVISOR / 2)) {
+				return (false);
+			}
+
+			generator->flickerFrequency = param;
+			break;
+
+		case CAER_SYNTHETIC_HOT_PIXELS:
+			if (!syntheticPixelsSet(generator, &generator->hotPixels, param)) {
+				return (false);
+			}
+
+			generator->hotPixelsNumber = param;
+			break;
+
+		case CAER_SYNTHETIC_HOT_PIXEL_RATE:
+			generator->hotPixelRate = param;
+			break;
+
+		case CAER_SYNTHETIC_IMU_RATE:
+			generator->imuRate = param;
+			break;
+
+		case CAER_SYNTHETIC_FRAME_INTERVAL:
+			if (param > INT32_MAX) {
+				return (false);
+			}
+
+			generator->frameInterval = param;
+
+			// First frame starts right away.
+			generator->frameStart = (param != 0) ? (generator->currentTimestamp) : (-1);
+			break;
+
+		case CAER_SYNTHETIC_FRAME_EXPOSURE:
+			if (param > INT32_MAX) {
+				return (false);
+			}
+
+			generator->frameExposure = param;
+			break;
+
+		default:
+			return (false);
+	}
+
+	return (true);
+}
+
+bool caerSyntheticGeneratorConfigGet(caerSyntheticGenerator generator, uint8_t paramAddr, uint32_t *param) {
+	if (generator == NULL || param == NULL) {
+		return (false);
+	}
+
+	switch (paramAddr) {
+		case CAER_SYNTHETIC_NOISE_RATE:
+			*param = generator->noiseRate;
+			break;
+
+		case CAER_SYNTHETIC_EDGE_RATE:
+			*param = generator->edgeRate;
+			break;
+
+		case CAER_SYNTHETIC_EDGE_SPEED:
+			*param = generator->edgeSpeed;
+			break;
+
+		case CAER_SYNTHETIC_FLICKER_PIXELS:
+			*param = generator->flickerPixelsNumber;
+			break;
+
+		case CAER_SYNTHETIC_FLICKER_FREQUENCY:
+			*param = generator->flickerFrequency;
+			break;
+
+		case CAER_SYNTHETIC_HOT_PIXELS:
+			*param = generator->hotPixelsNumber;
+			break;
+
+		case CAER_SYNTHETIC_HOT_PIXEL_RATE:
+			*param = generator->hotPixelRate;
+			break;
+
+		case CAER_SYNTHETIC_IMU_RATE:
+			*param = generator->imuRate;
+			break;
+
+		case CAER_SYNTHETIC_FRAME_INTERVAL:
+			*param = generator->frameInterval;
+			break;
+
+		case CAER_SYNTHETIC_FRAME_EXPOSURE:
+			*param = generator->frameExposure;
+			break;
+
+		default:
+			return (false);
+	}
+
+	return (true);
+}
+
+caerEventPacketContainer caerSyntheticGeneratorDataGet(caerSyntheticGenerator generator, int32_t interval) {
+	if (generator == NULL || interval <= 0) {
+		return (NULL);
+	}
+
+	// Timestamp reset is always sent alone, like devices do.
+	if (generator->timestampReset) {
+		generator->timestampReset = false;
+
+		return (syntheticTimestampResetContainer(generator));
+	}
+
+	int64_t start = generator->currentTimestamp;
+	int64_t end = start + interval;
+
+	// Never cross a timestamp overflow, so that all packets share one tsOverflow value.
+	int64_t overflowEnd = ((start >> SYNTHETIC_TS_OVERFLOW_SHIFT) + 1) << SYNTHETIC_TS_OVERFLOW_SHIFT;
+	bool tsBigWrap = false;
+
+	if (end >= overflowEnd) {
+		end = overflowEnd;
+		tsBigWrap = true;
+	}
+
+	for (int64_t t = start; t < end;) {
+		// Jump over stretches of time without events, for sparse workloads.
+		int64_t idleTicks = syntheticIdleTicks(generator, t, end);
+		if (idleTicks > 0) {
+			t += idleTicks;
+			continue;
+		}
+
+		if (!syntheticTick(generator, t)) {
+			syntheticPacketsFree(generator);
+			return (NULL);
+		}
+
+		t++;
+	}
+
+	// Informative only, the next packets carry the incremented tsOverflow.
+	if (tsBigWrap && !syntheticSpecialEvent(generator, INT32_MAX, TIMESTAMP_WRAP)) {
+		syntheticPacketsFree(generator);
+		return (NULL);
+	}
+
+	generator->currentTimestamp = end;
+
+	bool haveEvents = false;
+
+	for (size_t i = 0; i < SYNTHETIC_EVENT_TYPES; i++) {
+		if (generator->packets[i] != NULL) {
+			haveEvents = true;
+			break;
+		}
+	}
+
+	if (!haveEvents) {
+		return (NULL);
+	}
+
+	caerEventPacketContainer container = caerEventPacketContainerAllocate(SYNTHETIC_EVENT_TYPES);
+	if (container == NULL) {
+		syntheticPacketsFree(generator);
+
+		caerLog(CAER_LOG_CRITICAL, syntheticString, "Failed to allocate synthetic packet container.");
+		return (NULL);
+	}
+
+	for (size_t i = 0; i < SYNTHETIC_EVENT_TYPES; i++) {
+		caerEventPacketContainerSetEventPacket(container, I32T(i), generator->packets[i]);
+		generator->packets[i] = NULL;
+	}
+
+	return (container);
+}
+
+void caerSyntheticGeneratorTimestampReset(caerSyntheticGenerator generator) {
+	if (generator == NULL) {
+		return;
+	}
+
+	generator->timestampReset = true;
+	generator->timestampResetOverflow = I32T(generator->currentTimestamp >> SYNTHETIC_TS_OVERFLOW_SHIFT);
+
+	generator->currentTimestamp = 0;
+
+	// Frames in progress are lost, like on devices.
+	if (generator->frameStart != -1) {
+		generator->frameStart = 0;
+	}
+}
+
+int64_t caerSyntheticGeneratorGetTimestamp(caerSyntheticGenerator generator) {
+	if (generator == NULL) {
+		return (-1);
+	}
+
+	return (generator->currentTimestamp);
+}
+
+// xorshift64*, fast and good enough for workload generation.
+static uint64_t syntheticRandom(caerSyntheticGenerator generator) {
+	generator->randomState ^= generator->randomState >> 12;
+	generator->randomState ^= generator->randomState << 25;
+	generator->randomState ^= generator->randomState >> 27;
+
+	return (generator->randomState * 0x2545F4914F6CDD1DULL);
+}
+
+static bool syntheticPixelsSet(caerSyntheticGenerator generator, struct synthetic_pixel **pixels, uint32_t number) {
+	if (number > (U32T(generator->sizeX) * U32T(generator->sizeY))) {
+		return (false);
+	}
+
+	struct synthetic_pixel *newPixels = NULL;
+
+	if (number != 0) {
+		newPixels = malloc(number * sizeof(struct synthetic_pixel));
+		if (newPixels == NULL) {
+			caerLog(CAER_LOG_CRITICAL, syntheticString, "Failed to allocate memory for %" PRIu32 " pixels.", number);
+			return (false);
+		}
+
+		for (size_t i = 0; i < number; i++) {
+			newPixels[i].x = U16T(syntheticRandom(generator) % U16T(generator->sizeX));
+			newPixels[i].y = U16T(syntheticRandom(generator) % U16T(generator->sizeY));
+		}
+	}
+
+	free(*pixels);
+	*pixels = newPixels;
+
+	return (true);
+}
+
+// Make sure the packet of the given type exists and has room for one more event.
+static bool syntheticPacketReserve(caerSyntheticGenerator generator, enum caer_default_event_types type) {
+	caerEventPacketHeader packet = generator->packets[type];
+
+	if (packet == NULL) {
+		int32_t tsOverflow = I32T(generator->currentTimestamp >> SYNTHETIC_TS_OVERFLOW_SHIFT);
+
+		switch (type) {
+			case SPECIAL_EVENT:
+				packet = (caerEventPacketHeader) caerSpecialEventPacketAllocate(SYNTHETIC_SPECIAL_DEFAULT_SIZE,
+					generator->sourceID, tsOverflow);
+				break;
+
+			case POLARITY_EVENT:
+				packet = (caerEventPacketHeader) caerPolarityEventPacketAllocate(SYNTHETIC_POLARITY_DEFAULT_SIZE,
+					generator->sourceID, tsOverflow);
+				break;
+
+			case FRAME_EVENT:
+				packet = (caerEventPacketHeader) caerFrameEventPacketAllocate(SYNTHETIC_FRAME_DEFAULT_SIZE,
+					generator->sourceID, tsOverflow, generator->sizeX, generator->sizeY, GRAYSCALE);
+				break;
+
+			case IMU6_EVENT:
+				packet = (caerEventPacketHeader) caerIMU6EventPacketAllocate(SYNTHETIC_IMU_DEFAULT_SIZE,
+					generator->sourceID, tsOverflow);
+				break;
+
+			default:
+				break;
+		}
+
+		if (packet == NULL) {
+			caerLog(CAER_LOG_CRITICAL, syntheticString, "Failed to allocate event packet of type %d.", type);
+			return (false);
+		}
+
+		generator->packets[type] = packet;
+	}
+	else if (caerEventPacketHeaderGetEventNumber(packet) == caerEventPacketHeaderGetEventCapacity(packet)) {
+		packet = caerEventPacketGrow(packet, caerEventPacketHeaderGetEventCapacity(packet) * 2);
+		if (packet == NULL) {
+			caerLog(CAER_LOG_CRITICAL, syntheticString, "Failed to grow event packet of type %d.", type);
+			return (false);
+		}
+
+		generator->packets[type] = packet;
+	}
+
+	return (true);
+}
+
+static void syntheticPacketsFree(caerSyntheticGenerator generator) {
+	for (size_t i = 0; i < SYNTHETIC_EVENT_TYPES; i++) {
+		free(generator->packets[i]);
+		generator->packets[i] = NULL;
+	}
+}
+
+static bool syntheticPolarityEvent(caerSyntheticGenerator generator, int32_t timestamp, uint16_t x, uint16_t y,
+	bool polarity) {
+	if (!syntheticPacketReserve(generator, POLARITY_EVENT)) {
+		return (false);
+	}
+
+	caerPolarityEventPacket packet = (caerPolarityEventPacket) generator->packets[POLARITY_EVENT];
+	caerPolarityEvent event = caerPolarityEventPacketGetEvent(packet,
+		caerEventPacketHeaderGetEventNumber(&packet->packetHeader));
+
+	caerPolarityEventSetTimestamp(event, timestamp);
+	caerPolarityEventSetPolarity(event, polarity);
+	caerPolarityEventSetY(event, y);
+	caerPolarityEventSetX(event, x);
+	caerPolarityEventValidate(event, packet);
+
+	return (true);
+}
+
+static bool syntheticSpecialEvent(caerSyntheticGenerator generator, int32_t timestamp, enum caer_special_event_types type) {
+	if (!syntheticPacketReserve(generator, SPECIAL_EVENT)) {
+		return (false);
+	}
+
+	caerSpecialEventPacket packet = (caerSpecialEventPacket) generator->packets[SPECIAL_EVENT];
+	caerSpecialEvent event = caerSpecialEventPacketGetEvent(packet,
+		caerEventPacketHeaderGetEventNumber(&packet->packetHeader));
+
+	caerSpecialEventSetTimestamp(event, timestamp);
+	caerSpecialEventSetType(event, type);
+	caerSpecialEventValidate(event, packet);
+
+	return (true);
+}
+
+// Device lying flat and still: 1g on Z, no rotation.
+static bool syntheticIMU6Event(caerSyntheticGenerator generator, int32_t timestamp) {
+	if (!syntheticPacketReserve(generator, IMU6_EVENT)) {
+		return (false);
+	}
+
+	caerIMU6EventPacket packet = (caerIMU6EventPacket) generator->packets[IMU6_EVENT];
+	caerIMU6Event event = caerIMU6EventPacketGetEvent(packet, caerEventPacketHeaderGetEventNumber(&packet->packetHeader));
+
+	caerIMU6EventSetTimestamp(event, timestamp);
+	caerIMU6EventSetAccelX(event, 0.0f);
+	caerIMU6EventSetAccelY(event, 0.0f);
+	caerIMU6EventSetAccelZ(event, 1.0f);
+	caerIMU6EventSetGyroX(event, 0.0f);
+	caerIMU6EventSetGyroY(event, 0.0f);
+	caerIMU6EventSetGyroZ(event, 0.0f);
+	caerIMU6EventSetTemp(event, 30.0f);
+	caerIMU6EventValidate(event, packet);
+
+	return (true);
+}
+
+// Full-size grayscale frame with a diagonal gradient that shifts every frame.
+static bool syntheticFrameEvent(caerSyntheticGenerator generator, int32_t timestamp) {
+	if (!syntheticPacketReserve(generator, FRAME_EVENT)) {
+		return (false);
+	}
+
+	caerFrameEventPacket packet = (caerFrameEventPacket) generator->packets[FRAME_EVENT];
+	caerFrameEvent event = caerFrameEventPacketGetEvent(packet,
+		caerEventPacketHeaderGetEventNumber(&packet->packetHeader));
+
+	int32_t startOfFrame = I32T(generator->frameStart & INT32_MAX);
+
+	caerFrameEventSetColorFilter(event, MONO);
+	caerFrameEventSetROIIdentifier(event, 0);
+	caerFrameEventSetLengthXLengthYChannelNumber(event, generator->sizeX, generator->sizeY, GRAYSCALE, packet);
+	caerFrameEventSetPositionX(event, 0);
+	caerFrameEventSetPositionY(event, 0);
+
+	caerFrameEventSetTSStartOfFrame(event, startOfFrame);
+	caerFrameEventSetTSStartOfExposure(event, startOfFrame);
+	caerFrameEventSetTSEndOfExposure(event, startOfFrame + I32T(generator->currentFrameExposure));
+	caerFrameEventSetTSEndOfFrame(event, timestamp);
+
+	uint16_t *pixels = caerFrameEventGetPixelArrayUnsafe(event);
+
+	for (size_t y = 0; y < (size_t) generator->sizeY; y++) {
+		for (size_t x = 0; x < (size_t) generator->sizeX; x++) {
+			pixels[(y * (size_t) generator->sizeX) + x] = htole16(U16T((x + y + generator->frameNumber) << 8));
+		}
+	}
+
+	caerFrameEventValidate(event, packet);
+
+	generator->frameNumber++;
+
+	return (true);
+}
+
+static inline int64_t syntheticAccumulatorIdleTicks(uint64_t accumulator, uint64_t rate, int64_t idleTicks) {
+	if (rate == 0) {
+		return (idleTicks);
+	}
+
+	// Next event at the first tick where accumulator + (ticks * rate) reaches the divisor.
+	int64_t ticks = I64T(((SYNTHETIC_RATE_DIVISOR - accumulator) + rate - 1) / rate) - 1;
+
+	return ((ticks < idleTicks) ? (ticks) : (idleTicks));
+}
+
+// Number of ticks from fullTimestamp on (up to end) that generate no events at all.
+// Advances the generation state over them, as if they had been ticked one by one.
+static int64_t syntheticIdleTicks(caerSyntheticGenerator generator, int64_t fullTimestamp, int64_t end) {
+	int64_t idleTicks = end - fullTimestamp;
+
+	uint64_t hotPixelRate = U64T(generator->hotPixelRate) * generator->hotPixelsNumber;
+
+	idleTicks = syntheticAccumulatorIdleTicks(generator->noiseAccumulator, generator->noiseRate, idleTicks);
+	idleTicks = syntheticAccumulatorIdleTicks(generator->edgeAccumulator, generator->edgeRate, idleTicks);
+	idleTicks = syntheticAccumulatorIdleTicks(generator->hotPixelAccumulator, hotPixelRate, idleTicks);
+	idleTicks = syntheticAccumulatorIdleTicks(generator->imuAccumulator, generator->imuRate, idleTicks);
+
+	if (generator->flickerPixelsNumber != 0) {
+		int64_t halfPeriod = (SYNTHETIC_RATE_DIVISOR / 2) / generator->flickerFrequency;
+		int64_t ticks = (halfPeriod - (fullTimestamp % halfPeriod)) % halfPeriod;
+
+		if (ticks < idleTicks) {
+			idleTicks = ticks;
+		}
+	}
+
+	if (generator->frameStart != -1) {
+		int64_t frameEvents[3] = { generator->frameStart, generator->frameStart + generator->currentFrameExposure,
+			generator->frameStart + generator->currentFrameExposure + SYNTHETIC_FRAME_READOUT };
+
+		for (size_t i = 0; i < 3; i++) {
+			if (frameEvents[i] >= fullTimestamp && (frameEvents[i] - fullTimestamp) < idleTicks) {
+				idleTicks = frameEvents[i] - fullTimestamp;
+			}
+		}
+	}
+
+	if (idleTicks <= 0) {
+		return (0);
+	}
+
+	// Accumulators stay below the divisor by construction.
+	generator->noiseAccumulator += U64T(idleTicks) * generator->noiseRate;
+	generator->edgeAccumulator += U64T(idleTicks) * generator->edgeRate;
+	generator->hotPixelAccumulator += U64T(idleTicks) * hotPixelRate;
+	generator->imuAccumulator += U64T(idleTicks) * generator->imuRate;
+
+	generator->edgeMoveAccumulator += U64T(idleTicks) * generator->edgeSpeed;
+	generator->edgePosition = U16T(
+		(generator->edgePosition + (generator->edgeMoveAccumulator / SYNTHETIC_RATE_DIVISOR)) % U16T(generator->sizeX));
+	generator->edgeMoveAccumulator %= SYNTHETIC_RATE_DIVISOR;
+
+	return (idleTicks);
+}
+
+// Generate all events for one µs, in the order the DAVIS translator produces them.
+static bool syntheticTick(caerSyntheticGenerator generator, int64_t fullTimestamp) {
+	int32_t timestamp = I32T(fullTimestamp & INT32_MAX);
+
+	// Frame start and exposure.
+	if (fullTimestamp == generator->frameStart) {
+		int64_t frameEnd = generator->frameStart + generator->frameExposure + SYNTHETIC_FRAME_READOUT;
+
+		generator->currentFrameExposure = generator->frameExposure;
+
+		if ((frameEnd >> SYNTHETIC_TS_OVERFLOW_SHIFT) != (fullTimestamp >> SYNTHETIC_TS_OVERFLOW_SHIFT)) {
+			// Would straddle a timestamp overflow, skip this frame.
+			generator->frameStart += generator->frameInterval;
+		}
+		else {
+			if (!syntheticSpecialEvent(generator, timestamp, APS_FRAME_START)
+				|| !syntheticSpecialEvent(generator, timestamp, APS_EXPOSURE_START)) {
+				return (false);
+			}
+		}
+	}
+
+	if (generator->frameStart != -1 && fullTimestamp == (generator->frameStart + generator->currentFrameExposure)) {
+		if (!syntheticSpecialEvent(generator, timestamp, APS_EXPOSURE_END)) {
+			return (false);
+		}
+	}
+
+	// Noise: random pixels, random polarity.
+	generator->noiseAccumulator += generator->noiseRate;
+
+	while (generator->noiseAccumulator >= SYNTHETIC_RATE_DIVISOR) {
+		generator->noiseAccumulator -= SYNTHETIC_RATE_DIVISOR;
+
+		uint64_t random = syntheticRandom(generator);
+
+		if (!syntheticPolarityEvent(generator, timestamp, U16T((random >> 32) % U16T(generator->sizeX)),
+			U16T((random >> 8) % U16T(generator->sizeY)), (random & 0x01))) {
+			return (false);
+		}
+	}
+
+	// Moving edge: vertical ON edge, random rows.
+	generator->edgeMoveAccumulator += generator->edgeSpeed;
+
+	while (generator->edgeMoveAccumulator >= SYNTHETIC_RATE_DIVISOR) {
+		generator->edgeMoveAccumulator -= SYNTHETIC_RATE_DIVISOR;
+
+		generator->edgePosition = U16T((generator->edgePosition + 1) % U16T(generator->sizeX));
+	}
+
+	generator->edgeAccumulator += generator->edgeRate;
+
+	while (generator->edgeAccumulator >= SYNTHETIC_RATE_DIVISOR) {
+		generator->edgeAccumulator -= SYNTHETIC_RATE_DIVISOR;
+
+		if (!syntheticPolarityEvent(generator, timestamp, generator->edgePosition,
+			U16T(syntheticRandom(generator) % U16T(generator->sizeY)), true)) {
+			return (false);
+		}
+	}
+
+	// Flicker: all pixels toggle together, every half period.
+	if (generator->flickerPixelsNumber != 0) {
+		int64_t halfPeriod = (SYNTHETIC_RATE_DIVISOR / 2) / generator->flickerFrequency;
+
+		if ((fullTimestamp % halfPeriod) == 0) {
+			bool polarity = (((fullTimestamp / halfPeriod) & 0x01) == 0);
+
+			for (size_t i = 0; i < generator->flickerPixelsNumber; i++) {
+				if (!syntheticPolarityEvent(generator, timestamp, generator->flickerPixels[i].x,
+					generator->flickerPixels[i].y, polarity)) {
+					return (false);
+				}
+			}
+		}
+	}
+
+	// Hot pixels: combined rate, spread randomly over the hot pixels.
+	if (generator->hotPixelsNumber != 0) {
+		generator->hotPixelAccumulator += U64T(generator->hotPixelRate) * generator->hotPixelsNumber;
+
+		while (generator->hotPixelAccumulator >= SYNTHETIC_RATE_DIVISOR) {
+			generator->hotPixelAccumulator -= SYNTHETIC_RATE_DIVISOR;
+
+			uint64_t random = syntheticRandom(generator);
+			struct synthetic_pixel *pixel = &generator->hotPixels[(random >> 8) % generator->hotPixelsNumber];
+
+			if (!syntheticPolarityEvent(generator, timestamp, pixel->x, pixel->y, (random & 0x01))) {
+				return (false);
+			}
+		}
+	}
+
+	// IMU: fixed rate samples.
+	generator->imuAccumulator += generator->imuRate;
+
+	while (generator->imuAccumulator >= SYNTHETIC_RATE_DIVISOR) {
+		generator->imuAccumulator -= SYNTHETIC_RATE_DIVISOR;
+
+		if (!syntheticIMU6Event(generator, timestamp)) {
+			return (false);
+		}
+	}
+
+	// Frame end: readout done, emit the frame and schedule the next one.
+	if (generator->frameStart != -1
+		&& fullTimestamp
+			== (generator->frameStart + generator->currentFrameExposure + SYNTHETIC_FRAME_READOUT)) {
+		if (!syntheticSpecialEvent(generator, timestamp, APS_FRAME_END)
+			|| !syntheticFrameEvent(generator, timestamp)) {
+			return (false);
+		}
+
+		generator->frameStart += generator->frameInterval;
+
+		// Frames can't overlap, start the next one right after if the interval is too short.
+		if (generator->frameStart <= fullTimestamp) {
+			generator->frameStart = fullTimestamp + 1;
+		}
+	}
+
+	return (true);
+}
+
+static caerEventPacketContainer syntheticTimestampResetContainer(caerSyntheticGenerator generator) {
+	caerEventPacketContainer tsResetContainer = caerEventPacketContainerAllocate(SYNTHETIC_EVENT_TYPES);
+	if (tsResetContainer == NULL) {
+		caerLog(CAER_LOG_CRITICAL, syntheticString, "Failed to allocate tsReset event packet container.");
+		return (NULL);
+	}
+
+	caerSpecialEventPacket tsResetPacket = caerSpecialEventPacketAllocate(1, generator->sourceID,
+		generator->timestampResetOverflow);
+	if (tsResetPacket == NULL) {
+		caerEventPacketContainerFree(tsResetContainer);
+
+		caerLog(CAER_LOG_CRITICAL, syntheticString, "Failed to allocate tsReset special event packet.");
+		return (NULL);
+	}
+
+	caerSpecialEvent tsResetEvent = caerSpecialEventPacketGetEvent(tsResetPacket, 0);
+	caerSpecialEventSetTimestamp(tsResetEvent, INT32_MAX);
+	caerSpecialEventSetType(tsResetEvent, TIMESTAMP_RESET);
+	caerSpecialEventValidate(tsResetEvent, tsResetPacket);
+
+	caerEventPacketContainerSetEventPacket(tsResetContainer, SPECIAL_EVENT, (caerEventPacketHeader) tsResetPacket);
+
+	return (tsResetContainer);
+}
@@ -1,6 +1,24 @@
 #include "usb_utils.h"
+#include "devices/usb.h"
+#include <stdatomic.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(HAVE_PTHREADS)
+	#include "c11threads_posix.h"
+#endif
+
+#if defined(OS_UNIX)
+	#include <sys/mman.h>
+#endif
 
 void LIBUSB_CALL usbLibUsbCallback(struct libusb_transfer *transfer);
+static void usbDataTransfer(usbState state, uint8_t *buffer, size_t length);
+static void usbCapturePut(usbState state, const uint8_t *buffer, size_t length);
+static size_t usbCaptureBufferCopy(usbState state, size_t position, const uint8_t *data, size_t length);
+static int usbCaptureWriterThread(void *inPtr);
+static bool usbCaptureWrite(int fd, const uint8_t *data, size_t length);
+static size_t usbCaptureRead(int fd, uint8_t *data, size_t length);
 
 struct usb_info usbGenerateInfo(libusb_device_handle *devHandle, const char *deviceName, uint16_t deviceID) {
 	// At this point we can get some more precise data on the device and update
@@ -258,6 +276,7 @@ void usbAllocateTransfers(usbState state, uint32_t bufferNum, uint32_t bufferSiz
 
 		if ((errno = libusb_submit_transfer(state->dataTransfers[i])) == LIBUSB_SUCCESS) {
 			state->activeDataTransfers++;
+			memoryUsageAdd(&state->memoryUsage, CAER_DEVICE_MEMORY_USB_TRANSFERS, bufferSize);
 		}
 		else {
 			caerLog(CAER_LOG_CRITICAL, __func__, "Unable to submit libusb transfer %zu. Error: %s (%d).", i,
@@ -309,17 +328,30 @@ void usbDeallocateTransfers(usbState state) {
 	state->dataTransfersLength = 0;
 }
 
+int64_t usbHostTime(void) {
+	struct timespec currentTime;
+	clock_gettime(CLOCK_MONOTONIC, &currentTime);
+
+	return ((I64T(currentTime.tv_sec) * 1000000) + (I64T(currentTime.tv_nsec) / 1000));
+}
+
 void LIBUSB_CALL usbLibUsbCallback(struct libusb_transfer *transfer) {
 	usbState state = transfer->user_data;
 
+	PROFILING_START(callbackStart);
+
 	if (transfer->status == LIBUSB_TRANSFER_COMPLETED) {
+		// Remember completion time for device to host clock correlation.
+		state->dataTransferTime = usbHostTime();
+
 		// Handle data.
-		(*state->userCallback)(state->userData, transfer->buffer, (size_t) transfer->actual_length);
+		usbDataTransfer(state, transfer->buffer, (size_t) transfer->actual_length);
 	}
 
 	if (transfer->status != LIBUSB_TRANSFER_CANCELLED && transfer->status != LIBUSB_TRANSFER_NO_DEVICE) {
 		// Submit transfer again.
 		if (libusb_submit_transfer(transfer) == LIBUSB_SUCCESS) {
+			PROFILING_STOP(state->profiling.stages[CAER_DEVICE_PROFILING_USB_CALLBACK], callbackStart);
 			return;
 		}
 	}
@@ -327,6 +359,7 @@ void LIBUSB_CALL usbLibUsbCallback(struct libusb_transfer *transfer) {
 	// Cannot recover (cancelled, no device, or other critical error).
 	// Signal this by adjusting the counter, free and exit.
 	state->activeDataTransfers--;
+	memoryUsageRemove(&state->memoryUsage, CAER_DEVICE_MEMORY_USB_TRANSFERS, (size_t) transfer->length);
 	for (size_t i = 0; i < state->dataTransfersLength; i++) {
 		// Remove from list, so we don't try to cancel it later on.
 		if (state->dataTransfers[i] == transfer) {
@@ -335,3 +368,580 @@ void LIBUSB_CALL usbLibUsbCallback(struct libusb_transfer *transfer) {
 	}
 	libusb_free_transfer(transfer);
 }
+
+static void usbDataTransfer(usbState state, uint8_t *buffer, size_t length) {
+	if (state->capture) {
+		if (atomic_load_explicit(&state->captureWriteFailed, memory_order_relaxed)) {
+			// Writer thread gave up: stop capturing, but keep the data flowing.
+			state->capture = false;
+		}
+		else {
+			usbCapturePut(state, buffer, length);
+
+			if (!state->captureTranslate) {
+				return;
+			}
+		}
+	}
+
+	PROFILING_START(translatorStart);
+
+	(*state->userCallback)(state->userData, buffer, length);
+
+	PROFILING_STOP(state->profiling.stages[CAER_DEVICE_PROFILING_TRANSLATOR], translatorStart);
+}
+
+// Copy a data transfer into the capture buffer, never waiting for the writer
+// thread: if there is no room left, the whole transfer is dropped.
+static void usbCapturePut(usbState state, const uint8_t *buffer, size_t length) {
+	uint8_t recordHeader[USB_CAPTURE_RECORD_HEADER_SIZE];
+
+	uint64_t timeLE = htole64(U64T(state->dataTransferTime));
+	uint32_t lengthLE = htole32(U32T(length));
+	memcpy(recordHeader, &timeLE, sizeof(timeLE));
+	memcpy(recordHeader + sizeof(timeLE), &lengthLE, sizeof(lengthLE));
+
+	mtx_lock(&state->captureLock);
+
+	if ((USB_CAPTURE_RECORD_HEADER_SIZE + length) > (USB_CAPTURE_BUFFER_SIZE - state->captureBufferUsed)) {
+		state->captureDroppedTransfers++;
+
+		mtx_unlock(&state->captureLock);
+		return;
+	}
+
+	size_t position = (state->captureBufferHead + state->captureBufferUsed) % USB_CAPTURE_BUFFER_SIZE;
+	position = usbCaptureBufferCopy(state, position, recordHeader, USB_CAPTURE_RECORD_HEADER_SIZE);
+	usbCaptureBufferCopy(state, position, buffer, length);
+
+	state->captureBufferUsed += USB_CAPTURE_RECORD_HEADER_SIZE + length;
+
+	mtx_unlock(&state->captureLock);
+}
+
+// Copy data into the capture buffer at position, wrapping around at its end.
+// Returns the position following the data.
+static size_t usbCaptureBufferCopy(usbState state, size_t position, const uint8_t *data, size_t length) {
+	size_t firstLength = USB_CAPTURE_BUFFER_SIZE - position;
+	if (firstLength > length) {
+		firstLength = length;
+	}
+
+	memcpy(state->captureBuffer + position, data, firstLength);
+	memcpy(state->captureBuffer, data + firstLength, length - firstLength);
+
+	return ((position + length) % USB_CAPTURE_BUFFER_SIZE);
+}
+
+static int usbCaptureWriterThread(void *inPtr) {
+	usbState state = inPtr;
+
+	thrd_set_name(USB_CAPTURE_THREAD_NAME);
+
+	while (true) {
+		mtx_lock(&state->captureLock);
+
+		// Buffered data up to the end of the buffer, the rest follows on the next round.
+		size_t position = state->captureBufferHead;
+		size_t length = state->captureBufferUsed;
+		if (length > (USB_CAPTURE_BUFFER_SIZE - position)) {
+			length = USB_CAPTURE_BUFFER_SIZE - position;
+		}
+
+		mtx_unlock(&state->captureLock);
+
+		if (length == 0) {
+			// Only exit once everything captured so far is written out.
+			if (!atomic_load(&state->captureWriterRun)) {
+				break;
+			}
+
+			// Nothing to write, wait for more data.
+			struct timespec noDataSleep = { .tv_sec = 0, .tv_nsec = USB_CAPTURE_WRITER_SLEEP };
+			thrd_sleep(&noDataSleep, NULL);
+			continue;
+		}
+
+		// Only this thread frees buffer space, so the data can't be overwritten
+		// while it's written out without holding the lock.
+		if (!usbCaptureWrite(state->captureFd, state->captureBuffer + position, length)) {
+			caerLog(CAER_LOG_ERROR, state->captureDeviceString, "Failed to write USB capture, disabling it. Error: %d.",
+			errno);
+
+			atomic_store(&state->captureWriteFailed, true);
+			break;
+		}
+
+		mtx_lock(&state->captureLock);
+
+		state->captureBufferHead = (position + length) % USB_CAPTURE_BUFFER_SIZE;
+		state->captureBufferUsed -= length;
+
+		mtx_unlock(&state->captureLock);
+	}
+
+	return (EXIT_SUCCESS);
+}
+
+static bool usbCaptureWrite(int fd, const uint8_t *data, size_t length) {
+	while (length > 0) {
+		ssize_t written = write(fd, data, length);
+
+		if (written < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			return (false);
+		}
+
+		data += written;
+		length -= (size_t) written;
+	}
+
+	return (true);
+}
+
+// Returns the number of bytes read, less than length only at end of file or on errors.
+static size_t usbCaptureRead(int fd, uint8_t *data, size_t length) {
+	size_t total = 0;
+
+	while (total < length) {
+		ssize_t result = read(fd, data + total, length - total);
+
+		if (result < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			break;
+		}
+
+		if (result == 0) {
+			break;
+		}
+
+		total += (size_t) result;
+	}
+
+	return (total);
+}
+
+bool usbCaptureStart(usbState state, const char *deviceString, int captureFd, bool translate, uint16_t deviceType,
+	const uint8_t *config, uint16_t configSize) {
+	state->capture = false;
+
+	if (captureFd < 0) {
+		// Capture disabled.
+		return (true);
+	}
+
+	uint8_t header[USB_CAPTURE_HEADER_SIZE] = { 0 };
+
+	uint16_t deviceTypeLE = htole16(deviceType);
+	uint16_t configSizeLE = htole16(configSize);
+	memcpy(header, USB_CAPTURE_MAGIC, USB_CAPTURE_MAGIC_LENGTH);
+	memcpy(header + USB_CAPTURE_MAGIC_LENGTH, &deviceTypeLE, sizeof(deviceTypeLE));
+	memcpy(header + USB_CAPTURE_MAGIC_LENGTH + sizeof(deviceTypeLE), &configSizeLE, sizeof(configSizeLE));
+
+	if (!usbCaptureWrite(captureFd, header, USB_CAPTURE_HEADER_SIZE)
+		|| !usbCaptureWrite(captureFd, config, configSize)) {
+		caerLog(CAER_LOG_CRITICAL, deviceString, "Failed to write USB capture header. Error: %d.", errno);
+		return (false);
+	}
+
+	state->captureBuffer = malloc(USB_CAPTURE_BUFFER_SIZE);
+	if (state->captureBuffer == NULL) {
+		caerLog(CAER_LOG_CRITICAL, deviceString, "Failed to allocate USB capture buffer.");
+		return (false);
+	}
+
+	if (mtx_init(&state->captureLock, mtx_plain) != thrd_success) {
+		free(state->captureBuffer);
+		state->captureBuffer = NULL;
+
+		caerLog(CAER_LOG_CRITICAL, deviceString, "Failed to initialize USB capture lock.");
+		return (false);
+	}
+
+	state->captureFd = captureFd;
+	state->captureDeviceString = deviceString;
+	state->captureBufferHead = 0;
+	state->captureBufferUsed = 0;
+	state->captureDroppedTransfers = 0;
+	atomic_store(&state->captureWriteFailed, false);
+	atomic_store(&state->captureWriterRun, true);
+
+	if ((errno = thrd_create(&state->captureWriterThread, &usbCaptureWriterThread, state)) != thrd_success) {
+		mtx_destroy(&state->captureLock);
+		free(state->captureBuffer);
+		state->captureBuffer = NULL;
+
+		caerLog(CAER_LOG_CRITICAL, deviceString, "Failed to start USB capture writer thread. Error: %d.", errno);
+		return (false);
+	}
+
+	memoryUsageAdd(&state->memoryUsage, CAER_DEVICE_MEMORY_USB_TRANSFERS, USB_CAPTURE_BUFFER_SIZE);
+
+	state->capture = true;
+	state->captureTranslate = translate;
+
+	return (true);
+}
+
+void usbCaptureStop(usbState state) {
+	state->capture = false;
+
+	if (state->captureBuffer == NULL) {
+		// Capture not running.
+		return;
+	}
+
+	// The writer thread writes out all data still buffered before exiting.
+	atomic_store(&state->captureWriterRun, false);
+
+	if ((errno = thrd_join(state->captureWriterThread, NULL)) != thrd_success) {
+		// This should never happen!
+		caerLog(CAER_LOG_CRITICAL, state->captureDeviceString, "Failed to join USB capture writer thread. Error: %d.",
+		errno);
+	}
+
+	mtx_destroy(&state->captureLock);
+
+	if (state->captureDroppedTransfers != 0) {
+		caerLog(CAER_LOG_WARNING, state->captureDeviceString,
+			"USB capture is missing %" PRIu64 " data transfers, writing it out could not keep up.",
+			state->captureDroppedTransfers);
+	}
+
+	memoryUsageRemove(&state->memoryUsage, CAER_DEVICE_MEMORY_USB_TRANSFERS, USB_CAPTURE_BUFFER_SIZE);
+
+	free(state->captureBuffer);
+	state->captureBuffer = NULL;
+
+	// The file descriptor belongs to the user, it's not closed here.
+}
+
+bool usbReplayStart(usbState state, const char *deviceString, int replayFd, uint16_t deviceType, uint8_t *config,
+	uint16_t configSize) {
+	state->replay = false;
+
+	if (replayFd < 0) {
+		// Replay disabled, live data.
+		return (true);
+	}
+
+	uint8_t header[USB_CAPTURE_HEADER_SIZE];
+
+	if (usbCaptureRead(replayFd, header, USB_CAPTURE_HEADER_SIZE) != USB_CAPTURE_HEADER_SIZE
+		|| memcmp(header, USB_CAPTURE_MAGIC, USB_CAPTURE_MAGIC_LENGTH) != 0) {
+		caerLog(CAER_LOG_CRITICAL, deviceString, "Failed to read USB capture header, not a USB capture file.");
+		return (false);
+	}
+
+	uint16_t captureDeviceType;
+	uint16_t captureConfigSize;
+	memcpy(&captureDeviceType, header + USB_CAPTURE_MAGIC_LENGTH, sizeof(captureDeviceType));
+	memcpy(&captureConfigSize, header + USB_CAPTURE_MAGIC_LENGTH + sizeof(captureDeviceType),
+		sizeof(captureConfigSize));
+	captureDeviceType = le16toh(captureDeviceType);
+	captureConfigSize = le16toh(captureConfigSize);
+
+	if (captureDeviceType != deviceType) {
+		caerLog(CAER_LOG_CRITICAL, deviceString,
+			"USB capture comes from device type %" PRIu16 ", cannot translate it as device type %" PRIu16 ".",
+			captureDeviceType, deviceType);
+		return (false);
+	}
+
+	if (captureConfigSize != configSize || usbCaptureRead(replayFd, config, configSize) != configSize) {
+		caerLog(CAER_LOG_CRITICAL, deviceString, "Failed to read device configuration from USB capture header.");
+		return (false);
+	}
+
+	state->replay = true;
+	state->replayFd = replayFd;
+
+	return (true);
+}
+
+// Feed the next captured data transfer to the translator, as if it had just
+// arrived at its recorded time. Returns false at the end of the capture.
+bool usbReplayTransfer(usbState state, const char *deviceString) {
+	uint8_t recordHeader[USB_CAPTURE_RECORD_HEADER_SIZE];
+
+	size_t headerRead = usbCaptureRead(state->replayFd, recordHeader, USB_CAPTURE_RECORD_HEADER_SIZE);
+	if (headerRead == 0) {
+		// Clean end of capture.
+		return (false);
+	}
+
+	uint64_t timeLE;
+	uint32_t lengthLE;
+	memcpy(&timeLE, recordHeader, sizeof(timeLE));
+	memcpy(&lengthLE, recordHeader + sizeof(timeLE), sizeof(lengthLE));
+
+	size_t length = le32toh(lengthLE);
+
+	if (headerRead != USB_CAPTURE_RECORD_HEADER_SIZE || length > USB_CAPTURE_MAX_TRANSFER_SIZE) {
+		caerLog(CAER_LOG_ERROR, deviceString, "Corrupted USB capture record, stopping replay.");
+		return (false);
+	}
+
+	if (length > state->replayBufferSize) {
+		uint8_t *newReplayBuffer = realloc(state->replayBuffer, length);
+		if (newReplayBuffer == NULL) {
+			caerLog(CAER_LOG_CRITICAL, deviceString, "Failed to allocate USB capture replay buffer.");
+			return (false);
+		}
+
+		memoryUsageAdd(&state->memoryUsage, CAER_DEVICE_MEMORY_USB_TRANSFERS, length - state->replayBufferSize);
+
+		state->replayBuffer = newReplayBuffer;
+		state->replayBufferSize = length;
+	}
+
+	if (usbCaptureRead(state->replayFd, state->replayBuffer, length) != length) {
+		caerLog(CAER_LOG_ERROR, deviceString, "Truncated USB capture record, stopping replay.");
+		return (false);
+	}
+
+	state->dataTransferTime = I64T(le64toh(timeLE));
+
+	usbDataTransfer(state, state->replayBuffer, length);
+
+	return (true);
+}
+
+void usbReplayStop(usbState state) {
+	memoryUsageRemove(&state->memoryUsage, CAER_DEVICE_MEMORY_USB_TRANSFERS, state->replayBufferSize);
+
+	free(state->replayBuffer);
+	state->replayBuffer = NULL;
+	state->replayBufferSize = 0;
+
+	// The file descriptor belongs to the user, it's not closed here.
+	state->replay = false;
+}
+
+void usbThreadConfigure(const char *deviceString, uint32_t cpuAffinity, uint32_t schedPolicy, uint32_t schedPriority,
+	bool memoryLock) {
+#if defined(HAVE_PTHREADS)
+	if (cpuAffinity != 0) {
+		if (thrd_set_affinity(cpuAffinity) != thrd_success) {
+			caerLog(CAER_LOG_ERROR, deviceString, "Failed to set data acquisition thread CPU affinity to 0x%" PRIX32 ".",
+				cpuAffinity);
+		}
+		else {
+			caerLog(CAER_LOG_DEBUG, deviceString, "Data acquisition thread CPU affinity set to 0x%" PRIX32 ".",
+				cpuAffinity);
+		}
+	}
+
+	if (schedPolicy != CAER_HOST_CONFIG_THREAD_SCHED_DEFAULT) {
+		int policy = (schedPolicy == CAER_HOST_CONFIG_THREAD_SCHED_FIFO) ? (SCHED_FIFO) : (SCHED_RR);
+
+		if (thrd_set_scheduling(policy, I32T(schedPriority)) != thrd_success) {
+			caerLog(CAER_LOG_ERROR, deviceString,
+				"Failed to set data acquisition thread real-time scheduling (policy %" PRIu32 ", priority %" PRIu32 "). Check privileges and priority range.",
+				schedPolicy, schedPriority);
+		}
+		else {
+			caerLog(CAER_LOG_DEBUG, deviceString,
+				"Data acquisition thread real-time scheduling set (policy %" PRIu32 ", priority %" PRIu32 ").",
+				schedPolicy, schedPriority);
+		}
+	}
+#else
+	if (cpuAffinity != 0 || schedPolicy != CAER_HOST_CONFIG_THREAD_SCHED_DEFAULT) {
+		caerLog(CAER_LOG_ERROR, deviceString,
+			"Data acquisition thread CPU affinity and scheduling are not supported on this platform.");
+	}
+
+	(void) (schedPriority); // UNUSED.
+#endif
+
+	if (memoryLock) {
+#if defined(OS_UNIX)
+		if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+			caerLog(CAER_LOG_ERROR, deviceString, "Failed to lock process memory. Error: %d.", errno);
+		}
+		else {
+			caerLog(CAER_LOG_DEBUG, deviceString, "Process memory locked.");
+		}
+#else
+		caerLog(CAER_LOG_ERROR, deviceString, "Memory locking is not supported on this platform.");
+#endif
+	}
+}
+
+void usbThreadWakeup(usbState state) {
+#if defined(LIBUSB_API_VERSION) && (LIBUSB_API_VERSION >= 0x01000105)
+	// Make the data acquisition thread return from libusb_handle_events_timeout()
+	// right away, instead of waiting for data or for its timeout, so it sees new
+	// commands immediately. Also works if it isn't handling events yet.
+	libusb_interrupt_event_handler(state->deviceContext);
+#else
+	// Needs libusb 1.0.21: commands are seen on the next event or timeout.
+	(void) (state);
+#endif
+}
+
+struct usb_pipelined_state {
+	atomic_uint_fast32_t transfersInFlight;
+	atomic_bool transfersFailed;
+};
+
+static void LIBUSB_CALL usbPipelinedCallback(struct libusb_transfer *transfer) {
+	struct usb_pipelined_state *pipelinedState = transfer->user_data;
+
+	if (transfer->status != LIBUSB_TRANSFER_COMPLETED
+		|| transfer->actual_length != (transfer->length - LIBUSB_CONTROL_SETUP_SIZE)) {
+		atomic_store(&pipelinedState->transfersFailed, true);
+	}
+
+	// Buffer and transfer are freed by libusb after return,
+	// thanks to the LIBUSB_TRANSFER_FREE_* flags.
+	atomic_fetch_sub(&pipelinedState->transfersInFlight, 1);
+}
+
+static void usbPipelinedWait(usbState state, struct usb_pipelined_state *pipelinedState, uint32_t maxInFlight) {
+	// Completions may also be handled by the data acquisition thread, if
+	// running, so we only ever poll with a short timeout here.
+	struct timeval te = { .tv_sec = 0, .tv_usec = 1000 };
+
+	while (atomic_load(&pipelinedState->transfersInFlight) > maxInFlight) {
+		libusb_handle_events_timeout_completed(state->deviceContext, &te, NULL);
+	}
+}
+
+static bool usbPipelinedVerify(usbState state, uint8_t request) {
+	uint8_t check[2] = { 0 };
+
+	int result = libusb_control_transfer(state->deviceHandle,
+		LIBUSB_ENDPOINT_IN | LIBUSB_REQUEST_TYPE_VENDOR | LIBUSB_RECIPIENT_DEVICE, request, 0, 0, check,
+		sizeof(check), 0);
+
+	return (result == sizeof(check) && check[0] == request && check[1] == 0);
+}
+
+/**
+ * Send a long list of multi-config entries (USB_CONFIG_MULTIPLE_SIZE bytes each) to the device,
+ * using asynchronous control transfers of up to USB_CONFIG_MULTIPLE_MAX_NUMBER configs each,
+ * keeping up to maxTransfersInFlight of them queued at the same time.
+ * If verify is true, the device status for 'request' is read back every verifyInterval
+ * transfers (0 means only once at the end), after all queued transfers have completed.
+ * If configsPerSecond is not NULL, the achieved throughput is stored there.
+ */
+bool usbConfigMultipleSendPipelined(usbState state, const char *deviceString, uint8_t request,
+	const uint8_t *configs, size_t configsNumber, size_t maxTransfersInFlight, size_t verifyInterval, bool verify,
+	double *configsPerSecond) {
+	if (maxTransfersInFlight == 0) {
+		maxTransfersInFlight = USB_CONFIG_PIPELINED_DEFAULT_IN_FLIGHT;
+	}
+
+	struct usb_pipelined_state pipelinedState;
+	atomic_store(&pipelinedState.transfersInFlight, 0);
+	atomic_store(&pipelinedState.transfersFailed, false);
+
+	struct timespec startTime;
+	clock_gettime(CLOCK_MONOTONIC, &startTime);
+
+	bool success = true;
+	size_t transfersSent = 0;
+	size_t configsSent = 0;
+
+	while (configsSent < configsNumber) {
+		size_t configNum = configsNumber - configsSent;
+		if (configNum > USB_CONFIG_MULTIPLE_MAX_NUMBER) {
+			configNum = USB_CONFIG_MULTIPLE_MAX_NUMBER;
+		}
+		size_t configSize = configNum * USB_CONFIG_MULTIPLE_SIZE;
+
+		// Wait for a free slot in the pipeline.
+		usbPipelinedWait(state, &pipelinedState, U32T(maxTransfersInFlight - 1));
+
+		if (atomic_load(&pipelinedState.transfersFailed)) {
+			caerLog(CAER_LOG_CRITICAL, deviceString, "Failed to send pipelined config, USB transfer failed.");
+			success = false;
+			break;
+		}
+
+		struct libusb_transfer *transfer = libusb_alloc_transfer(0);
+		uint8_t *buffer = malloc(LIBUSB_CONTROL_SETUP_SIZE + configSize);
+		if (transfer == NULL || buffer == NULL) {
+			caerLog(CAER_LOG_CRITICAL, deviceString, "Failed to allocate memory for pipelined config transfer.");
+
+			libusb_free_transfer(transfer);
+			free(buffer);
+
+			success = false;
+			break;
+		}
+
+		libusb_fill_control_setup(buffer, LIBUSB_ENDPOINT_OUT | LIBUSB_REQUEST_TYPE_VENDOR | LIBUSB_RECIPIENT_DEVICE,
+			request, U16T(configNum), 0, U16T(configSize));
+		memcpy(buffer + LIBUSB_CONTROL_SETUP_SIZE, configs + (configsSent * USB_CONFIG_MULTIPLE_SIZE), configSize);
+
+		libusb_fill_control_transfer(transfer, state->deviceHandle, buffer, &usbPipelinedCallback, &pipelinedState,
+			0);
+		transfer->flags = LIBUSB_TRANSFER_FREE_BUFFER | LIBUSB_TRANSFER_FREE_TRANSFER;
+
+		atomic_fetch_add(&pipelinedState.transfersInFlight, 1);
+
+		if ((errno = libusb_submit_transfer(transfer)) != LIBUSB_SUCCESS) {
+			caerLog(CAER_LOG_CRITICAL, deviceString, "Unable to submit pipelined config transfer. Error: %s (%d).",
+				libusb_strerror(errno), errno);
+
+			atomic_fetch_sub(&pipelinedState.transfersInFlight, 1);
+			libusb_free_transfer(transfer); // Also frees buffer.
+
+			success = false;
+			break;
+		}
+
+		transfersSent++;
+		configsSent += configNum;
+
+		// Intermediate verification, if requested, needs the pipeline drained.
+		if (verify && verifyInterval != 0 && (transfersSent % verifyInterval) == 0 && configsSent < configsNumber) {
+			usbPipelinedWait(state, &pipelinedState, 0);
+
+			if (atomic_load(&pipelinedState.transfersFailed) || !usbPipelinedVerify(state, request)) {
+				caerLog(CAER_LOG_CRITICAL, deviceString,
+					"Failed to send pipelined config, USB transfer failed on verification.");
+				success = false;
+				break;
+			}
+		}
+	}
+
+	// Always drain the pipeline, the callbacks reference our local state.
+	usbPipelinedWait(state, &pipelinedState, 0);
+
+	if (success && atomic_load(&pipelinedState.transfersFailed)) {
+		caerLog(CAER_LOG_CRITICAL, deviceString, "Failed to send pipelined config, USB transfer failed.");
+		success = false;
+	}
+
+	if (success && verify && !usbPipelinedVerify(state, request)) {
+		caerLog(CAER_LOG_CRITICAL, deviceString, "Failed to send pipelined config, USB transfer failed on verification.");
+		success = false;
+	}
+
+	struct timespec endTime;
+	clock_gettime(CLOCK_MONOTONIC, &endTime);
+
+	double elapsedSeconds = (double) (endTime.tv_sec - startTime.tv_sec)
+		+ ((double) (endTime.tv_nsec - startTime.tv_nsec) / 1000000000);
+	double throughput = (elapsedSeconds > 0) ? ((double) configsSent / elapsedSeconds) : (0);
+
+	if (configsPerSecond != NULL) {
+		*configsPerSecond = throughput;
+	}
+
+	caerLog(CAER_LOG_DEBUG, deviceString, "Pipelined config: sent %zu configs in %zu transfers, %.0f configs/s.",
+		configsSent, transfersSent, throughput);
+
+	return (success);
+}
@@ -2,7 +2,14 @@
 #define LIBCAER_SRC_USB_UTILS_H_
 
 #include "libcaer.h"
+#include "profiling.h"
+#include "memory_usage.h"
 #include <libusb.h>
+#include <stdatomic.h>
+
+#if defined(HAVE_PTHREADS)
+	#include "c11threads_posix.h"
+#endif
 
 #define USB_DEFAULT_DEVICE_VID 0x152A
 
@@ -11,6 +18,29 @@
 #define VENDOR_REQUEST_FPGA_CONFIG          0xBF
 #define VENDOR_REQUEST_FPGA_CONFIG_MULTIPLE 0xC2
 
+// Multi-config requests: 6 bytes per config, max. 85 per control transfer (510 bytes).
+#define USB_CONFIG_MULTIPLE_SIZE 6
+#define USB_CONFIG_MULTIPLE_MAX_NUMBER 85
+#define USB_CONFIG_PIPELINED_DEFAULT_IN_FLIGHT 8
+
+// Raw USB capture files: header (magic, device type and device configuration
+// size as uint16_t, zero padding), followed by the device configuration the
+// translator depends on, then one record per data transfer: host arrival time
+// in µs (int64_t) and data length in bytes (uint32_t), followed by the data.
+// All integers little-endian.
+#define USB_CAPTURE_MAGIC "CAERUSB2"
+#define USB_CAPTURE_MAGIC_LENGTH 8
+#define USB_CAPTURE_HEADER_SIZE 16
+#define USB_CAPTURE_RECORD_HEADER_SIZE 12
+// Sanity limit on record length, to detect corrupted captures.
+#define USB_CAPTURE_MAX_TRANSFER_SIZE (16 * 1024 * 1024)
+// Captured transfers wait in memory for the writer thread. If it falls this
+// far behind, further transfers are dropped from the capture.
+#define USB_CAPTURE_BUFFER_SIZE (16 * 1024 * 1024)
+#define USB_CAPTURE_THREAD_NAME "USB Capture"
+// How long the writer thread sleeps when there is nothing to write (ns).
+#define USB_CAPTURE_WRITER_SLEEP 1000000
+
 struct usb_state {
 	// USB Device State
 	libusb_context *deviceContext;
@@ -19,6 +49,32 @@ struct usb_state {
 	struct libusb_transfer **dataTransfers;
 	size_t dataTransfersLength;
 	size_t activeDataTransfers;
+	// Host time (CLOCK_MONOTONIC, in µs) at which the data transfer being handled completed.
+	int64_t dataTransferTime;
+	// Data acquisition time accounting, only updated if profiling support is enabled.
+	struct profiling_state profiling;
+	// Bytes held by the device's data acquisition, by type.
+	struct memory_usage memoryUsage;
+	// Raw capture of the data transfers, and whether to still translate them.
+	bool capture;
+	int captureFd;
+	bool captureTranslate;
+	const char *captureDeviceString;
+	// Circular buffer of captured records, from head for used bytes, drained
+	// to captureFd by the writer thread. Protected by captureLock.
+	uint8_t *captureBuffer;
+	size_t captureBufferHead;
+	size_t captureBufferUsed;
+	uint64_t captureDroppedTransfers;
+	mtx_t captureLock;
+	thrd_t captureWriterThread;
+	atomic_bool captureWriterRun;
+	atomic_bool captureWriteFailed;
+	// Raw capture replayed instead of live data transfers.
+	bool replay;
+	int replayFd;
+	uint8_t *replayBuffer;
+	size_t replayBufferSize;
 	// User data pointer/callback
 	void *userData;
 	void (*userCallback)(void *handle, uint8_t *buffer, size_t bytesSent);
@@ -42,5 +98,19 @@ libusb_device_handle *usbDeviceOpen(libusb_context *devContext, uint16_t devVID,
 void usbDeviceClose(libusb_device_handle *devHandle);
 void usbAllocateTransfers(usbState state, uint32_t bufferNum, uint32_t bufferSize, uint8_t dataEndPoint);
 void usbDeallocateTransfers(usbState state);
+int64_t usbHostTime(void);
+bool usbCaptureStart(usbState state, const char *deviceString, int captureFd, bool translate, uint16_t deviceType,
+	const uint8_t *config, uint16_t configSize);
+void usbCaptureStop(usbState state);
+bool usbReplayStart(usbState state, const char *deviceString, int replayFd, uint16_t deviceType, uint8_t *config,
+	uint16_t configSize);
+bool usbReplayTransfer(usbState state, const char *deviceString);
+void usbReplayStop(usbState state);
+void usbThreadConfigure(const char *deviceString, uint32_t cpuAffinity, uint32_t schedPolicy, uint32_t schedPriority,
+	bool memoryLock);
+void usbThreadWakeup(usbState state);
+bool usbConfigMultipleSendPipelined(usbState state, const char *deviceString, uint8_t request,
+	const uint8_t *configs, size_t configsNumber, size_t maxTransfersInFlight, size_t verifyInterval, bool verify,
+	double *configsPerSecond);
 
 #endif /* LIBCAER_SRC_USB_UTILS_H_ */
@@ -0,0 +1,108 @@
+#include "watermark.h"
+
+static void watermarkNotify(struct watermark_state *state);
+
+void watermarkInit(struct watermark_state *state) {
+	atomic_store_explicit(&state->high, 0, memory_order_relaxed);
+	atomic_store_explicit(&state->low, WATERMARK_DEFAULT_LOW, memory_order_relaxed);
+	atomic_store_explicit(&state->reached, false, memory_order_relaxed);
+	atomic_store_explicit(&state->notified, false, memory_order_relaxed);
+	atomic_store_explicit(&state->notifying, false, memory_order_relaxed);
+
+	state->capacity = 0;
+	state->putCapacity = 0;
+	state->notify = NULL;
+	state->notifyUserPtr = NULL;
+}
+
+void watermarkReset(struct watermark_state *state, size_t capacity, size_t putCapacity) {
+	atomic_store_explicit(&state->reached, false, memory_order_relaxed);
+	atomic_store_explicit(&state->notified, false, memory_order_relaxed);
+	atomic_store_explicit(&state->notifying, false, memory_order_relaxed);
+
+	state->capacity = capacity;
+	state->putCapacity = putCapacity;
+}
+
+void watermarkUpdate(struct watermark_state *state, size_t used) {
+	uint_fast32_t high = atomic_load_explicit(&state->high, memory_order_relaxed);
+
+	if (high == 0 || state->notify == NULL) {
+		return;
+	}
+
+	// Levels in elements. The high one is capped to what regular puts can fill,
+	// so it is always reachable, and the low one is kept below it, so that small
+	// buffers can't make notifications flap.
+	size_t highLevel = (((size_t) high * state->capacity) + 99) / 100;
+	if (highLevel > state->putCapacity) {
+		highLevel = state->putCapacity;
+	}
+
+	// Both the producer and the consumers update, after every put or get.
+	// The exchange makes sure only one of them flips the state on a crossing,
+	// and later updates catch any crossing missed by racing with the other side.
+	if (!atomic_load_explicit(&state->reached, memory_order_relaxed)) {
+		if (used >= highLevel && !atomic_exchange(&state->reached, true)) {
+			watermarkNotify(state);
+		}
+	}
+	else {
+		size_t lowLevel = ((size_t) atomic_load_explicit(&state->low, memory_order_relaxed) * state->capacity) / 100;
+		if (lowLevel >= highLevel) {
+			lowLevel = highLevel - 1;
+		}
+
+		if (used <= lowLevel && atomic_exchange(&state->reached, false)) {
+			watermarkNotify(state);
+		}
+	}
+}
+
+// Send notifications until the last one sent matches the current state. Only
+// one thread sends at a time, so they always reach the user in the order the
+// state changed, alternating between high and low. A thread finding another
+// one sending leaves its change to it, instead of waiting: the sender checks
+// again after giving up its role. Changes undone before being sent are skipped.
+static void watermarkNotify(struct watermark_state *state) {
+	while (!atomic_exchange(&state->notifying, true)) {
+		bool reached;
+
+		while ((reached = atomic_load(&state->reached))
+			!= atomic_load_explicit(&state->notified, memory_order_relaxed)) {
+			atomic_store_explicit(&state->notified, reached, memory_order_relaxed);
+			state->notify(state->notifyUserPtr, reached);
+		}
+
+		atomic_store(&state->notifying, false);
+
+		// Pairs with the exchanges above: either a thread that changed the state
+		// saw notifying cleared and sends itself, or the state change is seen here.
+		if (atomic_load(&state->reached) == atomic_load_explicit(&state->notified, memory_order_relaxed)) {
+			break;
+		}
+	}
+}
+
+bool watermarkSetHigh(struct watermark_state *state, uint32_t high) {
+	// Zero disables notifications, and is always accepted.
+	if (high > 100 || (high != 0 && high <= atomic_load_explicit(&state->low, memory_order_relaxed))) {
+		return (false);
+	}
+
+	atomic_store_explicit(&state->high, high, memory_order_relaxed);
+
+	return (true);
+}
+
+bool watermarkSetLow(struct watermark_state *state, uint32_t low) {
+	uint_fast32_t high = atomic_load_explicit(&state->high, memory_order_relaxed);
+
+	if (low > 100 || (high != 0 && low >= high)) {
+		return (false);
+	}
+
+	atomic_store_explicit(&state->low, low, memory_order_relaxed);
+
+	return (true);
+}
@@ -0,0 +1,36 @@
+#ifndef LIBCAER_SRC_WATERMARK_H_
+#define LIBCAER_SRC_WATERMARK_H_
+
+#include "libcaer.h"
+#include <stdatomic.h>
+
+// Default low watermark, in percent of the data exchange buffer size.
+// The high watermark defaults to zero, which disables notifications.
+#define WATERMARK_DEFAULT_LOW 25
+
+struct watermark_state {
+	// Thresholds in percent of capacity, take effect immediately.
+	atomic_uint_fast32_t high;
+	atomic_uint_fast32_t low;
+	// Whether the high watermark was reached, and the low one not since.
+	atomic_bool reached;
+	// Last state sent to notify, and whether a thread is sending right now.
+	// Notifications are only ever sent by one thread at a time.
+	atomic_bool notified;
+	atomic_bool notifying;
+	// Only change on DataStart() calls! Regular puts can't fill all of capacity.
+	size_t capacity;
+	size_t putCapacity;
+	// Notification, only set while data acquisition isn't running.
+	void (*notify)(void *ptr, bool high);
+	void *notifyUserPtr;
+};
+
+void watermarkInit(struct watermark_state *state);
+void watermarkReset(struct watermark_state *state, size_t capacity, size_t putCapacity);
+void watermarkUpdate(struct watermark_state *state, size_t used);
+// Configuration, rejects levels above 100 and a low level not below the high one.
+bool watermarkSetHigh(struct watermark_state *state, uint32_t high);
+bool watermarkSetLow(struct watermark_state *state, uint32_t low);
+
+#endif /* LIBCAER_SRC_WATERMARK_H_ */